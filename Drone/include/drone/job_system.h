@@ -218,7 +218,23 @@ namespace drone
                 SubmitInternal(job);
             }
 
-            counter.Wait();
+            // A worker that parks here holds a thread the chunks may need: with nested
+            // ParallelFor calls every worker could end up waiting. Help instead.
+            const size_t workerIdx = WorkerContext::CurrentWorkerIndex();
+            if (workerIdx < m_workerCount)
+            {
+                while (!counter.IsDone())
+                {
+                    if (!TryExecuteOne(workerIdx))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+            else
+            {
+                counter.Wait();
+            }
         }
 
         // --- Worker info ---
@@ -120,6 +120,35 @@ namespace
         }
     });
 
+    auto t17 = larvae::RegisterTest("DroneJobSystem", "NestedParallelForFromWorkers", []() {
+        TestJobSystem js;
+
+        // Every worker calls ParallelFor at once; waiting workers must help or the pool starves
+        struct Outer
+        {
+            drone::JobSystem<TestAlloc>* m_system;
+            std::atomic<int> m_count{0};
+        };
+        Outer outer{&js.m_system};
+
+        drone::Counter counter;
+        drone::JobDecl jobs[4];
+        for (auto& job : jobs)
+        {
+            job.m_func = [](void* data) {
+                auto* o = static_cast<Outer*>(data);
+                o->m_system->ParallelFor(
+                    0, 64,
+                    [](size_t, void* ud) { static_cast<Outer*>(ud)->m_count.fetch_add(1); }, o, 4);
+            };
+            job.m_userData = &outer;
+        }
+        js.m_system.Submit(jobs, 4, counter);
+        counter.Wait();
+
+        larvae::AssertEqual(outer.m_count.load(), 4 * 64);
+    });
+
     auto t8 = larvae::RegisterTest("DroneJobSystem", "WorkerScratchExists", []() {
         TestJobSystem js;
         std::atomic<bool> ok{false};
@@ -34,7 +34,7 @@ namespace queen
      *
      * Performance characteristics:
      * - Get(): O(n) where n = active threads (linear search, cached)
-     * - FlushAll(): O(c) where c = total commands across all buffers
+     * - FlushAll(): O(c log c) where c = total commands across all buffers
      * - Thread-safe: Yes (each thread has its own buffer)
      *
      * Use cases:
@@ -107,7 +107,8 @@ namespace queen
          * Flush all thread-local command buffers to the World
          *
          * Must be called from a single thread (not during parallel execution).
-         * Buffers are applied in deterministic order (by thread index).
+         * Buffers are applied in deterministic order (by thread index), each
+         * one through CommandBuffer::FlushBatched.
          *
          * @param world The World to apply commands to
          */
@@ -117,7 +118,7 @@ namespace queen
             {
                 if (!m_buffers[i].IsEmpty())
                 {
-                    m_buffers[i].Flush(world);
+                    m_buffers[i].FlushBatched(world);
                 }
             }
         }
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <queen/core/dense_id.h>
 #include <queen/core/type_id.h>
 
 #include <cstddef>
+#include <cstring>
 #include <new>
 #include <type_traits>
 #include <utility>
@@ -43,6 +45,29 @@ namespace queen
                 return StorageType::DENSE;
             }
         }
+
+        template <typename T, typename = void> struct HasRelocatableHint : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct HasRelocatableHint<T, std::void_t<decltype(T::trivially_relocatable)>> : std::true_type
+        {
+        };
+
+        // Trivially copyable types, or types declaring trivially_relocatable = true
+        // that are also trivially destructible
+        template <typename T> constexpr bool DeduceTriviallyRelocatable() noexcept
+        {
+            if constexpr (HasRelocatableHint<T>::value)
+            {
+                return T::trivially_relocatable && std::is_trivially_destructible_v<T>;
+            }
+            else
+            {
+                return std::is_trivially_copyable_v<T>;
+            }
+        }
     } // namespace detail
 
     /**
@@ -77,6 +102,7 @@ namespace queen
         static constexpr size_t alignment = alignof(T);
         static constexpr bool isTriviallyCopyable = std::is_trivially_copyable_v<T>;
         static constexpr bool isTriviallyDestructible = std::is_trivially_destructible_v<T>;
+        static constexpr bool isTriviallyRelocatable = detail::DeduceTriviallyRelocatable<T>();
         inline static const StorageType storage = detail::DeduceStorage<T>();
 
         static void Construct(void* ptr)
@@ -111,15 +137,24 @@ namespace queen
      * │ type_id: TypeId (8 bytes)                                  │
      * │ size: size_t (8 bytes)                                     │
      * │ alignment: size_t (8 bytes)                                │
-     * │ storage: StorageType (1 byte) + padding (7 bytes)          │
+     * │ storage: StorageType (1 byte)                              │
+     * │ trivially_relocatable: bool (1 byte)                       │
+     * │ trivially_copyable: bool (1 byte) + padding (5 bytes)      │
      * │ construct: void(*)(void*) (8 bytes)                        │
      * │ destruct: void(*)(void*) (8 bytes)                         │
      * │ move: void(*)(void*, void*) (8 bytes)                      │
      * │ copy: void(*)(void*, const void*) (8 bytes)                │
+     * │ dense_id: DenseId (4 bytes)                                │
      * └────────────────────────────────────────────────────────────┘
      *
+     * Trivially relocatable components (see ComponentInfo) are moved with
+     * memcpy and never destroyed, so MoveConstruct() and the bulk paths of
+     * Column skip the function pointers entirely. Trivially copyable ones
+     * are also copied in bulk (World::SpawnBatchRaw, WorldSnapshot).
+     * Hand-built metas default to the function pointers.
+     *
      * Performance characteristics:
-     * - All operations: O(1) - function pointer call
+     * - All operations: O(1) - function pointer call, memcpy when relocatable
      *
      * Example:
      * @code
@@ -139,21 +174,58 @@ namespace queen
         size_t m_size = 0;
         size_t m_alignment = 0;
         StorageType m_storage = StorageType::DENSE;
+        bool m_triviallyRelocatable = false;
+        bool m_triviallyCopyable = false;
         ConstructFn m_construct = nullptr;
         DestructFn m_destruct = nullptr;
         MoveFn m_move = nullptr;
         CopyFn m_copy = nullptr;
+        DenseId m_denseId = kInvalidDenseId;
 
         [[nodiscard]] constexpr bool IsValid() const noexcept
         {
             return m_typeId != 0 && m_size > 0;
         }
 
+        /**
+         * DenseId of the component, registering it for hand-built metas
+         */
+        [[nodiscard]] DenseId ResolveDenseId() const noexcept
+        {
+            return m_denseId != kInvalidDenseId ? m_denseId : RegisterDenseId(m_typeId);
+        }
+
         [[nodiscard]] constexpr bool IsTrivial() const noexcept
         {
             return m_destruct == nullptr;
         }
 
+        [[nodiscard]] constexpr bool IsTriviallyRelocatable() const noexcept
+        {
+            return m_triviallyRelocatable;
+        }
+
+        // Copies may be plain memcpy, implies IsTriviallyRelocatable()
+        [[nodiscard]] constexpr bool IsTriviallyCopyable() const noexcept
+        {
+            return m_triviallyCopyable;
+        }
+
+        /**
+         * Move-construct dst from src, src stays alive and must still be destroyed
+         */
+        void MoveConstruct(void* dst, void* src) const noexcept
+        {
+            if (m_triviallyRelocatable || m_move == nullptr)
+            {
+                std::memcpy(dst, src, m_size);
+            }
+            else
+            {
+                m_move(dst, src);
+            }
+        }
+
         template <typename T> [[nodiscard]] static ComponentMeta Of() noexcept
         {
             using Info = ComponentInfo<T>;
@@ -163,6 +235,9 @@ namespace queen
             meta.m_size = Info::size;
             meta.m_alignment = Info::alignment;
             meta.m_storage = Info::storage;
+            meta.m_triviallyRelocatable = Info::isTriviallyRelocatable;
+            meta.m_triviallyCopyable = Info::isTriviallyCopyable;
+            meta.m_denseId = DenseIdOf<T>();
 
             if constexpr (std::is_default_constructible_v<T>)
             {
@@ -193,6 +268,7 @@ namespace queen
             meta.m_typeId = TypeIdOf<T>();
             meta.m_size = 0;
             meta.m_alignment = 1;
+            meta.m_denseId = DenseIdOf<T>();
             return meta;
         }
     };
@@ -283,6 +283,45 @@ namespace queen
             return !Intersects(other);
         }
 
+        /**
+         * Check that this mask contains all of required and none of excluded
+         *
+         * Single pass of AND/ANDNOT over the blocks, OR-reduced without
+         * early exits so the loops vectorize. Used as the archetype
+         * signature test of QueryDescriptor::MatchesArchetype.
+         */
+        [[nodiscard]] bool MatchesSignature(const ComponentMask& required, const ComponentMask& excluded) const noexcept
+        {
+            const uint64_t* ours = m_blocks.Data();
+            const size_t ourSize = m_blocks.Size();
+
+            const uint64_t* req = required.m_blocks.Data();
+            const size_t reqSize = required.m_blocks.Size();
+            const size_t reqShared = reqSize < ourSize ? reqSize : ourSize;
+
+            uint64_t missing = 0;
+            for (size_t i = 0; i < reqShared; ++i)
+            {
+                missing |= req[i] & ~ours[i];
+            }
+            for (size_t i = reqShared; i < reqSize; ++i)
+            {
+                missing |= req[i];
+            }
+
+            const uint64_t* exc = excluded.m_blocks.Data();
+            const size_t excSize = excluded.m_blocks.Size();
+            const size_t excShared = excSize < ourSize ? excSize : ourSize;
+
+            uint64_t present = 0;
+            for (size_t i = 0; i < excShared; ++i)
+            {
+                present |= exc[i] & ours[i];
+            }
+
+            return (missing | present) == 0;
+        }
+
         /**
          * Bitwise AND with another mask (intersection)
          */
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <hive/hive_config.h>
+
+#include <queen/core/type_id.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace queen
+{
+    /**
+     * Small dense index of a component type
+     *
+     * TypeId is a 64-bit name hash, fine as a key but only usable through a
+     * hash lookup. A DenseId is assigned to each component type the first
+     * time it is used (0, 1, 2, ...), so tables and archetypes can map a
+     * component to its column or transition through a flat array.
+     *
+     * Ids are process-wide rather than per World: the registry lives in the
+     * Queen library so every module of a hot-reload build sees the same
+     * ids, and DenseIdOf<T>() caches the id in a function-local static so
+     * the typed hot path never touches the registry again.
+     *
+     * Performance characteristics:
+     * - DenseIdOf<T>: O(1), one guarded static load after the first call
+     * - RegisterDenseId / FindDenseId: O(1) average, takes a mutex
+     *
+     * Limitations:
+     * - At most kMaxDenseIds component types per process
+     * - Ids are never recycled
+     *
+     * Example:
+     * @code
+     *   DenseId pos = DenseIdOf<Position>();
+     *   Column<Allocator>* column = table.GetColumnByDenseId(pos);
+     * @endcode
+     */
+    using DenseId = uint32_t;
+
+    static constexpr DenseId kInvalidDenseId = UINT32_MAX;
+    static constexpr size_t kMaxDenseIds = 4096;
+
+    /**
+     * Get the DenseId of typeId, assigning the next free one if needed
+     */
+    HIVE_API DenseId RegisterDenseId(TypeId typeId) noexcept;
+
+    /**
+     * Get the DenseId of typeId, kInvalidDenseId if never registered
+     */
+    HIVE_API DenseId FindDenseId(TypeId typeId) noexcept;
+
+    /**
+     * Number of DenseIds assigned so far
+     */
+    HIVE_API size_t DenseIdCount() noexcept;
+
+    template <typename T> [[nodiscard]] DenseId DenseIdOf() noexcept
+    {
+        static const DenseId id = RegisterDenseId(TypeIdOf<T>());
+        return id;
+    }
+} // namespace queen
@@ -26,6 +26,7 @@ namespace queen
      * Performance characteristics:
      * - Allocate: O(1)
      * - Deallocate: O(1)
+     * - ReleaseAll: O(n) where n = indices handed out
      * - IsAlive: O(1)
      * - Memory: O(max_allocated_entities)
      *
@@ -78,7 +79,37 @@ namespace queen
                 m_generations.PushBack(0);
             }
 
-            return Entity{index, 0, Entity::Flags::kAlive};
+            return Entity{index, m_generations[index], Entity::Flags::kAlive};
+        }
+
+        /**
+         * Allocate count entities into out, recycling freed indices first
+         */
+        void AllocateBatch(Entity* out, size_t count)
+        {
+            size_t produced = 0;
+            while (produced < count && !m_freeList.IsEmpty())
+            {
+                out[produced++] = Allocate();
+            }
+
+            const size_t fresh = count - produced;
+            if (fresh == 0)
+            {
+                return;
+            }
+
+            hive::Assert(m_nextIndex + fresh - 1 <= Entity::kMaxIndex, "Entity index overflow");
+            if (m_generations.Size() < m_nextIndex + fresh)
+            {
+                m_generations.Resize(m_nextIndex + fresh, Entity::GenerationType{0});
+            }
+
+            for (size_t i = 0; i < fresh; ++i)
+            {
+                const uint32_t index = m_nextIndex++;
+                out[produced++] = Entity{index, m_generations[index], Entity::Flags::kAlive};
+            }
         }
 
         void Deallocate(Entity entity)
@@ -133,6 +164,26 @@ namespace queen
             return m_freeList.Size();
         }
 
+        /**
+         * Free every entity at once, keeping the generations
+         *
+         * Every index handed out so far has its generation bumped, so old
+         * handles stay dead, and allocation restarts from index 0 in order.
+         * O(TotalAllocated()) over a flat 16-bit array.
+         */
+        void ReleaseAll()
+        {
+            for (uint32_t i = 0; i < m_nextIndex; ++i)
+            {
+                Entity::GenerationType& gen = m_generations[i];
+                if (gen < Entity::kMaxGeneration)
+                    ++gen;
+            }
+
+            m_freeList.Clear();
+            m_nextIndex = 0;
+        }
+
         void Clear()
         {
             m_generations.Clear();
@@ -72,6 +72,14 @@ namespace queen
             m_records[index] = record;
         }
 
+        /**
+         * Make room for records up to (but excluding) entity index count
+         */
+        void Reserve(size_t count)
+        {
+            m_records.Reserve(count);
+        }
+
         void Remove(Entity entity)
         {
             if (entity.IsNull())
@@ -182,5 +182,20 @@ namespace queen
             m_added = currentTick;
             m_changed = currentTick;
         }
+
+        /**
+         * Keep the newer of each tick (used for conservative block summaries)
+         */
+        constexpr void Merge(const ComponentTicks& other) noexcept
+        {
+            if (other.m_added.IsNewerThan(m_added))
+            {
+                m_added = other.m_added;
+            }
+            if (other.m_changed.IsNewerThan(m_changed))
+            {
+                m_changed = other.m_changed;
+            }
+        }
     };
 } // namespace queen
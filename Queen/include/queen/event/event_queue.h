@@ -1,9 +1,14 @@
 #pragma once
 
 #include <comb/allocator_concepts.h>
+#include <comb/memory_resource.h>
+
+#include <hive/core/assert.h>
 
 #include <wax/containers/vector.h>
 
+#include <drone/worker_context.h>
+
 #include <queen/event/event.h>
 
 #include <cstddef>
@@ -22,6 +27,17 @@ namespace queen
      * - Events persist for exactly 2 frames
      * - No explicit cleanup required (automatic on swap)
      *
+     * Parallel writes:
+     * Between BeginParallelWrites() and EndParallelWrites(), pushes go to
+     * a staging buffer owned by the calling thread (slot 0 for the main
+     * thread, 1..N for Drone workers, like Commands). EndParallelWrites()
+     * appends the slots to the current buffer in slot order, so readers
+     * keep one contiguous view. Events sent by one system stay in send
+     * order; the order between systems depends on which worker ran them.
+     * Slots allocate from the thread-safe default allocator, since
+     * workers grow their slots concurrently and the queue allocator
+     * (usually the world's persistent BuddyAllocator) is not thread-safe.
+     *
      * Use cases:
      * - Gameplay event communication between systems
      * - Input event distribution
@@ -32,6 +48,7 @@ namespace queen
      * ┌────────────────────────────────────────────────────────────────┐
      * │ current_: uint8_t (buffer index 0 or 1)                        │
      * │ buffers_[2]: Vector<T> (double-buffered event storage)         │
+     * │ staged_: Vector<Vector<T>> (per-thread slots, parallel writes) │
      * │                                                                │
      * │ Frame N:                                                       │
      * │ ┌─────────────────────────┬─────────────────────────┐          │
@@ -50,14 +67,15 @@ namespace queen
      * - Write (Push): O(1) amortized - vector push_back
      * - Read iteration: O(n) - cache-friendly sequential access
      * - Swap: O(1) - index flip + vector clear
+     * - EndParallelWrites: O(s + e) for s slots and e staged events
      * - Memory: Contiguous storage per buffer (cache-friendly)
-     * - Thread-safe: No (use external synchronization)
+     * - Thread-safe: Push only, between Begin/EndParallelWrites
      *
      * Limitations:
      * - Events must satisfy Event concept (trivially copyable)
      * - 2-frame maximum lifetime (silent drop after)
-     * - Not thread-safe for concurrent writes
-     * - Single writer expected (use per-system queues for parallel)
+     * - Outside parallel writes, a single writer is expected
+     * - Staged events are invisible to readers until EndParallelWrites()
      *
      * Example:
      * @code
@@ -92,7 +110,9 @@ namespace queen
 
         explicit EventQueue(Allocator& allocator)
             : m_buffers{wax::Vector<T>{allocator}, wax::Vector<T>{allocator}}
+            , m_staged{allocator}
             , m_current{0}
+            , m_parallel{false}
         {
         }
 
@@ -110,7 +130,7 @@ namespace queen
          */
         void Push(const T& event)
         {
-            m_buffers[m_current].PushBack(event);
+            WriteBuffer().PushBack(event);
         }
 
         /**
@@ -120,7 +140,7 @@ namespace queen
          */
         void Push(T&& event)
         {
-            m_buffers[m_current].PushBack(std::move(event));
+            WriteBuffer().PushBack(std::move(event));
         }
 
         /**
@@ -132,7 +152,60 @@ namespace queen
          */
         template <typename... Args> T& Emplace(Args&&... args)
         {
-            return m_buffers[m_current].EmplaceBack(std::forward<Args>(args)...);
+            return WriteBuffer().EmplaceBack(std::forward<Args>(args)...);
+        }
+
+        /**
+         * Stage pushes per thread until EndParallelWrites()
+         *
+         * Must be called while no writer runs.
+         *
+         * @param workerCount Number of Drone workers that may push
+         */
+        void BeginParallelWrites(size_t workerCount)
+        {
+            const size_t slotCount = 1 + workerCount;
+            while (m_staged.Size() < slotCount)
+            {
+                m_staged.EmplaceBack(comb::GetDefaultMemoryResource());
+            }
+            m_parallel = true;
+        }
+
+        /**
+         * Append staged events to the current buffer in slot order
+         *
+         * Must be called once all writers have finished.
+         */
+        void EndParallelWrites()
+        {
+            m_parallel = false;
+
+            size_t stagedCount = 0;
+            for (size_t i = 0; i < m_staged.Size(); ++i)
+            {
+                stagedCount += m_staged[i].Size();
+            }
+            if (stagedCount == 0)
+            {
+                return;
+            }
+
+            wax::Vector<T>& current = m_buffers[m_current];
+            current.Reserve(current.Size() + stagedCount);
+            for (size_t i = 0; i < m_staged.Size(); ++i)
+            {
+                for (size_t j = 0; j < m_staged[i].Size(); ++j)
+                {
+                    current.PushBack(m_staged[i][j]);
+                }
+                m_staged[i].Clear();
+            }
+        }
+
+        [[nodiscard]] bool IsWritingInParallel() const noexcept
+        {
+            return m_parallel;
         }
 
         /**
@@ -144,6 +217,7 @@ namespace queen
          */
         void Swap()
         {
+            hive::Assert(!m_parallel, "EventQueue::Swap() during parallel writes");
             // Flip to the other buffer (which contains old events)
             m_current = 1 - m_current;
             // Clear the new current buffer (was previous, now will be current)
@@ -157,6 +231,10 @@ namespace queen
         {
             m_buffers[0].Clear();
             m_buffers[1].Clear();
+            for (size_t i = 0; i < m_staged.Size(); ++i)
+            {
+                m_staged[i].Clear();
+            }
         }
 
         /**
@@ -281,7 +359,22 @@ namespace queen
         }
 
     private:
+        [[nodiscard]] wax::Vector<T>& WriteBuffer()
+        {
+            if (!m_parallel)
+            {
+                return m_buffers[m_current];
+            }
+
+            const size_t worker = drone::WorkerContext::CurrentWorkerIndex();
+            const size_t slot = worker == drone::WorkerContext::kMainThread ? 0 : worker + 1;
+            hive::Assert(slot < m_staged.Size(), "EventQueue: worker index beyond BeginParallelWrites() count");
+            return m_staged[slot];
+        }
+
         wax::Vector<T> m_buffers[2];
+        wax::Vector<wax::Vector<T>> m_staged;
         uint8_t m_current;
+        bool m_parallel;
     };
 } // namespace queen
@@ -32,7 +32,9 @@ namespace queen
      * - No allocations (just a view over queue)
      *
      * Limitations:
-     * - Not thread-safe (serialize writes externally)
+     * - Concurrent sends are only safe during World::UpdateParallel,
+     *   where each thread stages into its own buffer
+     * - Count() and IsEmpty() ignore events staged by parallel systems
      * - Requires valid queue reference for lifetime
      * - Write-only (cannot read events)
      *
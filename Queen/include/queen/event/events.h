@@ -27,7 +27,9 @@ namespace queen
      * Lifecycle:
      * - Created by World at construction
      * - Queues created lazily on first Writer/Reader access
-     * - SwapBuffers() called at end of each Update()
+     * - SwapBuffers() called at the start of each Update()
+     * - UpdateParallel() wraps the system run in Begin/EndParallelWrites(),
+     *   events sent by parallel systems are merged at its sync point
      * - Destroyed with World
      *
      * Use cases:
@@ -42,16 +44,20 @@ namespace queen
      * │   TypeId(DamageEvent) → QueueEntry { queue, swap_fn, dtor }    │
      * │   TypeId(SpawnEvent)  → QueueEntry { queue, swap_fn, dtor }    │
      * │ entries_: Vector<QueueEntry> (owns all entries)                │
+     * │ parallel_: bool (queues are staging parallel writes)           │
      * └────────────────────────────────────────────────────────────────┘
      *
      * Performance characteristics:
      * - GetQueue: O(1) average (hash map lookup + lazy creation)
      * - SwapBuffers: O(n) where n = number of event types
+     * - EndParallelWrites: O(n * s + e) with s thread slots, e events
      * - First access: O(1) + queue allocation
      *
      * Limitations:
      * - Event types must satisfy Event concept
-     * - Not thread-safe (external synchronization needed)
+     * - Sending is thread-safe only between Begin/EndParallelWrites()
+     * - Queue creation is not thread-safe and asserts during parallel
+     *   writes, create queues (Writer/Reader) before the first parallel update
      * - Queue memory persists until Events destruction
      *
      * Example:
@@ -79,6 +85,7 @@ namespace queen
             : m_allocator{&allocator}
             , m_queues{allocator, 32}
             , m_entries{allocator}
+            , m_parallel{false}
         {
         }
 
@@ -166,6 +173,39 @@ namespace queen
             }
         }
 
+        /**
+         * Stage sends per thread on every queue until EndParallelWrites()
+         *
+         * Called by World::UpdateParallel before running systems.
+         *
+         * @param workerCount Number of Drone workers that may send
+         */
+        void BeginParallelWrites(size_t workerCount)
+        {
+            m_parallel = true;
+            for (size_t i = 0; i < m_entries.Size(); ++i)
+            {
+                m_entries[i].m_beginParallelFn(m_entries[i].m_queue, workerCount);
+            }
+        }
+
+        /**
+         * Merge staged sends into each queue's current buffer
+         *
+         * Slots are appended in order (main thread, then workers by index).
+         * Sends from one system keep their order, but which worker ran a
+         * system varies between frames, so the order across systems is not
+         * deterministic.
+         */
+        void EndParallelWrites()
+        {
+            m_parallel = false;
+            for (size_t i = 0; i < m_entries.Size(); ++i)
+            {
+                m_entries[i].m_endParallelFn(m_entries[i].m_queue);
+            }
+        }
+
         /**
          * Clear all events from all queues
          */
@@ -206,6 +246,8 @@ namespace queen
             void* m_queue;
             void (*m_swapFn)(void*);
             void (*m_clearFn)(void*);
+            void (*m_beginParallelFn)(void*, size_t);
+            void (*m_endParallelFn)(void*);
             void (*m_destructor)(void*);
             TypeId m_typeId;
         };
@@ -219,6 +261,8 @@ namespace queen
                 return *static_cast<EventQueue<T, Allocator>*>(m_entries[*index].m_queue);
             }
 
+            hive::Assert(!m_parallel, "Events: new event queue during parallel writes, create its Writer/Reader first");
+
             void* memory = m_allocator->Allocate(sizeof(EventQueue<T, Allocator>), alignof(EventQueue<T, Allocator>));
             hive::Assert(memory != nullptr, "Failed to allocate EventQueue");
 
@@ -232,6 +276,12 @@ namespace queen
             entry.m_clearFn = [](void* q) {
                 static_cast<EventQueue<T, Allocator>*>(q)->Clear();
             };
+            entry.m_beginParallelFn = [](void* q, size_t workerCount) {
+                static_cast<EventQueue<T, Allocator>*>(q)->BeginParallelWrites(workerCount);
+            };
+            entry.m_endParallelFn = [](void* q) {
+                static_cast<EventQueue<T, Allocator>*>(q)->EndParallelWrites();
+            };
             entry.m_destructor = [](void* q) {
                 static_cast<EventQueue<T, Allocator>*>(q)->~EventQueue();
             };
@@ -247,5 +297,6 @@ namespace queen
         Allocator* m_allocator;
         wax::HashMap<TypeId, size_t> m_queues;
         wax::Vector<QueueEntry> m_entries;
+        bool m_parallel;
     };
 } // namespace queen
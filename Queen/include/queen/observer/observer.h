@@ -2,6 +2,9 @@
 
 #include <comb/allocator_concepts.h>
 
+#include <wax/containers/span.h>
+
+#include <queen/core/dense_id.h>
 #include <queen/core/entity.h>
 #include <queen/observer/observer_event.h>
 
@@ -59,12 +62,27 @@ namespace queen
      */
     using ObserverCallbackFn = void (*)(World& world, Entity entity, const void* component, void* userData);
 
+    /**
+     * Type-erased callback of a deferred observer
+     *
+     * Receives the entities of one batch: triggers queued for the same
+     * observer from the same archetype, in trigger order.
+     */
+    using ObserverBatchFn = void (*)(World& world, wax::Span<const Entity> entities, void* userData);
+
     /**
      * Reactive callback triggered by structural ECS changes
      *
      * Observer is a descriptor that stores all metadata needed to execute
      * an observer callback when a matching structural change occurs.
-     * Observers are invoked synchronously at the point of change.
+     * Observers are invoked synchronously at the point of change, unless
+     * they are deferred (see ObserverBuilder::EachBatch): deferred triggers
+     * are queued by ObserverStorage and dispatched in batches.
+     *
+     * Filters (With<T>) are tested against the archetype's component mask.
+     * The result is cached for the last archetype seen, so a run of
+     * triggers from one archetype evaluates the filters once. Filters on
+     * sparse components fall back to a per-entity lookup.
      *
      * Trigger points:
      * - OnAdd: Called after component is added and initialized
@@ -84,13 +102,16 @@ namespace queen
      * │ enabled_: bool (1 byte)                                        │
      * │ padding (2 bytes)                                              │
      * │ component_id_: TypeId (8 bytes)                                │
+     * │ filter_ids_/filter_dense_ids_: [4] (filter components)         │
+     * │ filter_archetype_: const void* (last archetype filtered)       │
      * │ callback_fn_: function pointer (8 bytes)                       │
+     * │ batch_fn_: function pointer (8 bytes, deferred observers)      │
      * │ user_data_: void* (8 bytes)                                    │
      * │ destructor_fn_: function pointer (8 bytes)                     │
      * │ allocator_: Allocator* (8 bytes)                               │
      * │ name_: char[64] (64 bytes)                                     │
      * └────────────────────────────────────────────────────────────────┘
-     * Total: ~112 bytes
+     * Total: ~200 bytes
      *
      * Performance characteristics:
      * - Trigger: O(1) - direct function call
@@ -99,7 +120,7 @@ namespace queen
      *
      * Limitations:
      * - Observer name limited to 63 characters
-     * - Synchronous execution (blocks structural change)
+     * - Synchronous execution (blocks structural change) unless deferred
      * - Cannot safely spawn/despawn during callback (use Commands)
      * - One component type per observer
      *
@@ -126,8 +147,12 @@ namespace queen
             , m_trigger{trigger}
             , m_enabled{true}
             , m_filterCount{0}
+            , m_sparseFilters{0}
+            , m_filterResult{false}
             , m_componentId{componentId}
+            , m_filterArchetype{nullptr}
             , m_callbackFn{nullptr}
+            , m_batchFn{nullptr}
             , m_userData{nullptr}
             , m_destructorFn{nullptr}
             , m_allocator{&allocator}
@@ -166,14 +191,19 @@ namespace queen
             , m_trigger{other.m_trigger}
             , m_enabled{other.m_enabled}
             , m_filterCount{other.m_filterCount}
+            , m_sparseFilters{other.m_sparseFilters}
+            , m_filterResult{other.m_filterResult}
             , m_componentId{other.m_componentId}
+            , m_filterArchetype{other.m_filterArchetype}
             , m_callbackFn{other.m_callbackFn}
+            , m_batchFn{other.m_batchFn}
             , m_userData{other.m_userData}
             , m_destructorFn{other.m_destructorFn}
             , m_allocator{other.m_allocator}
         {
             std::memcpy(m_name, other.m_name, sizeof(m_name));
             std::memcpy(m_filterIds, other.m_filterIds, sizeof(TypeId) * m_filterCount);
+            std::memcpy(m_filterDenseIds, other.m_filterDenseIds, sizeof(DenseId) * m_filterCount);
             other.m_userData = nullptr;
             other.m_destructorFn = nullptr;
         }
@@ -195,10 +225,15 @@ namespace queen
                 m_trigger = other.m_trigger;
                 m_enabled = other.m_enabled;
                 m_filterCount = other.m_filterCount;
+                m_sparseFilters = other.m_sparseFilters;
+                m_filterResult = other.m_filterResult;
                 m_componentId = other.m_componentId;
+                m_filterArchetype = other.m_filterArchetype;
                 std::memcpy(m_name, other.m_name, sizeof(m_name));
                 std::memcpy(m_filterIds, other.m_filterIds, sizeof(TypeId) * m_filterCount);
+                std::memcpy(m_filterDenseIds, other.m_filterDenseIds, sizeof(DenseId) * m_filterCount);
                 m_callbackFn = other.m_callbackFn;
+                m_batchFn = other.m_batchFn;
                 m_userData = other.m_userData;
                 m_destructorFn = other.m_destructorFn;
                 m_allocator = other.m_allocator;
@@ -244,11 +279,32 @@ namespace queen
             m_enabled = enabled;
         }
 
+        /**
+         * Require a component whose storage is unknown, it may be sparse
+         */
         void AddFilter(TypeId typeId) noexcept
+        {
+            AddFilter(typeId, RegisterDenseId(typeId), true);
+        }
+
+        /**
+         * Require a component
+         *
+         * @param sparse Whether the component may live in a sparse storage,
+         *               outside the archetype mask
+         */
+        void AddFilter(TypeId typeId, DenseId denseId, bool sparse) noexcept
         {
             if (m_filterCount < kMaxFilters)
             {
-                m_filterIds[m_filterCount++] = typeId;
+                m_filterIds[m_filterCount] = typeId;
+                m_filterDenseIds[m_filterCount] = denseId;
+                if (sparse)
+                {
+                    m_sparseFilters = static_cast<uint8_t>(m_sparseFilters | (1u << m_filterCount));
+                }
+                ++m_filterCount;
+                m_filterArchetype = nullptr;
             }
         }
 
@@ -264,6 +320,42 @@ namespace queen
         {
             return m_filterIds[index];
         }
+        [[nodiscard]] DenseId FilterDenseId(uint8_t index) const noexcept
+        {
+            return m_filterDenseIds[index];
+        }
+        [[nodiscard]] bool IsFilterSparse(uint8_t index) const noexcept
+        {
+            return (m_sparseFilters & (1u << index)) != 0;
+        }
+        [[nodiscard]] bool HasSparseFilters() const noexcept
+        {
+            return m_sparseFilters != 0;
+        }
+
+        /**
+         * Cached filter result for an archetype, false if another archetype was filtered last
+         */
+        [[nodiscard]] bool FindCachedFilterResult(const void* archetype, bool& result) const noexcept
+        {
+            if (archetype == nullptr || archetype != m_filterArchetype)
+            {
+                return false;
+            }
+            result = m_filterResult;
+            return true;
+        }
+
+        void CacheFilterResult(const void* archetype, bool result) noexcept
+        {
+            m_filterArchetype = archetype;
+            m_filterResult = result;
+        }
+
+        void ClearFilterCache() noexcept
+        {
+            m_filterArchetype = nullptr;
+        }
 
         void SetCallback(ObserverCallbackFn fn, void* userData, void (*destructor)(void*))
         {
@@ -276,10 +368,25 @@ namespace queen
                 m_allocator->Deallocate(m_userData);
             }
             m_callbackFn = fn;
+            m_batchFn = nullptr;
             m_userData = userData;
             m_destructorFn = destructor;
         }
 
+        /**
+         * Make the observer deferred with a batch callback
+         */
+        void SetBatchCallback(ObserverBatchFn fn, void* userData, void (*destructor)(void*))
+        {
+            SetCallback(nullptr, userData, destructor);
+            m_batchFn = fn;
+        }
+
+        [[nodiscard]] bool IsDeferred() const noexcept
+        {
+            return m_batchFn != nullptr;
+        }
+
         // Execution
 
         /**
@@ -297,9 +404,20 @@ namespace queen
             }
         }
 
+        /**
+         * Invoke the batch callback of a deferred observer
+         */
+        void InvokeBatch(World& world, wax::Span<const Entity> entities) const
+        {
+            if (m_batchFn != nullptr && m_enabled && entities.Size() > 0)
+            {
+                m_batchFn(world, entities, m_userData);
+            }
+        }
+
         [[nodiscard]] bool HasCallback() const noexcept
         {
-            return m_callbackFn != nullptr;
+            return m_callbackFn != nullptr || m_batchFn != nullptr;
         }
 
     private:
@@ -307,9 +425,14 @@ namespace queen
         TriggerType m_trigger;
         bool m_enabled;
         uint8_t m_filterCount;
+        uint8_t m_sparseFilters;
+        bool m_filterResult;
         TypeId m_componentId;
         TypeId m_filterIds[kMaxFilters];
+        DenseId m_filterDenseIds[kMaxFilters];
+        const void* m_filterArchetype;
         ObserverCallbackFn m_callbackFn;
+        ObserverBatchFn m_batchFn;
         void* m_userData;
         void (*m_destructorFn)(void*);
         Allocator* m_allocator;
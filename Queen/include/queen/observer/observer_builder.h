@@ -2,6 +2,10 @@
 
 #include <comb/allocator_concepts.h>
 
+#include <wax/containers/span.h>
+
+#include <queen/core/component_info.h>
+#include <queen/core/dense_id.h>
 #include <queen/core/entity.h>
 #include <queen/observer/observer.h>
 #include <queen/observer/observer_event.h>
@@ -43,7 +47,7 @@ namespace queen
      * Limitations:
      * - One component type per observer
      * - Cannot observe multiple trigger types simultaneously
-     * - Callback executes synchronously (may block)
+     * - Callback executes synchronously (may block), except EachBatch
      *
      * Example:
      * @code
@@ -68,6 +72,12 @@ namespace queen
      *           }
      *       });
      *
+     *   // Deferred observer, called once per archetype with all entities
+     *   world.Observer<OnSet<Transform>>("RebuildBounds")
+     *       .EachBatch([](World& w, wax::Span<const Entity> entities) {
+     *           bounds.Refresh(w, entities);
+     *       });
+     *
      *   // Entity-only observer (no component data)
      *   world.Observer<OnRemove<Health>>("LogDeath")
      *       .EachEntity([](Entity e) {
@@ -100,7 +110,7 @@ namespace queen
          */
         template <typename T> ObserverBuilder& With()
         {
-            m_observer->AddFilter(TypeIdOf<T>());
+            m_observer->AddFilter(TypeIdOf<T>(), DenseIdOf<T>(), detail::DeduceStorage<T>() == StorageType::SPARSE);
             return *this;
         }
 
@@ -208,6 +218,41 @@ namespace queen
             return m_observer->Id();
         }
 
+        /**
+         * Register a deferred callback receiving entities in batches
+         *
+         * Callback signature: void(World& world, wax::Span<const Entity> entities)
+         * Triggers are queued instead of running inside Add/Remove/Set and
+         * dispatched at the end of Update() or by World::FlushObservers(),
+         * one call per archetype the triggering entities were in. Filters
+         * are checked when the trigger is queued. Use this for observers
+         * fired in bulk, such as scene loads or hierarchy rebuilds.
+         *
+         * @tparam F Lambda type
+         * @param func Callback function
+         * @return ObserverId for the registered observer
+         */
+        template <typename F> ObserverId EachBatch(F&& func)
+        {
+            using FuncType = std::decay_t<F>;
+
+            void* userData = m_allocator->Allocate(sizeof(FuncType), alignof(FuncType));
+            new (userData) FuncType{std::forward<F>(func)};
+
+            auto callback = [](World& world, wax::Span<const Entity> entities, void* data) {
+                FuncType* fn = static_cast<FuncType*>(data);
+                (*fn)(world, entities);
+            };
+
+            auto destructor = [](void* data) {
+                FuncType* fn = static_cast<FuncType*>(data);
+                fn->~FuncType();
+            };
+
+            m_observer->SetBatchCallback(callback, userData, destructor);
+            return m_observer->Id();
+        }
+
         /**
          * Get the observer ID (before callback is registered)
          */
@@ -27,6 +27,12 @@ namespace queen
      * 1. Vector of Observer objects (owns all observers)
      * 2. HashMap from ObserverKey to Vector of indices (for fast lookup)
      *
+     * Deferred observers (registered with EachBatch) are not invoked by
+     * Trigger. Their triggers are queued with the entity's archetype and
+     * FlushDeferred() dispatches them grouped by observer, then by
+     * archetype, one callback per group with a span of entities. The
+     * World flushes at the end of every Update and on FlushObservers().
+     *
      * Memory layout:
      * ┌────────────────────────────────────────────────────────────────┐
      * │ allocator_: Allocator* (8 bytes)                               │
@@ -35,18 +41,25 @@ namespace queen
      * │   Key{Add, Health}    → [0, 3]  (indices into observers_)      │
      * │   Key{Remove, Health} → [1]                                    │
      * │   Key{Set, Position}  → [2, 4]                                 │
+     * │ pending_: Vector<PendingTrigger> (deferred triggers)           │
+     * │   { observer index, archetype id, entity, sequence }           │
+     * │ batch_: Vector<Entity> (entities of the group being dispatched)│
      * └────────────────────────────────────────────────────────────────┘
      *
      * Performance characteristics:
      * - Register: O(1) amortized (vector push + hashmap insert)
      * - Lookup by key: O(1) average (hashmap lookup)
-     * - Trigger: O(k) where k = observers matching the key
+     * - Trigger: O(k) where k = observers matching the key, filters
+     *   cost one mask test per filter when the archetype changes
+     * - FlushDeferred: O(p log p) for p pending triggers
      * - GetObserver(id): O(1) array access
      *
      * Limitations:
      * - Observer indices stored as uint32_t (max ~4 billion observers)
      * - Lookup vectors grow with observers per key
      * - No automatic deregistration (observers live until storage destruction)
+     * - Deferred observers only receive entities, the component may have
+     *   changed again or been removed by the time they run
      *
      * Example:
      * @code
@@ -70,6 +83,9 @@ namespace queen
             : m_allocator{&allocator}
             , m_observers{allocator}
             , m_lookup{allocator, 32}
+            , m_pending{allocator}
+            , m_dispatching{allocator}
+            , m_batch{allocator}
         {
         }
 
@@ -187,6 +203,38 @@ namespace queen
                     static_cast<const void*>(component));
         }
 
+        /**
+         * Dispatch the queued triggers of deferred observers
+         *
+         * Triggers queued by the callbacks themselves are dispatched in a
+         * following round, until the queue stays empty.
+         */
+        void FlushDeferred(World& world); // Defined in observer_storage_impl.h
+
+        [[nodiscard]] size_t PendingCount() const noexcept
+        {
+            return m_pending.Size();
+        }
+
+        /**
+         * Drop the queued triggers of deferred observers without dispatching
+         */
+        void DiscardPending() noexcept
+        {
+            m_pending.Clear();
+        }
+
+        /**
+         * Forget the cached filter results, call when archetypes are destroyed
+         */
+        void ClearFilterCaches() noexcept
+        {
+            for (size_t i = 0; i < m_observers.Size(); ++i)
+            {
+                m_observers[i].ClearFilterCache();
+            }
+        }
+
         // State management
 
         /**
@@ -246,6 +294,18 @@ namespace queen
         }
 
     private:
+        struct PendingTrigger
+        {
+            uint32_t m_observer;
+            uint32_t m_sequence;
+            TypeId m_archetype;
+            Entity m_entity;
+        };
+
+        template <typename ArchetypeType>
+        [[nodiscard]] bool PassesFilters(Observer<Allocator>& observer, World& world, Entity entity,
+                                         const ArchetypeType* archetype); // Defined in observer_storage_impl.h
+
         void AddToLookup(ObserverKey key, uint32_t observerIndex)
         {
             auto* indices = m_lookup.Find(key);
@@ -264,5 +324,8 @@ namespace queen
         Allocator* m_allocator;
         wax::Vector<Observer<Allocator>> m_observers;
         wax::HashMap<ObserverKey, wax::Vector<uint32_t>, ObserverKeyHash> m_lookup;
+        wax::Vector<PendingTrigger> m_pending;
+        wax::Vector<PendingTrigger> m_dispatching;
+        wax::Vector<Entity> m_batch;
     };
 } // namespace queen
@@ -3,6 +3,9 @@
 #include <queen/observer/observer_storage.h>
 #include <queen/world/world.h>
 
+#include <algorithm>
+#include <utility>
+
 namespace queen
 {
     template <comb::Allocator Allocator>
@@ -17,31 +20,115 @@ namespace queen
             return;
         }
 
+        const auto* record = world.GetEntityLocations().Get(entity);
+        const auto* archetype = record != nullptr ? record->m_archetype : nullptr;
+
         for (size_t i = 0; i < indices->Size(); ++i)
         {
             uint32_t idx = (*indices)[i];
             if (idx < m_observers.Size())
             {
                 auto& observer = m_observers[idx];
+                if (!observer.IsEnabled())
+                {
+                    continue;
+                }
+
+                if (observer.HasFilters() && !PassesFilters(observer, world, entity, archetype))
+                {
+                    continue;
+                }
 
-                // Check filter components before invoking
-                if (observer.HasFilters())
+                if (observer.IsDeferred())
                 {
-                    bool matches = true;
-                    for (uint8_t f = 0; f < observer.FilterCount(); ++f)
-                    {
-                        if (!world.HasComponent(entity, observer.FilterId(f)))
-                        {
-                            matches = false;
-                            break;
-                        }
-                    }
-                    if (!matches)
-                        continue;
+                    PendingTrigger pending{};
+                    pending.m_observer = idx;
+                    pending.m_sequence = static_cast<uint32_t>(m_pending.Size());
+                    pending.m_archetype = archetype != nullptr ? archetype->GetId() : TypeId{0};
+                    pending.m_entity = entity;
+                    m_pending.PushBack(pending);
+                    continue;
                 }
 
                 observer.Invoke(world, entity, component);
             }
         }
     }
+
+    template <comb::Allocator Allocator>
+    template <typename ArchetypeType>
+    bool ObserverStorage<Allocator>::PassesFilters(Observer<Allocator>& observer, World& world, Entity entity,
+                                                   const ArchetypeType* archetype)
+    {
+        const bool cacheable = !observer.HasSparseFilters();
+        bool matches = true;
+        if (cacheable && observer.FindCachedFilterResult(archetype, matches))
+        {
+            return matches;
+        }
+
+        for (uint8_t f = 0; f < observer.FilterCount(); ++f)
+        {
+            if (archetype != nullptr && archetype->GetSignature().Test(observer.FilterDenseId(f)))
+            {
+                continue;
+            }
+            if (observer.IsFilterSparse(f) && world.HasComponent(entity, observer.FilterId(f)))
+            {
+                continue;
+            }
+            matches = false;
+            break;
+        }
+
+        if (cacheable)
+        {
+            observer.CacheFilterResult(archetype, matches);
+        }
+        return matches;
+    }
+
+    template <comb::Allocator Allocator> void ObserverStorage<Allocator>::FlushDeferred(World& world)
+    {
+        while (!m_pending.IsEmpty())
+        {
+            // Callbacks may queue new triggers, they land in m_pending for the next round
+            std::swap(m_pending, m_dispatching);
+            m_pending.Clear();
+
+            PendingTrigger* begin = m_dispatching.Data();
+            PendingTrigger* end = begin + m_dispatching.Size();
+            std::sort(begin, end, [](const PendingTrigger& a, const PendingTrigger& b) {
+                if (a.m_observer != b.m_observer)
+                {
+                    return a.m_observer < b.m_observer;
+                }
+                if (a.m_archetype != b.m_archetype)
+                {
+                    return a.m_archetype < b.m_archetype;
+                }
+                return a.m_sequence < b.m_sequence;
+            });
+
+            size_t groupBegin = 0;
+            while (groupBegin < m_dispatching.Size())
+            {
+                const PendingTrigger& first = m_dispatching[groupBegin];
+                m_batch.Clear();
+
+                size_t groupEnd = groupBegin;
+                while (groupEnd < m_dispatching.Size() && m_dispatching[groupEnd].m_observer == first.m_observer &&
+                       m_dispatching[groupEnd].m_archetype == first.m_archetype)
+                {
+                    m_batch.PushBack(m_dispatching[groupEnd].m_entity);
+                    ++groupEnd;
+                }
+
+                m_observers[first.m_observer].InvokeBatch(world,
+                                                          wax::Span<const Entity>{m_batch.Data(), m_batch.Size()});
+                groupBegin = groupEnd;
+            }
+            m_dispatching.Clear();
+        }
+    }
 } // namespace queen
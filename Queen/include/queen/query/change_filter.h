@@ -100,7 +100,7 @@ namespace queen
 
         [[nodiscard]] static constexpr Term ToTerm() noexcept
         {
-            return Term{typeId, TermOperator::WITH, access};
+            return Term{typeId, TermOperator::WITH, access, detail::DeduceStorage<T>()};
         }
     };
 
@@ -137,7 +137,7 @@ namespace queen
 
         [[nodiscard]] static constexpr Term ToTerm() noexcept
         {
-            return Term{typeId, TermOperator::WITH, access};
+            return Term{typeId, TermOperator::WITH, access, detail::DeduceStorage<T>()};
         }
     };
 
@@ -167,7 +167,7 @@ namespace queen
 
         [[nodiscard]] static constexpr Term ToTerm() noexcept
         {
-            return Term{typeId, TermOperator::WITH, access};
+            return Term{typeId, TermOperator::WITH, access, detail::DeduceStorage<T>()};
         }
     };
 
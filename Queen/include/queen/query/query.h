@@ -4,17 +4,32 @@
 
 #include <wax/containers/vector.h>
 
+#include <drone/job_submitter.h>
+
+#include <queen/core/component_info.h>
 #include <queen/core/entity.h>
+#include <queen/core/entity_location.h>
 #include <queen/core/tick.h>
 #include <queen/core/type_id.h>
 #include <queen/query/change_filter.h>
+#include <queen/query/query_chunk.h>
 #include <queen/query/query_descriptor.h>
+#include <queen/query/query_state.h>
 #include <queen/query/query_term.h>
 #include <queen/storage/archetype.h>
 #include <queen/storage/component_index.h>
+#include <queen/storage/sparse_storage.h>
+
+#include <algorithm>
+#include <array>
 
 namespace queen
 {
+    /**
+     * Default minimum number of rows handed to one ParEach job
+     */
+    constexpr size_t kDefaultParEachBatchSize = 1024;
+
     namespace detail
     {
         template <typename... Terms> struct FilterDataTerms;
@@ -74,14 +89,11 @@ namespace queen
 
         template <typename... Terms> constexpr bool hasChangeFilterV = HasChangeFilter<Terms...>::value;
 
-        template <typename Archetype, typename ChangeFilterTerm> const ComponentTicks* GetTicksPtr(Archetype* arch)
-        {
-            using ComponentT = typename ChangeFilterTerm::ComponentType;
-            auto* column = arch->template GetColumn<ComponentT>();
-            if (column == nullptr)
-                return nullptr;
-            return column->TicksData();
-        }
+        // Check if a term targets a component declared StorageType::SPARSE
+        template <typename Term>
+        constexpr bool isSparseTermV = DeduceStorage<typename Term::ComponentType>() == StorageType::SPARSE;
+
+        template <typename... Terms> constexpr bool hasSparseTermV = (isSparseTermV<Terms> || ... || false);
 
         template <size_t I, typename TicksTuple, typename... ChangeFilterTerms>
         bool CheckAllFiltersImpl(const TicksTuple& ticksPtrs, size_t row, Tick lastRun,
@@ -109,41 +121,56 @@ namespace queen
             }
         }
 
-        // Check if a row passes all change filters
-        template <typename Allocator, typename Archetype, typename... ChangeFilterTerms>
-        bool PassesChangeFilters(Archetype* arch, size_t row, Tick lastRun, std::tuple<ChangeFilterTerms...>)
+        template <typename Allocator> const ComponentTicks* GetTicksPtr(Column<Allocator>* column, size_t row)
         {
-            if constexpr (sizeof...(ChangeFilterTerms) == 0)
-            {
-                return true;
-            }
-            else
-            {
-                // Get ticks for each change filter component
-                auto ticksPtrs = std::make_tuple(GetTicksPtr<Archetype, ChangeFilterTerms>(arch)...);
+            return column != nullptr ? column->TicksAt(row) : nullptr;
+        }
 
-                // Check all filters
-                return CheckAllFiltersImpl<0>(ticksPtrs, row, lastRun, std::tuple<ChangeFilterTerms...>{});
-            }
+        // Test every change filter against a tick summary (column or block). A miss on any
+        // filter proves no row covered by the summary can pass, since filters are ANDed.
+        template <typename ColumnsTuple, typename SummaryFn, size_t... Is, typename... ChangeFilterTerms>
+        bool SummariesMayMatch(const ColumnsTuple& columns, SummaryFn&& summary, Tick lastRun,
+                               std::index_sequence<Is...>, std::tuple<ChangeFilterTerms...>)
+        {
+            return ((std::get<Is>(columns) != nullptr &&
+                     ChangeFilterTerms::ToChangeFilter().Matches(summary(*std::get<Is>(columns)), lastRun)) &&
+                    ...);
         }
 
-        template <typename Allocator, typename Archetype, typename Term> auto GetColumnPtr(Archetype* arch)
+        // Pointer to the term's component at row, contiguous up to the row's chunk end
+        template <typename Allocator, typename Term> auto GetColumnPtr(Column<Allocator>* column, size_t row)
         {
             using ComponentT = typename Term::ComponentType;
 
             if constexpr (Term::op == TermOperator::Optional)
             {
-                auto* column = arch->template GetColumn<ComponentT>();
                 if (column == nullptr)
                 {
                     return static_cast<ComponentT*>(nullptr);
                 }
-                return column->template Data<ComponentT>();
+                return static_cast<ComponentT*>(column->GetRaw(row));
             }
             else
             {
-                auto* column = arch->template GetColumn<ComponentT>();
-                return column->template Data<ComponentT>();
+                return static_cast<ComponentT*>(column->GetRaw(row));
+            }
+        }
+
+        // Resolve a term's component for one entity, from its archetype column or its sparse storage
+        template <typename Term, typename Allocator>
+        auto FetchComponentPtr(Column<Allocator>* column, SparseStorage<Allocator>* storage, Entity entity, size_t row)
+        {
+            using ComponentT = typename Term::ComponentType;
+
+            if constexpr (isSparseTermV<Term>)
+            {
+                return storage != nullptr ? static_cast<ComponentT*>(storage->Get(entity))
+                                          : static_cast<ComponentT*>(nullptr);
+            }
+            else
+            {
+                return column != nullptr ? static_cast<ComponentT*>(column->GetRaw(row))
+                                         : static_cast<ComponentT*>(nullptr);
             }
         }
 
@@ -176,19 +203,50 @@ namespace queen
      * Provides iteration over all entities that match a query's terms.
      * Components are accessed through the callback in Each().
      *
+     * Matching archetypes and their columns are held in a QueryState. A query
+     * owned by a system registers its state with the World, which keeps it up
+     * to date as archetypes are created, so the query can be reused every frame.
+     * Column slot I is the I-th data term; change filter J uses slot
+     * dataTermCount + J.
+     *
+     * Terms on sparse components (StorageType::SPARSE) are resolved per
+     * entity from the World's SparseStorageRegistry. If the query has dense
+     * required terms, matching archetypes drive iteration and sparse terms
+     * filter rows; otherwise the smallest required sparse storage drives
+     * iteration and each entity's archetype is checked against the dense
+     * terms. Queries without sparse terms take the column-only path.
+     *
      * Memory layout:
      * ┌──────────────────────────────────────────────────────────────┐
-     * │ archetypes_: Vector<Archetype*> (matching archetypes)        │
-     * │ descriptor_: QueryDescriptor (term definitions)              │
+     * │ state_: QueryState (descriptor, archetypes, column cache)    │
+     * │ last_run_tick_: Tick (change detection baseline)             │
      * └──────────────────────────────────────────────────────────────┘
      *
      * Performance characteristics:
+     * - Construction: O(candidates * terms) via ComponentIndex
      * - Each: O(n) where n = total matching entities across archetypes
+     * - Per-archetype setup: O(terms), no column hash lookups
      * - Iteration is cache-friendly within each archetype
+     * - Added/Changed filters skip archetypes and 64-row blocks whose
+     *   column tick summaries are older than last_run_tick
+     * - Chunked tables are walked one chunk at a time
+     * - EachChunk: one callback per contiguous run, with a span per term
+     * - EntityCount: O(archetypes) for dense queries; with a required
+     *   sparse term, O(smallest required sparse set), otherwise O(rows)
+     *
+     * ParEach splits the matched rows into row ranges of at least
+     * minBatchSize rows (never spanning two archetypes, and rounded to whole
+     * chunks for chunked tables) and runs them through
+     * drone::JobSubmitter::ParallelFor. The callback is invoked concurrently
+     * and must only touch the components it is given. Ranges are described
+     * in a fixed stack buffer, so ParEach does not allocate.
      *
      * Limitations:
      * - Not thread-safe
      * - Cannot modify component set while iterating
+     * - ParEach blocks the caller until every range has run
+     * - Queries with sparse terms need the sparse registry and entity
+     *   locations, and ParEach runs them sequentially
      *
      * Example:
      * @code
@@ -197,6 +255,10 @@ namespace queen
      *   query.Each([](const Position& pos, Velocity& vel) {
      *       vel.dx += pos.x * 0.1f;
      *   });
+     *
+     *   query.ParEach(jobs, [](const Position& pos, Velocity& vel) {
+     *       vel.dx += pos.x * 0.1f;
+     *   }, 4096);
      * @endcode
      */
     template <comb::Allocator Allocator, typename... Terms> class Query
@@ -206,18 +268,29 @@ namespace queen
         static constexpr size_t dataTermCount = detail::TupleSize<DataTerms>::value;
         static constexpr size_t changeFilterCount = detail::TupleSize<ChangeFilterTerms>::value;
         static constexpr bool hasChangeFilters = detail::hasChangeFilterV<Terms...>;
+        static constexpr bool hasSparseTerms = detail::hasSparseTermV<Terms...>;
+        static constexpr size_t slotCount = dataTermCount + changeFilterCount;
 
     public:
-        Query(Allocator& allocator, const ComponentIndex<Allocator>& index)
-            : m_allocator{&allocator}
-            , m_archetypes{allocator}
-            , m_descriptor{allocator}
+        using EntityLocations = EntityLocationMap<Allocator, Archetype<Allocator>>;
+
+        Query(Allocator& allocator, const ComponentIndex<Allocator>& index,
+              SparseStorageRegistry<Allocator>* sparse = nullptr, const EntityLocations* locations = nullptr)
+            : m_state{allocator}
+            , m_sparse{sparse}
+            , m_locations{locations}
             , m_lastRunTick{0}
         {
-            (m_descriptor.template AddTerm<Terms>(), ...);
-            m_descriptor.Finalize();
+            hive::Assert(!hasSparseTerms || (sparse != nullptr && locations != nullptr),
+                         "Query on sparse components requires the sparse registry and entity locations");
+
+            (m_state.Descriptor().template AddTerm<Terms>(), ...);
+            m_state.Descriptor().Finalize();
+
+            AddSlots(DataTerms{});
+            AddSlots(ChangeFilterTerms{});
 
-            m_archetypes = m_descriptor.FindMatchingArchetypes(index);
+            m_state.MatchAll(index);
         }
 
         ~Query() = default;
@@ -245,33 +318,189 @@ namespace queen
 
         template <typename Func> void Each(Func&& func)
         {
-            for (size_t a = 0; a < m_archetypes.Size(); ++a)
+            if constexpr (hasSparseTerms)
             {
-                Archetype<Allocator>* arch = m_archetypes[a];
-                EachInArchetype(arch, std::forward<Func>(func), DataTerms{}, ChangeFilterTerms{});
+                EachSparse<false>(func);
+                return;
+            }
+
+            for (size_t a = 0; a < m_state.ArchetypeCount(); ++a)
+            {
+                EachInArchetype(a, 0, m_state.GetArchetype(a)->EntityCount(), std::forward<Func>(func), DataTerms{},
+                                ChangeFilterTerms{});
+            }
+        }
+
+        /**
+         * Iterate matching entities in parallel row ranges
+         *
+         * Falls back to Each() when jobs is invalid or the work fits in a
+         * single batch.
+         *
+         * @param jobs Drone job submitter running the ranges
+         * @param func Callback, invoked concurrently from worker threads
+         * @param minBatchSize Minimum rows per job (small archetypes may yield less)
+         */
+        template <typename Func>
+        void ParEach(drone::JobSubmitter jobs, Func&& func, size_t minBatchSize = kDefaultParEachBatchSize)
+        {
+            if constexpr (hasSparseTerms)
+            {
+                Each(std::forward<Func>(func));
+                return;
+            }
+
+            const size_t total = EntityCount();
+            if (minBatchSize == 0)
+            {
+                minBatchSize = 1;
+            }
+
+            if (!jobs.IsValid() || total <= minBatchSize)
+            {
+                Each(std::forward<Func>(func));
+                return;
+            }
+
+            // Aim for a few ranges per thread so uneven ranges still balance
+            const size_t targetRanges = (jobs.WorkerCount() + 1) * 4;
+            size_t batchSize = (total + targetRanges - 1) / targetRanges;
+            if (batchSize < minBatchSize)
+            {
+                batchSize = minBatchSize;
+            }
+
+            ParContext<std::remove_reference_t<Func>> ctx{this, &func, {}, 0};
+
+            for (size_t a = 0; a < m_state.ArchetypeCount(); ++a)
+            {
+                const Archetype<Allocator>* archetype = m_state.GetArchetype(a);
+                const size_t count = archetype->EntityCount();
+
+                // Chunks are the natural work unit, never split one between two jobs
+                size_t archetypeBatch = batchSize;
+                if (const size_t chunkRows = archetype->GetTable().ChunkRows(); chunkRows != 0)
+                {
+                    archetypeBatch = (batchSize + chunkRows - 1) / chunkRows * chunkRows;
+                }
+
+                for (size_t begin = 0; begin < count; begin += archetypeBatch)
+                {
+                    if (ctx.m_rangeCount == kMaxParRanges)
+                    {
+                        DispatchRanges(jobs, ctx);
+                    }
+
+                    const size_t end = (begin + archetypeBatch < count) ? begin + archetypeBatch : count;
+                    ctx.m_ranges[ctx.m_rangeCount++] = ParRange{a, begin, end};
+                }
+            }
+
+            DispatchRanges(jobs, ctx);
+        }
+
+        /**
+         * Iterate matching rows as contiguous chunks
+         *
+         * Calls func(const QueryChunk<Allocator>&, spans...) with one
+         * wax::Span per data term: Span<const T> for read access, Span<T>
+         * for write access, and an empty span for an absent optional term.
+         * Contiguous tables yield one chunk per archetype, chunked tables one
+         * per table chunk.
+         *
+         * With change filters only 64-row blocks whose tick summaries may
+         * match are passed, coalesced into runs. Rows inside a run are not
+         * filtered individually: use QueryChunk::Ticks<T>() to test them.
+         *
+         * @code
+         *   query.EachChunk([](const auto& chunk, wax::Span<const Velocity> vel, wax::Span<Position> pos) {
+         *       for (size_t i = 0; i < chunk.Size(); ++i) {
+         *           pos[i].x += vel[i].dx;
+         *       }
+         *   });
+         * @endcode
+         */
+        template <typename Func> void EachChunk(Func&& func)
+        {
+            static_assert(!hasSparseTerms, "EachChunk does not support sparse terms");
+
+            for (size_t a = 0; a < m_state.ArchetypeCount(); ++a)
+            {
+                EachChunkInArchetype(a, func, DataTerms{}, ChangeFilterTerms{});
             }
         }
 
         template <typename Func> void EachWithEntity(Func&& func)
         {
-            for (size_t a = 0; a < m_archetypes.Size(); ++a)
+            if constexpr (hasSparseTerms)
+            {
+                EachSparse<true>(func);
+                return;
+            }
+
+            for (size_t a = 0; a < m_state.ArchetypeCount(); ++a)
+            {
+                EachInArchetypeWithEntity(a, 0, m_state.GetArchetype(a)->EntityCount(), std::forward<Func>(func),
+                                          DataTerms{}, ChangeFilterTerms{});
+            }
+        }
+
+        /**
+         * Iterate count matching rows starting at row first
+         *
+         * Rows are numbered across the matched archetypes in match order.
+         * The range wraps past the last row and is clamped to one full
+         * pass. New archetypes are appended to the match list, so row
+         * numbers of existing archetypes stay put when one is created.
+         * Queries with sparse terms iterate every match.
+         */
+        template <typename Func> void EachInRows(size_t first, size_t count, Func&& func)
+        {
+            if constexpr (hasSparseTerms)
             {
-                Archetype<Allocator>* arch = m_archetypes[a];
-                EachInArchetypeWithEntity(arch, std::forward<Func>(func), DataTerms{}, ChangeFilterTerms{});
+                Each(std::forward<Func>(func));
+            }
+            else
+            {
+                ForEachRowRange(first, count, [this, &func](size_t archetypeIndex, size_t begin, size_t end) {
+                    EachInArchetype(archetypeIndex, begin, end, func, DataTerms{}, ChangeFilterTerms{});
+                });
+            }
+        }
+
+        /**
+         * EachInRows() passing the Entity first, like EachWithEntity()
+         */
+        template <typename Func> void EachWithEntityInRows(size_t first, size_t count, Func&& func)
+        {
+            if constexpr (hasSparseTerms)
+            {
+                EachWithEntity(std::forward<Func>(func));
+            }
+            else
+            {
+                ForEachRowRange(first, count, [this, &func](size_t archetypeIndex, size_t begin, size_t end) {
+                    EachInArchetypeWithEntity(archetypeIndex, begin, end, func, DataTerms{}, ChangeFilterTerms{});
+                });
             }
         }
 
         [[nodiscard]] size_t ArchetypeCount() const noexcept
         {
-            return m_archetypes.Size();
+            return m_state.ArchetypeCount();
         }
 
         [[nodiscard]] size_t EntityCount() const noexcept
         {
+            if constexpr (hasSparseTerms)
+            {
+                return CountSparse();
+            }
+
             size_t count = 0;
-            for (size_t i = 0; i < m_archetypes.Size(); ++i)
+            for (size_t i = 0; i < m_state.ArchetypeCount(); ++i)
             {
-                count += m_archetypes[i]->EntityCount();
+                count += m_state.GetArchetype(i)->EntityCount();
             }
             return count;
         }
@@ -281,77 +510,371 @@ namespace queen
             return EntityCount() == 0;
         }
 
+        /**
+         * Check whether an input component of a matched archetype changed
+         *
+         * Inputs are the Read/Maybe data terms and the change filter terms,
+         * Write terms are treated as the query's outputs. Only the per-column
+         * tick summaries are read, no row is visited. A change stamped with
+         * the since tick itself counts, so writes made later in that tick
+         * are not missed. Queries with sparse terms or without inputs always
+         * report a change.
+         */
+        [[nodiscard]] bool ChangedSince([[maybe_unused]] Tick since) const noexcept
+        {
+            if constexpr (hasSparseTerms || InputSlotCount(DataTerms{}) == 0)
+            {
+                return true;
+            }
+            else
+            {
+                if (DataInputsChangedSince(since, DataTerms{}, std::make_index_sequence<dataTermCount>{}))
+                {
+                    return true;
+                }
+                for (size_t slot = dataTermCount; slot < slotCount; ++slot)
+                {
+                    if (m_state.SlotChangedSince(slot, since))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+        }
+
+        [[nodiscard]] QueryState<Allocator>& GetState() noexcept
+        {
+            return m_state;
+        }
+
+        [[nodiscard]] const QueryState<Allocator>& GetState() const noexcept
+        {
+            return m_state;
+        }
+
     private:
-        template <typename Func, typename... DataTermTypes, typename... ChangeFilterTypes>
-        void EachInArchetype(Archetype<Allocator>* arch, Func&& func, std::tuple<DataTermTypes...>,
-                             std::tuple<ChangeFilterTypes...>)
+        static constexpr size_t kMaxParRanges = 256;
+
+        struct ParRange
         {
-            size_t count = arch->EntityCount();
-            if (count == 0)
+            size_t m_archetypeIndex;
+            size_t m_begin;
+            size_t m_end;
+        };
+
+        template <typename FuncT> struct ParContext
+        {
+            Query* m_query;
+            FuncT* m_func;
+            ParRange m_ranges[kMaxParRanges];
+            size_t m_rangeCount;
+        };
+
+        template <typename FuncT> static void DispatchRanges(drone::JobSubmitter& jobs, ParContext<FuncT>& ctx)
+        {
+            if (ctx.m_rangeCount == 0)
+            {
+                return;
+            }
+
+            jobs.ParallelFor(
+                0, ctx.m_rangeCount,
+                [](size_t index, void* data) {
+                    auto* c = static_cast<ParContext<FuncT>*>(data);
+                    const ParRange& range = c->m_ranges[index];
+                    c->m_query->EachInArchetype(range.m_archetypeIndex, range.m_begin, range.m_end, *c->m_func,
+                                                DataTerms{}, ChangeFilterTerms{});
+                },
+                &ctx, 1);
+
+            ctx.m_rangeCount = 0;
+        }
+
+        template <typename... SlotTerms> void AddSlots(std::tuple<SlotTerms...>)
+        {
+            (m_state.AddSlot(TypeIdOf<typename SlotTerms::ComponentType>()), ...);
+        }
+
+        // Split rows [first, first + count) (wrapping) into per-archetype row ranges
+        template <typename RangeFn> void ForEachRowRange(size_t first, size_t count, RangeFn&& fn)
+        {
+            const size_t total = EntityCount();
+            if (total == 0 || count == 0)
+            {
                 return;
+            }
+
+            first %= total;
+            count = count < total ? count : total;
 
-            auto columns =
-                std::make_tuple(detail::GetColumnPtr<Allocator, Archetype<Allocator>, DataTermTypes>(arch)...);
+            const size_t firstEnd = first + count < total ? first + count : total;
+            const size_t wrapped = first + count - firstEnd;
 
-            if constexpr (sizeof...(ChangeFilterTypes) == 0)
+            size_t base = 0;
+            for (size_t a = 0; a < m_state.ArchetypeCount(); ++a)
             {
-                // No change filters - iterate all
-                for (size_t row = 0; row < count; ++row)
+                const size_t rows = m_state.GetArchetype(a)->EntityCount();
+                const size_t end = base + rows;
+
+                // [0, wrapped) comes before [first, firstEnd) in row order
+                if (wrapped > base)
                 {
-                    InvokeCallback(func, columns, row, std::make_index_sequence<sizeof...(DataTermTypes)>{},
-                                   std::tuple<DataTermTypes...>{});
+                    fn(a, 0, (wrapped < end ? wrapped : end) - base);
                 }
+                if (firstEnd > base && first < end)
+                {
+                    fn(a, (first > base ? first : base) - base, (firstEnd < end ? firstEnd : end) - base);
+                }
+
+                base = end;
             }
-            else
+        }
+
+        template <typename... DataTermTypes>
+        static constexpr size_t InputSlotCount(std::tuple<DataTermTypes...>) noexcept
+        {
+            return changeFilterCount + (size_t{0} + ... + (DataTermTypes::access != TermAccess::WRITE ? 1 : 0));
+        }
+
+        template <typename... DataTermTypes, size_t... Is>
+        bool DataInputsChangedSince(Tick since, std::tuple<DataTermTypes...>, std::index_sequence<Is...>) const noexcept
+        {
+            return (((DataTermTypes::access != TermAccess::WRITE) && m_state.SlotChangedSince(Is, since)) || ...);
+        }
+
+        template <typename... DataTermTypes, size_t... Is>
+        auto GetColumns(size_t archetypeIndex, size_t row, std::tuple<DataTermTypes...>, std::index_sequence<Is...>)
+        {
+            return std::make_tuple(
+                detail::GetColumnPtr<Allocator, DataTermTypes>(m_state.GetColumn(archetypeIndex, Is), row)...);
+        }
+
+        template <size_t... Js> auto GetTicks(size_t archetypeIndex, size_t row, std::index_sequence<Js...>)
+        {
+            return std::make_tuple(
+                detail::GetTicksPtr<Allocator>(m_state.GetColumn(archetypeIndex, dataTermCount + Js), row)...);
+        }
+
+        template <size_t... Js> auto GetFilterColumns(size_t archetypeIndex, std::index_sequence<Js...>)
+        {
+            return std::make_tuple(
+                static_cast<const Column<Allocator>*>(m_state.GetColumn(archetypeIndex, dataTermCount + Js))...);
+        }
+
+        /**
+         * Call rowFn for every row in [begin, end) passing all change filters
+         *
+         * Skips the archetype when a filter column's MaxTicks() cannot match,
+         * and skips 64-row blocks whose BlockTicks() cannot match, so only
+         * dirty blocks pay the per-row tick test. [begin, end) must lie
+         * within one table chunk.
+         */
+        template <typename RowFn, typename... ChangeFilterTypes>
+        void ForEachFilteredRow(size_t archetypeIndex, size_t begin, size_t end, RowFn&& rowFn,
+                                std::tuple<ChangeFilterTypes...>)
+        {
+            using FilterSeq = std::make_index_sequence<sizeof...(ChangeFilterTypes)>;
+
+            auto filterColumns = GetFilterColumns(archetypeIndex, FilterSeq{});
+            if (!detail::SummariesMayMatch(
+                    filterColumns, [](const Column<Allocator>& c) -> const ComponentTicks& { return c.MaxTicks(); },
+                    m_lastRunTick, FilterSeq{}, std::tuple<ChangeFilterTypes...>{}))
+            {
+                return;
+            }
+
+            auto ticks = GetTicks(archetypeIndex, begin, FilterSeq{});
+            ForEachDirtyRun(
+                filterColumns, begin, end,
+                [&](size_t runBegin, size_t runEnd) {
+                    for (size_t row = runBegin; row < runEnd; ++row)
+                    {
+                        if (detail::CheckAllFiltersImpl<0>(ticks, row - begin, m_lastRunTick,
+                                                           std::tuple<ChangeFilterTypes...>{}))
+                        {
+                            rowFn(row);
+                        }
+                    }
+                },
+                std::tuple<ChangeFilterTypes...>{});
+        }
+
+        // Call runFn(runBegin, runEnd) for each maximal run of blocks in [begin, end) whose summaries may match
+        template <typename FilterColumns, typename RunFn, typename... ChangeFilterTypes>
+        void ForEachDirtyRun(const FilterColumns& filterColumns, size_t begin, size_t end, RunFn&& runFn,
+                             std::tuple<ChangeFilterTypes...>)
+        {
+            using FilterSeq = std::make_index_sequence<sizeof...(ChangeFilterTypes)>;
+            constexpr size_t blockShift = Column<Allocator>::kTickBlockShift;
+
+            size_t runBegin = begin;
+            size_t row = begin;
+            while (row < end)
             {
-                // Has change filters - check each row
-                for (size_t row = 0; row < count; ++row)
+                const size_t block = row >> blockShift;
+                const size_t blockEnd = std::min(end, (block + 1) << blockShift);
+
+                const bool dirty = detail::SummariesMayMatch(
+                    filterColumns,
+                    [block](const Column<Allocator>& c) -> const ComponentTicks& { return c.BlockTicks(block); },
+                    m_lastRunTick, FilterSeq{}, std::tuple<ChangeFilterTypes...>{});
+
+                if (!dirty)
                 {
-                    if (detail::PassesChangeFilters<Allocator, Archetype<Allocator>>(
-                            arch, row, m_lastRunTick, std::tuple<ChangeFilterTypes...>{}))
+                    if (runBegin < row)
                     {
-                        InvokeCallback(func, columns, row, std::make_index_sequence<sizeof...(DataTermTypes)>{},
-                                       std::tuple<DataTermTypes...>{});
+                        runFn(runBegin, row);
                     }
+                    runBegin = blockEnd;
                 }
+                row = blockEnd;
+            }
+
+            if (runBegin < end)
+            {
+                runFn(runBegin, end);
             }
         }
 
         template <typename Func, typename... DataTermTypes, typename... ChangeFilterTypes>
-        void EachInArchetypeWithEntity(Archetype<Allocator>* arch, Func&& func, std::tuple<DataTermTypes...>,
-                                       std::tuple<ChangeFilterTypes...>)
+        void EachChunkInArchetype(size_t archetypeIndex, Func& func, std::tuple<DataTermTypes...>,
+                                  std::tuple<ChangeFilterTypes...>)
         {
-            size_t count = arch->EntityCount();
+            using FilterSeq = std::make_index_sequence<sizeof...(ChangeFilterTypes)>;
+
+            Archetype<Allocator>* arch = m_state.GetArchetype(archetypeIndex);
+            const size_t count = arch->EntityCount();
             if (count == 0)
                 return;
 
-            const Entity* entities = arch->GetEntities();
-            auto columns =
-                std::make_tuple(detail::GetColumnPtr<Allocator, Archetype<Allocator>, DataTermTypes>(arch)...);
+            if constexpr (sizeof...(ChangeFilterTypes) > 0)
+            {
+                if (!detail::SummariesMayMatch(
+                        GetFilterColumns(archetypeIndex, FilterSeq{}),
+                        [](const Column<Allocator>& c) -> const ComponentTicks& { return c.MaxTicks(); },
+                        m_lastRunTick, FilterSeq{}, std::tuple<ChangeFilterTypes...>{}))
+                {
+                    return;
+                }
+            }
+
+            auto invoke = [&](size_t begin, size_t end) {
+                const QueryChunk<Allocator> chunk{arch, begin, end - begin};
+                InvokeChunk(func, chunk, archetypeIndex, std::make_index_sequence<sizeof...(DataTermTypes)>{},
+                            std::tuple<DataTermTypes...>{});
+            };
 
-            if constexpr (sizeof...(ChangeFilterTypes) == 0)
+            const Table<Allocator>& table = arch->GetTable();
+            for (size_t segment = 0; segment < count;)
             {
-                // No change filters - iterate all
-                for (size_t row = 0; row < count; ++row)
+                const size_t segmentEnd = std::min(count, table.ChunkEnd(segment));
+
+                if constexpr (sizeof...(ChangeFilterTypes) == 0)
                 {
-                    InvokeCallbackWithEntity(func, entities[row], columns, row,
-                                             std::make_index_sequence<sizeof...(DataTermTypes)>{},
-                                             std::tuple<DataTermTypes...>{});
+                    invoke(segment, segmentEnd);
                 }
+                else
+                {
+                    ForEachDirtyRun(GetFilterColumns(archetypeIndex, FilterSeq{}), segment, segmentEnd, invoke,
+                                    std::tuple<ChangeFilterTypes...>{});
+                }
+
+                segment = segmentEnd;
             }
-            else
+        }
+
+        template <typename Func, size_t... Is, typename... DataTermTypes>
+        void InvokeChunk(Func& func, const QueryChunk<Allocator>& chunk, size_t archetypeIndex,
+                         std::index_sequence<Is...>, std::tuple<DataTermTypes...>)
+        {
+            func(chunk, detail::MakeChunkSpan<DataTermTypes>(m_state.GetColumn(archetypeIndex, Is), chunk.Begin(),
+                                                             chunk.Size())...);
+        }
+
+        template <typename Func, typename... DataTermTypes, typename... ChangeFilterTypes>
+        void EachInArchetype(size_t archetypeIndex, size_t begin, size_t end, Func&& func,
+                             std::tuple<DataTermTypes...>, std::tuple<ChangeFilterTypes...>)
+        {
+            if (begin >= end)
+                return;
+
+            const Table<Allocator>& table = m_state.GetArchetype(archetypeIndex)->GetTable();
+
+            // Column pointers are rebased per chunk, contiguous tables form a single segment
+            for (size_t segment = begin; segment < end;)
+            {
+                const size_t segmentEnd = std::min(end, table.ChunkEnd(segment));
+                auto columns = GetColumns(archetypeIndex, segment, std::tuple<DataTermTypes...>{},
+                                          std::make_index_sequence<sizeof...(DataTermTypes)>{});
+
+                if constexpr (sizeof...(ChangeFilterTypes) == 0)
+                {
+                    // No change filters - iterate all
+                    for (size_t row = 0; row < segmentEnd - segment; ++row)
+                    {
+                        InvokeCallback(func, columns, row, std::make_index_sequence<sizeof...(DataTermTypes)>{},
+                                       std::tuple<DataTermTypes...>{});
+                    }
+                }
+                else
+                {
+                    // Has change filters - skip clean blocks, check rows in dirty ones
+                    ForEachFilteredRow(
+                        archetypeIndex, segment, segmentEnd,
+                        [&](size_t row) {
+                            InvokeCallback(func, columns, row - segment,
+                                           std::make_index_sequence<sizeof...(DataTermTypes)>{},
+                                           std::tuple<DataTermTypes...>{});
+                        },
+                        std::tuple<ChangeFilterTypes...>{});
+                }
+
+                segment = segmentEnd;
+            }
+        }
+
+        template <typename Func, typename... DataTermTypes, typename... ChangeFilterTypes>
+        void EachInArchetypeWithEntity(size_t archetypeIndex, size_t begin, size_t end, Func&& func,
+                                       std::tuple<DataTermTypes...>, std::tuple<ChangeFilterTypes...>)
+        {
+            if (begin >= end)
+                return;
+
+            Archetype<Allocator>* arch = m_state.GetArchetype(archetypeIndex);
+            const Entity* entities = arch->GetEntities();
+            const Table<Allocator>& table = arch->GetTable();
+
+            for (size_t segment = begin; segment < end;)
             {
-                // Has change filters - check each row
-                for (size_t row = 0; row < count; ++row)
+                const size_t segmentEnd = std::min(end, table.ChunkEnd(segment));
+                auto columns = GetColumns(archetypeIndex, segment, std::tuple<DataTermTypes...>{},
+                                          std::make_index_sequence<sizeof...(DataTermTypes)>{});
+
+                if constexpr (sizeof...(ChangeFilterTypes) == 0)
                 {
-                    if (detail::PassesChangeFilters<Allocator, Archetype<Allocator>>(
-                            arch, row, m_lastRunTick, std::tuple<ChangeFilterTypes...>{}))
+                    // No change filters - iterate all
+                    for (size_t row = segment; row < segmentEnd; ++row)
                     {
-                        InvokeCallbackWithEntity(func, entities[row], columns, row,
+                        InvokeCallbackWithEntity(func, entities[row], columns, row - segment,
                                                  std::make_index_sequence<sizeof...(DataTermTypes)>{},
                                                  std::tuple<DataTermTypes...>{});
                     }
                 }
+                else
+                {
+                    // Has change filters - skip clean blocks, check rows in dirty ones
+                    ForEachFilteredRow(
+                        archetypeIndex, segment, segmentEnd,
+                        [&](size_t row) {
+                            InvokeCallbackWithEntity(func, entities[row], columns, row - segment,
+                                                     std::make_index_sequence<sizeof...(DataTermTypes)>{},
+                                                     std::tuple<DataTermTypes...>{});
+                        },
+                        std::tuple<ChangeFilterTypes...>{});
+                }
+
+                segment = segmentEnd;
             }
         }
 
@@ -369,9 +892,324 @@ namespace queen
             func(entity, detail::GetComponentRef<DataTermTypes>(std::get<Is>(columns), row)...);
         }
 
-        Allocator* m_allocator;
-        wax::Vector<Archetype<Allocator>*> m_archetypes;
-        QueryDescriptor<Allocator> m_descriptor;
+        struct SparseRefs
+        {
+            std::array<SparseStorage<Allocator>*, slotCount> m_slots{};
+            std::array<SparseStorage<Allocator>*, sizeof...(Terms)> m_required{};
+            std::array<SparseStorage<Allocator>*, sizeof...(Terms)> m_excluded{};
+            size_t m_requiredCount{0};
+            size_t m_excludedCount{0};
+        };
+
+        // Returns false when a required sparse storage does not exist yet (nothing can match)
+        bool ResolveSparse(SparseRefs& refs) const
+        {
+            const QueryDescriptor<Allocator>& desc = m_state.Descriptor();
+
+            for (size_t i = 0; i < desc.GetSparseRequired().Size(); ++i)
+            {
+                SparseStorage<Allocator>* storage = m_sparse->Find(desc.GetSparseRequired()[i]);
+                if (storage == nullptr)
+                {
+                    return false;
+                }
+                refs.m_required[refs.m_requiredCount++] = storage;
+            }
+
+            for (size_t i = 0; i < desc.GetSparseExcluded().Size(); ++i)
+            {
+                SparseStorage<Allocator>* storage = m_sparse->Find(desc.GetSparseExcluded()[i]);
+                if (storage != nullptr)
+                {
+                    refs.m_excluded[refs.m_excludedCount++] = storage;
+                }
+            }
+
+            for (size_t s = 0; s < slotCount; ++s)
+            {
+                refs.m_slots[s] = m_sparse->Find(m_state.GetSlotType(s));
+            }
+
+            return true;
+        }
+
+        static bool PassesSparseTerms(const SparseRefs& refs, Entity entity)
+        {
+            for (size_t i = 0; i < refs.m_requiredCount; ++i)
+            {
+                if (!refs.m_required[i]->Contains(entity))
+                {
+                    return false;
+                }
+            }
+
+            for (size_t i = 0; i < refs.m_excludedCount; ++i)
+            {
+                if (refs.m_excluded[i]->Contains(entity))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template <typename FilterTerm>
+        bool PassesChangeFilterAt(Column<Allocator>* column, SparseStorage<Allocator>* storage, Entity entity,
+                                  size_t row) const
+        {
+            const ComponentTicks* ticks = nullptr;
+            if constexpr (detail::isSparseTermV<FilterTerm>)
+            {
+                ticks = storage != nullptr ? storage->GetTicks(entity) : nullptr;
+            }
+            else
+            {
+                ticks = column != nullptr ? &column->GetTicks(row) : nullptr;
+            }
+
+            return ticks != nullptr && FilterTerm::ToChangeFilter().Matches(*ticks, m_lastRunTick);
+        }
+
+        template <size_t... Js, typename... ChangeFilterTypes>
+        bool PassesChangeFiltersAt(const std::array<Column<Allocator>*, slotCount>& columns, const SparseRefs& refs,
+                                   [[maybe_unused]] Entity entity, [[maybe_unused]] size_t row,
+                                   std::index_sequence<Js...>, std::tuple<ChangeFilterTypes...>) const
+        {
+            return (PassesChangeFilterAt<ChangeFilterTypes>(columns[dataTermCount + Js],
+                                                            refs.m_slots[dataTermCount + Js], entity, row) &&
+                    ... && true);
+        }
+
+        template <bool WithEntity, typename Func, size_t... Is, typename... DataTermTypes>
+        void InvokeSparseRow(Func& func, const std::array<Column<Allocator>*, slotCount>& columns,
+                             const SparseRefs& refs, Entity entity, size_t row, std::index_sequence<Is...>,
+                             std::tuple<DataTermTypes...>)
+        {
+            if constexpr (WithEntity)
+            {
+                func(entity, detail::GetComponentRef<DataTermTypes>(
+                                 detail::FetchComponentPtr<DataTermTypes>(columns[Is], refs.m_slots[Is], entity, row),
+                                 0)...);
+            }
+            else
+            {
+                func(detail::GetComponentRef<DataTermTypes>(
+                    detail::FetchComponentPtr<DataTermTypes>(columns[Is], refs.m_slots[Is], entity, row), 0)...);
+            }
+        }
+
+        template <bool WithEntity, typename Func>
+        void VisitSparseRow(Func& func, const std::array<Column<Allocator>*, slotCount>& columns,
+                            const SparseRefs& refs, Entity entity, size_t row)
+        {
+            if (!PassesSparseTerms(refs, entity))
+            {
+                return;
+            }
+
+            if (!PassesChangeFiltersAt(columns, refs, entity, row, std::make_index_sequence<changeFilterCount>{},
+                                       ChangeFilterTerms{}))
+            {
+                return;
+            }
+
+            InvokeSparseRow<WithEntity>(func, columns, refs, entity, row, std::make_index_sequence<dataTermCount>{},
+                                        DataTerms{});
+        }
+
+        // Sparse change filters whose whole storage is older than lastRun cannot match any entity
+        template <size_t... Js, typename... ChangeFilterTypes>
+        bool SparseFiltersMayMatch(const SparseRefs& refs, std::index_sequence<Js...>,
+                                   std::tuple<ChangeFilterTypes...>) const
+        {
+            return (SparseFilterMayMatch<ChangeFilterTypes>(refs.m_slots[dataTermCount + Js]) && ... && true);
+        }
+
+        template <typename FilterTerm> bool SparseFilterMayMatch(const SparseStorage<Allocator>* storage) const
+        {
+            if constexpr (detail::isSparseTermV<FilterTerm>)
+            {
+                return storage != nullptr &&
+                       FilterTerm::ToChangeFilter().Matches(storage->GetColumn().MaxTicks(), m_lastRunTick);
+            }
+            else
+            {
+                return true;
+            }
+        }
+
+        // Counts sparse matches without fetching components. With a required sparse term the smallest
+        // storage drives the count, so the cost is O(smallest sparse set) rather than O(matched rows)
+        [[nodiscard]] size_t CountSparse() const
+        {
+            SparseRefs refs{};
+            if (!ResolveSparse(refs))
+            {
+                return 0;
+            }
+
+            if (!SparseFiltersMayMatch(refs, std::make_index_sequence<changeFilterCount>{}, ChangeFilterTerms{}))
+            {
+                return 0;
+            }
+
+            const QueryDescriptor<Allocator>& desc = m_state.Descriptor();
+            std::array<Column<Allocator>*, slotCount> columns{};
+            size_t matches = 0;
+
+            if (refs.m_requiredCount == 0)
+            {
+                // Only sparse exclusions: every matched row has to be checked against them
+                for (size_t a = 0; a < m_state.ArchetypeCount(); ++a)
+                {
+                    Archetype<Allocator>* arch = m_state.GetArchetype(a);
+                    const Entity* entities = arch->GetEntities();
+
+                    for (size_t s = 0; s < slotCount; ++s)
+                    {
+                        columns[s] = m_state.GetColumn(a, s);
+                    }
+
+                    for (size_t row = 0; row < arch->EntityCount(); ++row)
+                    {
+                        if (CountsSparseRow(columns, refs, entities[row], row))
+                        {
+                            ++matches;
+                        }
+                    }
+                }
+                return matches;
+            }
+
+            const SparseStorage<Allocator>* driver = refs.m_required[0];
+            for (size_t i = 1; i < refs.m_requiredCount; ++i)
+            {
+                if (refs.m_required[i]->Count() < driver->Count())
+                {
+                    driver = refs.m_required[i];
+                }
+            }
+
+            for (size_t i = 0; i < driver->Count(); ++i)
+            {
+                const Entity entity = driver->EntityAt(i);
+                const auto* record = m_locations->Get(entity);
+                if (record == nullptr || !record->IsValid())
+                {
+                    continue;
+                }
+
+                Archetype<Allocator>* arch = record->m_archetype;
+                if (!desc.MatchesArchetype(*arch))
+                {
+                    continue;
+                }
+
+                if constexpr (changeFilterCount > 0)
+                {
+                    for (size_t s = 0; s < slotCount; ++s)
+                    {
+                        columns[s] = arch->GetColumn(m_state.GetSlotType(s));
+                    }
+                }
+
+                if (CountsSparseRow(columns, refs, entity, record->m_row))
+                {
+                    ++matches;
+                }
+            }
+            return matches;
+        }
+
+        bool CountsSparseRow(const std::array<Column<Allocator>*, slotCount>& columns, const SparseRefs& refs,
+                             Entity entity, size_t row) const
+        {
+            return PassesSparseTerms(refs, entity) &&
+                   PassesChangeFiltersAt(columns, refs, entity, row, std::make_index_sequence<changeFilterCount>{},
+                                         ChangeFilterTerms{});
+        }
+
+        template <bool WithEntity, typename Func> void EachSparse(Func& func)
+        {
+            SparseRefs refs{};
+            if (!ResolveSparse(refs))
+            {
+                return;
+            }
+
+            if (!SparseFiltersMayMatch(refs, std::make_index_sequence<changeFilterCount>{}, ChangeFilterTerms{}))
+            {
+                return;
+            }
+
+            const QueryDescriptor<Allocator>& desc = m_state.Descriptor();
+            std::array<Column<Allocator>*, slotCount> columns{};
+
+            if (desc.HasRequired())
+            {
+                // Dense terms pick the archetypes, sparse terms filter their rows
+                for (size_t a = 0; a < m_state.ArchetypeCount(); ++a)
+                {
+                    Archetype<Allocator>* arch = m_state.GetArchetype(a);
+                    const size_t count = arch->EntityCount();
+                    const Entity* entities = arch->GetEntities();
+
+                    for (size_t s = 0; s < slotCount; ++s)
+                    {
+                        columns[s] = m_state.GetColumn(a, s);
+                    }
+
+                    for (size_t row = 0; row < count; ++row)
+                    {
+                        VisitSparseRow<WithEntity>(func, columns, refs, entities[row], row);
+                    }
+                }
+                return;
+            }
+
+            if (refs.m_requiredCount == 0)
+            {
+                return;
+            }
+
+            // Only sparse required terms: walk the smallest storage and look up each entity's row
+            SparseStorage<Allocator>* driver = refs.m_required[0];
+            for (size_t i = 1; i < refs.m_requiredCount; ++i)
+            {
+                if (refs.m_required[i]->Count() < driver->Count())
+                {
+                    driver = refs.m_required[i];
+                }
+            }
+
+            for (size_t i = 0; i < driver->Count(); ++i)
+            {
+                const Entity entity = driver->EntityAt(i);
+                const auto* record = m_locations->Get(entity);
+                if (record == nullptr || !record->IsValid())
+                {
+                    continue;
+                }
+
+                Archetype<Allocator>* arch = record->m_archetype;
+                if (!desc.MatchesArchetype(*arch))
+                {
+                    continue;
+                }
+
+                for (size_t s = 0; s < slotCount; ++s)
+                {
+                    columns[s] = arch->GetColumn(m_state.GetSlotType(s));
+                }
+
+                VisitSparseRow<WithEntity>(func, columns, refs, entity, record->m_row);
+            }
+        }
+
+        QueryState<Allocator> m_state;
+        SparseStorageRegistry<Allocator>* m_sparse;
+        const EntityLocations* m_locations;
         Tick m_lastRunTick;
     };
 } // namespace queen
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <comb/allocator_concepts.h>
+
+#include <wax/containers/span.h>
+
+#include <queen/core/entity.h>
+#include <queen/core/tick.h>
+#include <queen/core/type_id.h>
+#include <queen/query/query_term.h>
+#include <queen/storage/archetype.h>
+#include <queen/storage/column.h>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace queen
+{
+    /**
+     * Contiguous run of rows handed to Query::EachChunk
+     *
+     * Describes rows [Begin(), Begin() + Size()) of one archetype. Every
+     * column of the run is contiguous, so the component spans passed next
+     * to the chunk can be walked as plain arrays. Entities and per-row
+     * ticks are exposed as spans over the same rows.
+     *
+     * Memory layout:
+     * ┌──────────────────────────────────────────────────────────────┐
+     * │ archetype_: Archetype* (owner of the rows)                   │
+     * │ begin_: first row in the archetype                           │
+     * │ size_: number of rows                                        │
+     * └──────────────────────────────────────────────────────────────┘
+     *
+     * Performance characteristics:
+     * - Entities: O(1)
+     * - Ticks<T>: O(1) column lookup
+     * - MarkChanged<T>: O(size)
+     *
+     * Limitations:
+     * - Only valid for the duration of the EachChunk callback
+     * - Writes through a span do not update change ticks, call
+     *   MarkChanged<T>() for components that were modified
+     *
+     * Example:
+     * @code
+     *   query.EachChunk([tick](const auto& chunk, wax::Span<const Velocity> vel, wax::Span<Position> pos) {
+     *       for (size_t i = 0; i < chunk.Size(); ++i) {
+     *           pos[i].x += vel[i].dx;
+     *       }
+     *       chunk.template MarkChanged<Position>(tick);
+     *   });
+     * @endcode
+     */
+    template <comb::Allocator Allocator> class QueryChunk
+    {
+    public:
+        QueryChunk(Archetype<Allocator>* archetype, size_t begin, size_t size) noexcept
+            : m_archetype{archetype}
+            , m_begin{begin}
+            , m_size{size}
+        {
+        }
+
+        [[nodiscard]] size_t Size() const noexcept
+        {
+            return m_size;
+        }
+
+        [[nodiscard]] size_t Begin() const noexcept
+        {
+            return m_begin;
+        }
+
+        [[nodiscard]] Archetype<Allocator>* GetArchetype() const noexcept
+        {
+            return m_archetype;
+        }
+
+        [[nodiscard]] wax::Span<const Entity> Entities() const noexcept
+        {
+            return wax::Span<const Entity>{m_archetype->GetEntities() + m_begin, m_size};
+        }
+
+        /**
+         * Per-row ticks of component T, empty if the archetype lacks T
+         */
+        template <typename T> [[nodiscard]] wax::Span<const ComponentTicks> Ticks() const noexcept
+        {
+            const Column<Allocator>* column = m_archetype->template GetColumn<T>();
+            if (column == nullptr)
+            {
+                return wax::Span<const ComponentTicks>{};
+            }
+            return wax::Span<const ComponentTicks>{column->TicksAt(m_begin), m_size};
+        }
+
+        /**
+         * Mark component T changed on every row of the chunk
+         */
+        template <typename T> void MarkChanged(Tick currentTick) const noexcept
+        {
+            Column<Allocator>* column = m_archetype->template GetColumn<T>();
+            if (column == nullptr)
+            {
+                return;
+            }
+            for (size_t i = 0; i < m_size; ++i)
+            {
+                column->MarkChanged(m_begin + i, currentTick);
+            }
+        }
+
+    private:
+        Archetype<Allocator>* m_archetype;
+        size_t m_begin;
+        size_t m_size;
+    };
+
+    namespace detail
+    {
+        // Span type EachChunk passes for a data term: const for read access
+        template <typename Term>
+        using ChunkSpanT = wax::Span<std::conditional_t<Term::access == TermAccess::WRITE,
+                                                        typename Term::ComponentType,
+                                                        const typename Term::ComponentType>>;
+
+        template <typename Term, typename Allocator>
+        ChunkSpanT<Term> MakeChunkSpan(Column<Allocator>* column, size_t begin, size_t size)
+        {
+            using ElementT = typename ChunkSpanT<Term>::ValueType;
+
+            if (column == nullptr)
+            {
+                return ChunkSpanT<Term>{};
+            }
+            return ChunkSpanT<Term>{static_cast<ElementT*>(column->GetRaw(begin)), size};
+        }
+    } // namespace detail
+} // namespace queen
@@ -4,6 +4,8 @@
 
 #include <wax/containers/vector.h>
 
+#include <queen/core/component_mask.h>
+#include <queen/core/dense_id.h>
 #include <queen/core/type_id.h>
 #include <queen/query/query_term.h>
 #include <queen/storage/archetype.h>
@@ -25,16 +27,23 @@ namespace queen
      * │ excluded_: Vector<TypeId>    (Without terms, must not have)  │
      * │ optional_: Vector<TypeId>    (Maybe terms, may have)         │
      * │ data_access_: Vector<Term>   (terms with Read/Write access)  │
+     * │ sparse_*_: Vector<TypeId>    (same, for sparse components)   │
+     * │ required/excluded_mask_: ComponentMask (bits by DenseId)     │
      * └──────────────────────────────────────────────────────────────┘
      *
      * Matching logic:
      * - Archetype must have ALL required components
      * - Archetype must have NONE of the excluded components
      * - Optional components are fetched if present (nullptr otherwise)
+     * - Sparse components never live in archetypes: their terms are kept
+     *   apart and checked per entity by the Query
      *
      * Performance characteristics:
      * - Construction: O(n) where n = number of terms
-     * - MatchesArchetype: O(r + e) where r=required, e=excluded
+     * - MatchesArchetype: O(B) AND/ANDNOT of the archetype signature
+     *   against the term masks, B = DenseIdCount() / 64 blocks
+     * - FindMatchingArchetypes: candidates come from the rarest required
+     *   term's ComponentIndex list, each tested with MatchesArchetype
      *
      * Limitations:
      * - Not thread-safe
@@ -63,6 +72,11 @@ namespace queen
             , m_excluded{allocator}
             , m_optional{allocator}
             , m_dataAccess{allocator}
+            , m_sparseRequired{allocator}
+            , m_sparseExcluded{allocator}
+            , m_sparseOptional{allocator}
+            , m_requiredMask{allocator}
+            , m_excludedMask{allocator}
         {
         }
 
@@ -89,21 +103,35 @@ namespace queen
             m_excluded.Clear();
             m_optional.Clear();
             m_dataAccess.Clear();
+            m_sparseRequired.Clear();
+            m_sparseExcluded.Clear();
+            m_sparseOptional.Clear();
+            m_requiredMask.ClearAll();
+            m_excludedMask.ClearAll();
 
             for (size_t i = 0; i < m_terms.Size(); ++i)
             {
                 const Term& term = m_terms[i];
+                const bool sparse = term.IsSparse();
 
                 switch (term.m_op)
                 {
                     case TermOperator::WITH:
-                        m_required.PushBack(term.m_typeId);
+                        (sparse ? m_sparseRequired : m_required).PushBack(term.m_typeId);
+                        if (!sparse)
+                        {
+                            m_requiredMask.Set(RegisterDenseId(term.m_typeId));
+                        }
                         break;
                     case TermOperator::WITHOUT:
-                        m_excluded.PushBack(term.m_typeId);
+                        (sparse ? m_sparseExcluded : m_excluded).PushBack(term.m_typeId);
+                        if (!sparse)
+                        {
+                            m_excludedMask.Set(RegisterDenseId(term.m_typeId));
+                        }
                         break;
                     case TermOperator::Optional:
-                        m_optional.PushBack(term.m_typeId);
+                        (sparse ? m_sparseOptional : m_optional).PushBack(term.m_typeId);
                         break;
                 }
 
@@ -124,23 +152,7 @@ namespace queen
 
         [[nodiscard]] bool MatchesArchetype(const Archetype<Allocator>& archetype) const noexcept
         {
-            for (size_t i = 0; i < m_required.Size(); ++i)
-            {
-                if (!archetype.HasComponent(m_required[i]))
-                {
-                    return false;
-                }
-            }
-
-            for (size_t i = 0; i < m_excluded.Size(); ++i)
-            {
-                if (archetype.HasComponent(m_excluded[i]))
-                {
-                    return false;
-                }
-            }
-
-            return true;
+            return archetype.GetSignature().MatchesSignature(m_requiredMask, m_excludedMask);
         }
 
         [[nodiscard]] wax::Vector<Archetype<Allocator>*>
@@ -148,29 +160,7 @@ namespace queen
         {
             wax::Vector<Archetype<Allocator>*> result{*m_allocator};
 
-            if (m_required.IsEmpty())
-            {
-                return result;
-            }
-
-            size_t smallestIdx = 0;
-            size_t smallestSize = SIZE_MAX;
-
-            for (size_t i = 0; i < m_required.Size(); ++i)
-            {
-                const auto* list = index.GetArchetypesWith(m_required[i]);
-                if (list == nullptr)
-                {
-                    return result;
-                }
-                if (list->Size() < smallestSize)
-                {
-                    smallestSize = list->Size();
-                    smallestIdx = i;
-                }
-            }
-
-            const auto* candidates = index.GetArchetypesWith(m_required[smallestIdx]);
+            const auto* candidates = index.FindRarest(m_required.Data(), m_required.Size());
             if (candidates == nullptr)
             {
                 return result;
@@ -213,6 +203,36 @@ namespace queen
             return m_dataAccess;
         }
 
+        [[nodiscard]] const ComponentMask<Allocator>& GetRequiredMask() const noexcept
+        {
+            return m_requiredMask;
+        }
+
+        [[nodiscard]] const ComponentMask<Allocator>& GetExcludedMask() const noexcept
+        {
+            return m_excludedMask;
+        }
+
+        [[nodiscard]] const wax::Vector<TypeId>& GetSparseRequired() const noexcept
+        {
+            return m_sparseRequired;
+        }
+
+        [[nodiscard]] const wax::Vector<TypeId>& GetSparseExcluded() const noexcept
+        {
+            return m_sparseExcluded;
+        }
+
+        [[nodiscard]] const wax::Vector<TypeId>& GetSparseOptional() const noexcept
+        {
+            return m_sparseOptional;
+        }
+
+        [[nodiscard]] bool HasSparseTerms() const noexcept
+        {
+            return !m_sparseRequired.IsEmpty() || !m_sparseExcluded.IsEmpty() || !m_sparseOptional.IsEmpty();
+        }
+
         [[nodiscard]] size_t TermCount() const noexcept
         {
             return m_terms.Size();
@@ -258,5 +278,10 @@ namespace queen
         wax::Vector<TypeId> m_excluded;
         wax::Vector<TypeId> m_optional;
         wax::Vector<Term> m_dataAccess;
+        wax::Vector<TypeId> m_sparseRequired;
+        wax::Vector<TypeId> m_sparseExcluded;
+        wax::Vector<TypeId> m_sparseOptional;
+        ComponentMask<Allocator> m_requiredMask;
+        ComponentMask<Allocator> m_excludedMask;
     };
 } // namespace queen
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <hive/core/assert.h>
+
+#include <comb/allocator_concepts.h>
+
+#include <wax/containers/vector.h>
+
+#include <queen/core/type_id.h>
+#include <queen/query/query_descriptor.h>
+#include <queen/storage/archetype.h>
+#include <queen/storage/column.h>
+#include <queen/storage/component_index.h>
+
+namespace queen
+{
+    /**
+     * Cached archetype matches for a query
+     *
+     * Holds the list of archetypes matching a QueryDescriptor together with
+     * the resolved Column pointer of every slot the query reads. A slot is a
+     * component type whose column is needed during iteration (data terms and
+     * change filter terms). Columns are resolved once when an archetype is
+     * added, so iteration never probes the table's type-to-column map.
+     *
+     * The state can be kept alive across frames: the World notifies every
+     * registered state when a new archetype is created, so the match list
+     * stays current without re-running FindMatchingArchetypes.
+     *
+     * Memory layout:
+     * ┌──────────────────────────────────────────────────────────────┐
+     * │ descriptor_: QueryDescriptor (term definitions)              │
+     * │ slot_types_: [TypeId_0, TypeId_1, ...] (one per slot)        │
+     * │ archetypes_: [Arch_0, Arch_1, ...]                           │
+     * │ columns_: [A0.S0, A0.S1, ..., A1.S0, A1.S1, ...]             │
+     * │           (archetype-major, nullptr for absent optionals)    │
+     * └──────────────────────────────────────────────────────────────┘
+     *
+     * Performance characteristics:
+     * - MatchAll: O(candidates * B) from the rarest required term's
+     *   ComponentIndex list, B = signature mask blocks
+     * - TryAddArchetype: O(B) signature mask test
+     * - RemoveArchetype: O(matched archetypes * slots)
+     * - GetColumn: O(1)
+     *
+     * Limitations:
+     * - Not thread-safe: archetype notifications must not race iteration
+     * - Relies on archetypes and their columns having stable addresses
+     *
+     * Example:
+     * @code
+     *   QueryState<Allocator> state{alloc};
+     *   state.Descriptor().AddTerm(Read<Position>::ToTerm());
+     *   state.Descriptor().Finalize();
+     *   state.AddSlot(TypeIdOf<Position>());
+     *   state.MatchAll(index);
+     *
+     *   for (size_t a = 0; a < state.ArchetypeCount(); ++a) {
+     *       Column<Allocator>* col = state.GetColumn(a, 0);
+     *   }
+     * @endcode
+     */
+    template <comb::Allocator Allocator> class QueryState
+    {
+    public:
+        explicit QueryState(Allocator& allocator)
+            : m_descriptor{allocator}
+            , m_slotTypes{allocator}
+            , m_archetypes{allocator}
+            , m_columns{allocator}
+        {
+        }
+
+        ~QueryState() = default;
+
+        QueryState(const QueryState&) = delete;
+        QueryState& operator=(const QueryState&) = delete;
+        QueryState(QueryState&&) = default;
+        QueryState& operator=(QueryState&&) = default;
+
+        [[nodiscard]] QueryDescriptor<Allocator>& Descriptor() noexcept
+        {
+            return m_descriptor;
+        }
+
+        [[nodiscard]] const QueryDescriptor<Allocator>& Descriptor() const noexcept
+        {
+            return m_descriptor;
+        }
+
+        /**
+         * Declare a column slot, must be called before any archetype is added
+         */
+        void AddSlot(TypeId typeId)
+        {
+            hive::Assert(m_archetypes.IsEmpty(), "QueryState slots must be declared before matching");
+            m_slotTypes.PushBack(typeId);
+        }
+
+        /**
+         * Rebuild the match list from the component index
+         */
+        void MatchAll(const ComponentIndex<Allocator>& index)
+        {
+            m_archetypes.Clear();
+            m_columns.Clear();
+
+            wax::Vector<Archetype<Allocator>*> matches = m_descriptor.FindMatchingArchetypes(index);
+            m_archetypes.Reserve(matches.Size());
+            m_columns.Reserve(matches.Size() * m_slotTypes.Size());
+
+            for (size_t i = 0; i < matches.Size(); ++i)
+            {
+                AppendArchetype(matches[i]);
+            }
+        }
+
+        /**
+         * Add an archetype if it matches the descriptor
+         *
+         * Called by the World when a new archetype is registered. Queries
+         * without required terms never match (same as FindMatchingArchetypes).
+         * The World announces an archetype only while it is missing from the
+         * ComponentIndex, so an already matched archetype never comes back
+         * here and no duplicate check is needed.
+         *
+         * @return true if the archetype was added
+         */
+        bool TryAddArchetype(Archetype<Allocator>* archetype)
+        {
+            if (!m_descriptor.HasRequired() || !m_descriptor.MatchesArchetype(*archetype))
+            {
+                return false;
+            }
+
+            AppendArchetype(archetype);
+            return true;
+        }
+
+        /**
+         * Drop a matched archetype and its column slots, keeping match order
+         *
+         * Called by the World when Compact retires an empty archetype. The
+         * archetype comes back through TryAddArchetype once it is refilled.
+         *
+         * @return true if the archetype was matched
+         */
+        bool RemoveArchetype(const Archetype<Allocator>* archetype)
+        {
+            for (size_t i = 0; i < m_archetypes.Size(); ++i)
+            {
+                if (m_archetypes[i] != archetype)
+                {
+                    continue;
+                }
+
+                const size_t stride = m_slotTypes.Size();
+                for (size_t s = 0; s < stride; ++s)
+                {
+                    m_columns.Erase(m_columns.Begin() + i * stride);
+                }
+                m_archetypes.Erase(m_archetypes.Begin() + i);
+                return true;
+            }
+            return false;
+        }
+
+        [[nodiscard]] size_t ArchetypeCount() const noexcept
+        {
+            return m_archetypes.Size();
+        }
+
+        [[nodiscard]] size_t SlotCount() const noexcept
+        {
+            return m_slotTypes.Size();
+        }
+
+        [[nodiscard]] TypeId GetSlotType(size_t slot) const noexcept
+        {
+            return m_slotTypes[slot];
+        }
+
+        [[nodiscard]] Archetype<Allocator>* GetArchetype(size_t index) const noexcept
+        {
+            return m_archetypes[index];
+        }
+
+        [[nodiscard]] Column<Allocator>* GetColumn(size_t archetypeIndex, size_t slot) const noexcept
+        {
+            return m_columns[archetypeIndex * m_slotTypes.Size() + slot];
+        }
+
+        [[nodiscard]] const wax::Vector<Archetype<Allocator>*>& GetArchetypes() const noexcept
+        {
+            return m_archetypes;
+        }
+
+        /**
+         * Check a slot's column tick summaries for a change at or after since
+         *
+         * Conservative: a column's MaxTicks() covers rows that were since
+         * removed, so this may report a change nobody can observe.
+         *
+         * @return true if the slot's column of any matched archetype had a
+         *         component added or changed at tick since or later
+         */
+        [[nodiscard]] bool SlotChangedSince(size_t slot, Tick since) const noexcept
+        {
+            const size_t stride = m_slotTypes.Size();
+            for (size_t i = slot; i < m_columns.Size(); i += stride)
+            {
+                const Column<Allocator>* column = m_columns[i];
+                if (column != nullptr &&
+                    (column->MaxTicks().m_added.IsAtLeast(since) || column->MaxTicks().m_changed.IsAtLeast(since)))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+        void AppendArchetype(Archetype<Allocator>* archetype)
+        {
+            m_archetypes.PushBack(archetype);
+            for (size_t s = 0; s < m_slotTypes.Size(); ++s)
+            {
+                m_columns.PushBack(archetype->GetColumn(m_slotTypes[s]));
+            }
+        }
+
+        QueryDescriptor<Allocator> m_descriptor;
+        wax::Vector<TypeId> m_slotTypes;
+        wax::Vector<Archetype<Allocator>*> m_archetypes;
+        wax::Vector<Column<Allocator>*> m_columns;
+    };
+} // namespace queen
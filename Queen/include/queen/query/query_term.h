@@ -1,5 +1,6 @@
 #pragma once
 
+#include <queen/core/component_info.h>
 #include <queen/core/type_id.h>
 
 #include <cstdint>
@@ -56,6 +57,7 @@ namespace queen
         TypeId m_typeId = 0;
         TermOperator m_op = TermOperator::WITH;
         TermAccess m_access = TermAccess::READ;
+        StorageType m_storage = StorageType::DENSE;
 
         [[nodiscard]] constexpr bool IsValid() const noexcept
         {
@@ -92,11 +94,16 @@ namespace queen
             return m_access != TermAccess::NONE;
         }
 
+        [[nodiscard]] constexpr bool IsSparse() const noexcept
+        {
+            return m_storage == StorageType::SPARSE;
+        }
+
         template <typename T>
         [[nodiscard]] static constexpr Term Create(TermOperator op = TermOperator::WITH,
                                                    TermAccess access = TermAccess::READ) noexcept
         {
-            return Term{TypeIdOf<T>(), op, access};
+            return Term{TypeIdOf<T>(), op, access, detail::DeduceStorage<T>()};
         }
     };
 
@@ -122,7 +129,7 @@ namespace queen
 
         [[nodiscard]] static constexpr Term ToTerm() noexcept
         {
-            return Term{typeId, op, access};
+            return Term{typeId, op, access, detail::DeduceStorage<T>()};
         }
     };
 
@@ -149,7 +156,7 @@ namespace queen
 
         [[nodiscard]] static constexpr Term ToTerm() noexcept
         {
-            return Term{typeId, op, access};
+            return Term{typeId, op, access, detail::DeduceStorage<T>()};
         }
     };
 
@@ -176,7 +183,7 @@ namespace queen
 
         [[nodiscard]] static constexpr Term ToTerm() noexcept
         {
-            return Term{typeId, op, access};
+            return Term{typeId, op, access, detail::DeduceStorage<T>()};
         }
     };
 
@@ -202,7 +209,7 @@ namespace queen
 
         [[nodiscard]] static constexpr Term ToTerm() noexcept
         {
-            return Term{typeId, op, access};
+            return Term{typeId, op, access, detail::DeduceStorage<T>()};
         }
     };
 
@@ -230,7 +237,7 @@ namespace queen
 
         [[nodiscard]] static constexpr Term ToTerm() noexcept
         {
-            return Term{typeId, op, access};
+            return Term{typeId, op, access, detail::DeduceStorage<T>()};
         }
     };
 
@@ -248,7 +255,7 @@ namespace queen
 
         [[nodiscard]] static constexpr Term ToTerm() noexcept
         {
-            return Term{typeId, op, access};
+            return Term{typeId, op, access, detail::DeduceStorage<T>()};
         }
     };
 
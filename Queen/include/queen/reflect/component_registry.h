@@ -7,8 +7,11 @@
 #include <queen/reflect/component_serializer.h>
 #include <queen/reflect/reflectable.h>
 
+#include <bit>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <string_view>
 
 namespace queen
 {
@@ -56,11 +59,13 @@ namespace queen
      * │ entries_: RegisteredComponent[MaxComponents]                   │
      * │ count_: size_t                                                 │
      * │ type_id_to_index_: TypeId[MaxComponents] (sorted for bsearch)  │
+     * │ name_slots_: uint32_t[kNameSlots] (open addressing, index + 1) │
      * └────────────────────────────────────────────────────────────────┘
      *
      * Performance characteristics:
-     * - Register: O(n) - maintains sorted order for binary search
+     * - Register: O(n) - maintains sorted order and rebuilds the name index
      * - Lookup by TypeId: O(log n) - binary search
+     * - Lookup by name: O(1) average - FNV-1a hash, linear probing
      * - Lookup by index: O(1) - array access
      *
      * Limitations:
@@ -131,6 +136,7 @@ namespace queen
 
             m_entries[insertPos] = entry;
             ++m_count;
+            RebuildNameIndex();
         }
 
         /**
@@ -175,6 +181,7 @@ namespace queen
 
             m_entries[insertPos] = entry;
             ++m_count;
+            RebuildNameIndex();
         }
 
         /**
@@ -214,7 +221,9 @@ namespace queen
         }
 
         /**
-         * Find component by name (linear search)
+         * Find component by name (hashed)
+         *
+         * Only components registered with reflection have a name.
          *
          * @return Pointer to RegisteredComponent or nullptr if not found
          */
@@ -223,15 +232,19 @@ namespace queen
             if (name == nullptr)
                 return nullptr;
 
-            for (size_t i = 0; i < m_count; ++i)
+            for (size_t slot = NameSlot(name);; slot = (slot + 1) & (kNameSlots - 1))
             {
-                if (detail::StringsEqual(m_entries[i].m_reflection.m_name, name))
+                const uint32_t index = m_nameSlots[slot];
+                if (index == 0)
                 {
-                    return &m_entries[i];
+                    return nullptr;
                 }
-            }
 
-            return nullptr;
+                if (detail::StringsEqual(m_entries[index - 1].m_reflection.m_name, name))
+                {
+                    return &m_entries[index - 1];
+                }
+            }
         }
 
         /**
@@ -366,10 +379,45 @@ namespace queen
         void Clear() noexcept
         {
             m_count = 0;
+            RebuildNameIndex();
         }
 
     private:
+        // At least twice MaxComponents so probes stay short and always reach an empty slot
+        static constexpr size_t kNameSlots = std::bit_ceil(MaxComponents * 2);
+
+        [[nodiscard]] static size_t NameSlot(const char* name) noexcept
+        {
+            return static_cast<size_t>(detail::Fnv1aHash(std::string_view{name})) & (kNameSlots - 1);
+        }
+
+        // Entries shift on sorted insert, so the index is rebuilt rather than patched
+        void RebuildNameIndex() noexcept
+        {
+            for (uint32_t& slot : m_nameSlots)
+            {
+                slot = 0;
+            }
+
+            for (size_t i = 0; i < m_count; ++i)
+            {
+                const char* name = m_entries[i].m_reflection.m_name;
+                if (name == nullptr)
+                {
+                    continue;
+                }
+
+                size_t slot = NameSlot(name);
+                while (m_nameSlots[slot] != 0)
+                {
+                    slot = (slot + 1) & (kNameSlots - 1);
+                }
+                m_nameSlots[slot] = static_cast<uint32_t>(i + 1);
+            }
+        }
+
         RegisteredComponent m_entries[MaxComponents]{};
         size_t m_count = 0;
+        uint32_t m_nameSlots[kNameSlots]{};
     };
 } // namespace queen
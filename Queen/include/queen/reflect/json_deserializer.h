@@ -220,6 +220,20 @@ namespace queen
                 return true;
             }
 
+            // Parsed as float directly so shortest float output round-trips exactly
+            [[nodiscard]] bool ReadFloat(float& out) noexcept
+            {
+                const char* start = m_data + m_pos;
+                char* end = nullptr;
+                out = std::strtof(start, &end);
+                if (end == start)
+                {
+                    return false;
+                }
+                m_pos = static_cast<size_t>(end - m_data);
+                return true;
+            }
+
             [[nodiscard]] bool ReadBool(bool& out) noexcept
             {
                 if (std::strncmp(m_data + m_pos, "true", 4) == 0)
@@ -379,12 +393,12 @@ namespace queen
                     return true;
                 }
                 case FieldType::FLOAT32: {
-                    double num = 0.0;
-                    if (!parser.ReadNumber(num))
+                    float num = 0.0f;
+                    if (!parser.ReadFloat(num))
                     {
                         return false;
                     }
-                    *static_cast<float*>(ptr) = static_cast<float>(num);
+                    *static_cast<float*>(ptr) = num;
                     return true;
                 }
                 case FieldType::FLOAT64: {
@@ -8,15 +8,32 @@
 #include <queen/reflect/component_reflector.h>
 #include <queen/reflect/enum_reflection.h>
 
+#include <charconv>
 #include <cstddef>
 #include <cstdint>
-#include <cstdio>
+#include <cstring>
 #include <utility>
 
 namespace queen
 {
     namespace detail
     {
+        // Enough for any integer and the shortest round-trip form of a double
+        inline constexpr size_t kNumberChars = 32;
+
+        /**
+         * Format value with std::to_chars, returning the character count
+         *
+         * Integers are written exactly and floating point values in the
+         * shortest form that parses back to the same value, with no locale
+         * or printf-style format parsing involved.
+         */
+        template <typename T> [[nodiscard]] size_t FormatNumber(char (&out)[kNumberChars], T value) noexcept
+        {
+            const std::to_chars_result result = std::to_chars(out, out + kNumberChars, value);
+            return static_cast<size_t>(result.ptr - out);
+        }
+
         template <size_t BufSize> class FixedTextWriter
         {
         public:
@@ -56,6 +73,15 @@ namespace queen
                 }
             }
 
+            void Write(const char* s, size_t count) noexcept
+            {
+                const size_t room = BufSize - 1 - m_pos;
+                const size_t copied = count < room ? count : room;
+                std::memcpy(m_buf + m_pos, s, copied);
+                m_pos += copied;
+                m_overflowed = m_overflowed || copied < count;
+            }
+
             void Terminate() noexcept
             {
                 m_buf[m_pos < BufSize ? m_pos : BufSize - 1] = '\0';
@@ -108,6 +134,11 @@ namespace queen
                 }
             }
 
+            void Write(const char* s, size_t count)
+            {
+                m_buf.Append(s, count);
+            }
+
             void Terminate() noexcept
             {
             }
@@ -400,62 +431,38 @@ namespace queen
 
             void WriteInt(int32_t v) noexcept
             {
-                char tmp[16];
-                const int count = std::snprintf(tmp, sizeof(tmp), "%d", v);
-                for (int i = 0; i < count; ++i)
-                {
-                    Put(tmp[i]);
-                }
+                WriteNumber(v);
             }
 
             void WriteInt64(int64_t v) noexcept
             {
-                char tmp[24];
-                const int count = std::snprintf(tmp, sizeof(tmp), "%lld", static_cast<long long>(v));
-                for (int i = 0; i < count; ++i)
-                {
-                    Put(tmp[i]);
-                }
+                WriteNumber(v);
             }
 
             void WriteUint(uint32_t v) noexcept
             {
-                char tmp[16];
-                const int count = std::snprintf(tmp, sizeof(tmp), "%u", v);
-                for (int i = 0; i < count; ++i)
-                {
-                    Put(tmp[i]);
-                }
+                WriteNumber(v);
             }
 
             void WriteUint64(uint64_t v) noexcept
             {
-                char tmp[24];
-                const int count = std::snprintf(tmp, sizeof(tmp), "%llu", static_cast<unsigned long long>(v));
-                for (int i = 0; i < count; ++i)
-                {
-                    Put(tmp[i]);
-                }
+                WriteNumber(v);
             }
 
             void WriteFloat(float v) noexcept
             {
-                char tmp[32];
-                const int count = std::snprintf(tmp, sizeof(tmp), "%.9g", static_cast<double>(v));
-                for (int i = 0; i < count; ++i)
-                {
-                    Put(tmp[i]);
-                }
+                WriteNumber(v);
             }
 
             void WriteDouble(double v) noexcept
             {
-                char tmp[32];
-                const int count = std::snprintf(tmp, sizeof(tmp), "%.17g", v);
-                for (int i = 0; i < count; ++i)
-                {
-                    Put(tmp[i]);
-                }
+                WriteNumber(v);
+            }
+
+            template <typename T> void WriteNumber(T v) noexcept
+            {
+                char tmp[kNumberChars];
+                m_writer.Write(tmp, FormatNumber(tmp, v));
             }
 
             Writer m_writer{};
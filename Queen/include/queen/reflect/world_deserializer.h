@@ -1,10 +1,14 @@
 #pragma once
 
+#include <wax/containers/hash_map.h>
+#include <wax/containers/vector.h>
+
 #include <queen/hierarchy/hierarchy.h>
 #include <queen/reflect/component_registry.h>
 #include <queen/reflect/json_deserializer.h>
 #include <queen/world/world.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -23,19 +27,150 @@ namespace queen
         const char* m_error = nullptr;
     };
 
+    namespace detail
+    {
+        [[nodiscard]] inline bool HasEntityFields(const FieldInfo* fields, size_t fieldCount) noexcept
+        {
+            for (size_t i = 0; i < fieldCount; ++i)
+            {
+                const FieldInfo& field = fields[i];
+                if (field.m_type == FieldType::ENTITY ||
+                    (field.m_type == FieldType::FIXED_ARRAY && field.m_elementType == FieldType::ENTITY) ||
+                    (field.m_type == FieldType::STRUCT && field.m_nestedFields != nullptr &&
+                     HasEntityFields(field.m_nestedFields, field.m_nestedFieldCount)))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template <typename Map> void RemapMappedEntity(Entity* entity, const Map& remap) noexcept
+        {
+            if (entity->IsNull())
+            {
+                return;
+            }
+
+            if (const Entity* live = remap.Find(entity->ToU64()))
+            {
+                *entity = *live;
+            }
+        }
+
+        template <typename Map>
+        void RemapMappedFields(void* base, const FieldInfo* fields, size_t fieldCount, const Map& remap) noexcept
+        {
+            for (size_t i = 0; i < fieldCount; ++i)
+            {
+                const FieldInfo& field = fields[i];
+                auto* fieldPtr = static_cast<std::byte*>(base) + field.m_offset;
+
+                if (field.m_type == FieldType::ENTITY)
+                {
+                    RemapMappedEntity(reinterpret_cast<Entity*>(fieldPtr), remap);
+                }
+                else if (field.m_type == FieldType::STRUCT && field.m_nestedFields != nullptr)
+                {
+                    RemapMappedFields(fieldPtr, field.m_nestedFields, field.m_nestedFieldCount, remap);
+                }
+                else if (field.m_type == FieldType::FIXED_ARRAY && field.m_elementType == FieldType::ENTITY)
+                {
+                    for (size_t j = 0; j < field.m_elementCount; ++j)
+                    {
+                        RemapMappedEntity(reinterpret_cast<Entity*>(fieldPtr) + j, remap);
+                    }
+                }
+            }
+        }
+    } // namespace detail
+
+    /**
+     * Serialized entity id to live entity mapping kept across ApplyDelta calls
+     *
+     * Entities first seen in a delta are spawned and recorded here, later
+     * deltas patch the same live entities. Dropping the map detaches the
+     * receiving world from the delta stream.
+     */
+    class DeltaEntityMap
+    {
+    public:
+        [[nodiscard]] const Entity* Find(uint64_t serializedId) const noexcept
+        {
+            return m_entities.Find(serializedId);
+        }
+
+        /**
+         * Map a serialized id, replacing a previous mapping (e.g. a live
+         * entity that was despawned locally and respawned by a delta)
+         */
+        void Insert(uint64_t serializedId, Entity live)
+        {
+            if (Entity* existing = m_entities.Find(serializedId))
+            {
+                *existing = live;
+                return;
+            }
+            m_entities.Insert(serializedId, live);
+        }
+
+        bool Remove(uint64_t serializedId)
+        {
+            return m_entities.Remove(serializedId);
+        }
+
+        void Clear() noexcept
+        {
+            m_entities.Clear();
+        }
+
+        [[nodiscard]] size_t Count() const noexcept
+        {
+            return m_entities.Count();
+        }
+
+        template <typename F> void ForEach(F&& callback) const
+        {
+            for (auto it = m_entities.begin(); it != m_entities.end(); ++it)
+            {
+                callback(it.Key(), it.Value());
+            }
+        }
+
+    private:
+        wax::HashMap<uint64_t, Entity> m_entities{};
+    };
+
     /**
      * Deserializes a World from JSON using reflection and a ComponentRegistry
      *
      * - Additive loading: existing entities are preserved
      * - Entity remapping: serialized IDs are mapped to newly spawned live entities
      * - Entity references in components are remapped automatically
-     * - Hierarchy (Parent) is reconstructed via World::SetParent
+     * - Hierarchy (Parent/Children) is rebuilt in bulk from the file's parent ids
      * - Unknown component types are skipped (forward-compatible)
+     * - ApplyDelta patches a world in place from WorldSerializer::SerializeDelta
+     *   output, keeping the id mapping in a DeltaEntityMap
+     *
+     * Deserialize runs in three passes. The first parses the entity list,
+     * keeping only the offset of each component value, and groups entities
+     * by component signature. The second spawns each group with a single
+     * World::SpawnBatchRaw and decodes the values straight into the new
+     * column rows. The third remaps Entity fields of the components that
+     * have some through a hashed id map and fills the hierarchy. Parent and
+     * Children are part of each group's signature, so parented entities are
+     * spawned in their final archetype and never moved.
+     *
+     * Performance characteristics:
+     * - Deserialize: O(entities + components), one archetype lookup and
+     *   table reservation per signature
+     * - Component names: O(1) ComponentRegistry::FindByName
      *
      * Limitations:
-     * - Maximum 4096 entities per load
-     * - Maximum component size: 512 bytes
+     * - ApplyDelta component size: 512 bytes
      * - No Unicode escape sequences
+     * - Malformed component values are found in the second pass, the
+     *   entities spawned so far are despawned before failing
      */
     class WorldDeserializer
     {
@@ -247,96 +382,151 @@ namespace queen
             }
         };
 
-        struct RemapEntry
+        // Pass 1 output: a reflected component value, kept as an offset into the JSON text
+        struct ParsedComponent
         {
-            uint64_t m_serializedId = 0;
-            Entity m_liveEntity;
+            const RegisteredComponent* m_component = nullptr;
+            size_t m_offset = 0;
         };
 
-        struct ParentLink
+        struct ParsedEntity
         {
-            size_t m_entityIndex = 0;
+            uint64_t m_serializedId = 0;
             uint64_t m_parentId = 0;
+            bool m_hasParent = false;
+            uint8_t m_hierarchy = 0;        // kHasParent | kHasChildren, part of the signature
+            uint32_t m_parent = UINT32_MAX; // Index of the parent among the parsed entities
+            uint32_t m_group = 0;
+            uint32_t m_row = 0;            // Index within its group
+            uint32_t m_firstComponent = 0; // Sorted by TypeId, in group signature order
+            uint32_t m_componentCount = 0;
         };
 
-        static Entity FindRemapped(const RemapEntry* table, size_t count, uint64_t serializedId) noexcept
+        // Entities sharing a component signature, spawned by one SpawnBatchRaw
+        struct SignatureGroup
+        {
+            uint64_t m_hash = 0;
+            uint32_t m_firstComponent = 0; // Components of the first entity define the signature
+            uint32_t m_componentCount = 0;
+            uint32_t m_entityCount = 0;
+            uint32_t m_firstEntity = 0; // Into the spawned entity list
+            uint32_t m_nextWithHash = UINT32_MAX;
+            uint8_t m_hierarchy = 0;
+        };
+
+        static constexpr uint8_t kHasParent = 1;
+        static constexpr uint8_t kHasChildren = 2;
+
+        // Insert in TypeId order, a component listed twice keeps its last value
+        static void AddParsedComponent(wax::Vector<ParsedComponent>& components, size_t first,
+                                       ParsedComponent value)
         {
-            for (size_t i = 0; i < count; ++i)
+            const TypeId typeId = value.m_component->m_meta.m_typeId;
+            size_t pos = components.Size();
+            for (size_t i = first; i < components.Size(); ++i)
             {
-                if (table[i].m_serializedId == serializedId)
+                const TypeId other = components[i].m_component->m_meta.m_typeId;
+                if (other == typeId)
                 {
-                    return table[i].m_liveEntity;
+                    components[i] = value;
+                    return;
+                }
+                if (other > typeId)
+                {
+                    pos = i;
+                    break;
                 }
             }
-            return Entity::Invalid();
+
+            components.PushBack(value);
+            for (size_t i = components.Size() - 1; i > pos; --i)
+            {
+                components[i] = components[i - 1];
+            }
+            components[pos] = value;
         }
 
-        static void RemapFieldsRecursive(void* base, const FieldInfo* fields, size_t fieldCount,
-                                         const RemapEntry* remapTable, size_t remapCount) noexcept
+        [[nodiscard]] static uint32_t FindOrAddGroup(wax::Vector<SignatureGroup>& groups,
+                                                     wax::HashMap<uint64_t, uint32_t>& groupByHash,
+                                                     const wax::Vector<ParsedComponent>& components,
+                                                     const ParsedEntity& entity)
         {
-            for (size_t i = 0; i < fieldCount; ++i)
+            const ParsedComponent* signature = components.Data() + entity.m_firstComponent;
+
+            uint64_t hash = detail::kFnv1aOffset;
+            for (uint32_t c = 0; c < entity.m_componentCount; ++c)
             {
-                const FieldInfo& field = fields[i];
-                auto* fieldPtr = static_cast<std::byte*>(base) + field.m_offset;
+                hash = (hash ^ signature[c].m_component->m_meta.m_typeId) * detail::kFnv1aPrime;
+            }
+            hash = (hash ^ entity.m_hierarchy) * detail::kFnv1aPrime;
 
-                if (field.m_type == FieldType::ENTITY)
-                {
-                    auto* entityRef = reinterpret_cast<Entity*>(fieldPtr);
-                    if (!entityRef->IsNull())
-                    {
-                        Entity remapped = FindRemapped(remapTable, remapCount, entityRef->ToU64());
-                        if (!remapped.IsNull())
-                        {
-                            *entityRef = remapped;
-                        }
-                    }
-                }
-                else if (field.m_type == FieldType::STRUCT && field.m_nestedFields != nullptr)
+            uint32_t* head = groupByHash.Find(hash);
+            for (uint32_t g = head != nullptr ? *head : UINT32_MAX; g != UINT32_MAX; g = groups[g].m_nextWithHash)
+            {
+                const SignatureGroup& group = groups[g];
+                bool same =
+                    group.m_componentCount == entity.m_componentCount && group.m_hierarchy == entity.m_hierarchy;
+                for (uint32_t c = 0; same && c < entity.m_componentCount; ++c)
                 {
-                    RemapFieldsRecursive(fieldPtr, field.m_nestedFields, field.m_nestedFieldCount, remapTable,
-                                         remapCount);
+                    same = components[group.m_firstComponent + c].m_component == signature[c].m_component;
                 }
-                else if (field.m_type == FieldType::FIXED_ARRAY && field.m_elementType == FieldType::ENTITY)
+                if (same)
                 {
-                    size_t elemSize = (field.m_elementCount > 0) ? (field.m_size / field.m_elementCount) : 0;
-                    for (size_t j = 0; j < field.m_elementCount; ++j)
-                    {
-                        auto* elem = reinterpret_cast<Entity*>(fieldPtr + j * elemSize);
-                        if (!elem->IsNull())
-                        {
-                            Entity remapped = FindRemapped(remapTable, remapCount, elem->ToU64());
-                            if (!remapped.IsNull())
-                            {
-                                *elem = remapped;
-                            }
-                        }
-                    }
+                    return g;
                 }
             }
+
+            const auto index = static_cast<uint32_t>(groups.Size());
+            SignatureGroup group{};
+            group.m_hash = hash;
+            group.m_firstComponent = entity.m_firstComponent;
+            group.m_componentCount = entity.m_componentCount;
+            group.m_hierarchy = entity.m_hierarchy;
+            if (head != nullptr)
+            {
+                group.m_nextWithHash = *head;
+                *head = index;
+            }
+            else
+            {
+                groupByHash.Insert(hash, index);
+            }
+            groups.PushBack(group);
+            return index;
         }
 
-        template <size_t MaxComponents>
-        static void RemapEntityFields(World& world, const ComponentRegistry<MaxComponents>& registry,
-                                      const RemapEntry* remapTable, size_t remapCount) noexcept
+        // Visit one component of entities spawned by a single SpawnBatchRaw, stops when callback returns false
+        template <typename F>
+        static bool ForEachSpawned(World& world, const Entity* entities, size_t count, const ComponentMeta& meta,
+                                   F&& callback)
         {
-            for (size_t e = 0; e < remapCount; ++e)
+            if (meta.m_storage == StorageType::SPARSE)
             {
-                Entity live = remapTable[e].m_liveEntity;
-
-                for (size_t r = 0; r < registry.Count(); ++r)
+                for (size_t i = 0; i < count; ++i)
                 {
-                    const auto& reg = registry[r];
-                    if (!reg.HasReflection())
-                        continue;
-
-                    void* compData = world.GetComponentRaw(live, reg.m_meta.m_typeId);
-                    if (compData == nullptr)
-                        continue;
+                    if (!callback(i, world.GetComponentRaw(entities[i], meta.m_typeId)))
+                        return false;
+                }
+                return true;
+            }
 
-                    RemapFieldsRecursive(compData, reg.m_reflection.m_fields, reg.m_reflection.m_fieldCount, remapTable,
-                                         remapCount);
+            // Dense rows of a batch are contiguous in one table, walk them a chunk at a time
+            const World::EntityRecord* record = world.m_entityLocations.Get(entities[0]);
+            Table<ComponentAllocator>& table = record->m_archetype->GetTable();
+            Column<ComponentAllocator>* column = table.GetColumnByTypeId(meta.m_typeId);
+            const size_t firstRow = record->m_row;
+            for (size_t segment = 0; segment < count;)
+            {
+                const size_t segmentEnd = std::min(count, table.ChunkEnd(firstRow + segment) - firstRow);
+                auto* data = static_cast<std::byte*>(column->GetRaw(firstRow + segment));
+                for (size_t i = segment; i < segmentEnd; ++i)
+                {
+                    if (!callback(i, data + (i - segment) * meta.m_size))
+                        return false;
                 }
+                segment = segmentEnd;
             }
+            return true;
         }
 
         static WorldDeserializeResult Fail(WorldDeserializeResult& result, const char* error) noexcept
@@ -345,22 +535,70 @@ namespace queen
             return result;
         }
 
+        struct DeltaComponent
+        {
+            Entity m_entity;
+            const RegisteredComponent* m_component = nullptr;
+        };
+
+        struct DeltaParentLink
+        {
+            Entity m_child;
+            uint64_t m_parentId = 0;
+        };
+
+        // Parse [id, id, ...] and call callback with each id
+        template <typename F> static bool ReadIdArray(Parser& p, F&& callback) noexcept
+        {
+            if (!p.Expect('['))
+                return false;
+
+            p.SkipWhitespace();
+            if (p.Peek() == ']')
+            {
+                p.Advance();
+                return true;
+            }
+
+            while (p.HasMore())
+            {
+                p.SkipWhitespace();
+                double id;
+                if (!p.ReadNumber(id))
+                    return false;
+                callback(static_cast<uint64_t>(id));
+
+                p.SkipWhitespace();
+                if (p.Peek() == ',')
+                    p.Advance();
+                else
+                    return p.Expect(']');
+            }
+            return false;
+        }
+
+        static Entity FindMapped(const DeltaEntityMap& entities, uint64_t serializedId) noexcept
+        {
+            const Entity* live = entities.Find(serializedId);
+            return live != nullptr ? *live : Entity::Invalid();
+        }
+
     public:
-        static constexpr size_t kMaxEntities = 4096;
         static constexpr size_t kMaxComponentSize = 512;
 
         template <size_t MaxComponents>
         static WorldDeserializeResult Deserialize(World& world, const ComponentRegistry<MaxComponents>& registry,
                                                   const char* json) noexcept
         {
+            HIVE_PROFILE_SCOPE_N("WorldDeserializer::Deserialize");
             WorldDeserializeResult result{};
             Parser p{json};
 
-            RemapEntry remapTable[kMaxEntities]{};
-            size_t remapCount = 0;
-
-            ParentLink parentLinks[kMaxEntities]{};
-            size_t parentCount = 0;
+            ComponentAllocator& allocator = world.GetComponentAllocator();
+            wax::Vector<ParsedEntity> entities{allocator};
+            wax::Vector<ParsedComponent> components{allocator};
+            wax::Vector<SignatureGroup> groups{allocator};
+            wax::HashMap<uint64_t, uint32_t> groupByHash{allocator};
 
             // Parse: {"version":1,"entities":[...]}
             p.SkipWhitespace();
@@ -404,20 +642,15 @@ namespace queen
                 return result;
             }
 
+            // --- Pass 1: parse entities and group them by component signature ---
             while (p.HasMore())
             {
-                if (remapCount >= kMaxEntities)
-                    return Fail(result, "Too many entities");
-
                 p.SkipWhitespace();
                 if (!p.Expect('{'))
                     return Fail(result, "Expected entity '{'");
 
-                uint64_t serializedId = 0;
-                uint64_t parentId = 0;
-                bool hasParent = false;
-
-                auto builder = world.Spawn();
+                ParsedEntity entity{};
+                entity.m_firstComponent = static_cast<uint32_t>(components.Size());
 
                 while (p.HasMore())
                 {
@@ -436,15 +669,15 @@ namespace queen
                         double num;
                         if (!p.ReadNumber(num))
                             return Fail(result, "Expected entity id");
-                        serializedId = static_cast<uint64_t>(num);
+                        entity.m_serializedId = static_cast<uint64_t>(num);
                     }
                     else if (detail::StringsEqual(fieldName, "parent"))
                     {
                         double num;
                         if (!p.ReadNumber(num))
                             return Fail(result, "Expected parent id");
-                        parentId = static_cast<uint64_t>(num);
-                        hasParent = true;
+                        entity.m_parentId = static_cast<uint64_t>(num);
+                        entity.m_hasParent = true;
                     }
                     else if (detail::StringsEqual(fieldName, "components"))
                     {
@@ -466,45 +699,19 @@ namespace queen
                                     return Fail(result, "Expected ':'");
                                 p.SkipWhitespace();
 
+                                // Values are decoded in pass 2, straight into their column rows
                                 const RegisteredComponent* reg = registry.FindByName(compName);
                                 if (reg != nullptr && reg->HasReflection())
                                 {
-                                    if (reg->m_meta.m_size > kMaxComponentSize)
-                                        return Fail(result, "Component too large");
-
-                                    alignas(16) std::byte buffer[kMaxComponentSize]{};
-                                    if (reg->m_meta.m_construct != nullptr)
-                                    {
-                                        reg->m_meta.m_construct(buffer);
-                                    }
-
-                                    auto compResult = JsonDeserializer::DeserializeComponent(buffer, reg->m_reflection,
-                                                                                             p.m_data + p.m_pos);
-
-                                    if (!compResult.m_success)
-                                    {
-                                        if (reg->m_meta.m_destruct != nullptr)
-                                            reg->m_meta.m_destruct(buffer);
-                                        return Fail(result, "Failed to deserialize component");
-                                    }
-
-                                    // Advance parser past the component JSON object
-                                    p.SkipValue();
-
-                                    builder.WithRaw(reg->m_meta, buffer);
-
-                                    if (reg->m_meta.m_destruct != nullptr)
-                                    {
-                                        reg->m_meta.m_destruct(buffer);
-                                    }
-
+                                    AddParsedComponent(components, entity.m_firstComponent,
+                                                       ParsedComponent{reg, p.m_pos});
                                     ++result.m_componentsLoaded;
                                 }
                                 else
                                 {
-                                    p.SkipValue();
                                     ++result.m_componentsSkipped;
                                 }
+                                p.SkipValue();
 
                                 p.SkipWhitespace();
                                 if (p.Peek() == ',')
@@ -544,18 +751,8 @@ namespace queen
                         return Fail(result, "Expected ',' or '}' in entity");
                 }
 
-                Entity live = builder.Build();
-
-                size_t entityIdx = remapCount;
-                remapTable[remapCount] = {serializedId, live};
-                ++remapCount;
-
-                if (hasParent)
-                {
-                    parentLinks[parentCount++] = {entityIdx, parentId};
-                }
-
-                ++result.m_entitiesLoaded;
+                entity.m_componentCount = static_cast<uint32_t>(components.Size()) - entity.m_firstComponent;
+                entities.PushBack(entity);
 
                 p.SkipWhitespace();
                 if (p.Peek() == ',')
@@ -571,26 +768,560 @@ namespace queen
                     return Fail(result, "Expected ',' or ']' in entities array");
             }
 
-            // --- Post-processing: Entity field remapping ---
-            RemapEntityFields(world, registry, remapTable, remapCount);
+            // Resolve parent ids within the file, Parent and Children then join the signatures
+            {
+                wax::HashMap<uint64_t, uint32_t> indexById{allocator, entities.Size()};
+                for (size_t i = 0; i < entities.Size(); ++i)
+                {
+                    indexById.Insert(entities[i].m_serializedId, static_cast<uint32_t>(i));
+                }
+
+                for (size_t i = 0; i < entities.Size(); ++i)
+                {
+                    ParsedEntity& entity = entities[i];
+                    if (!entity.m_hasParent)
+                        continue;
+
+                    const uint32_t* parent = indexById.Find(entity.m_parentId);
+                    if (parent != nullptr && *parent != i)
+                    {
+                        entity.m_parent = *parent;
+                        entity.m_hierarchy |= kHasParent;
+                        entities[*parent].m_hierarchy |= kHasChildren;
+                    }
+                }
+            }
+
+            for (ParsedEntity& entity : entities)
+            {
+                entity.m_group = FindOrAddGroup(groups, groupByHash, components, entity);
+                entity.m_row = groups[entity.m_group].m_entityCount++;
+            }
+
+            // --- Pass 2: one SpawnBatchRaw per signature, fields decoded in place ---
+            uint32_t firstEntity = 0;
+            for (SignatureGroup& group : groups)
+            {
+                group.m_firstEntity = firstEntity;
+                firstEntity += group.m_entityCount;
+            }
+
+            // order[i]: parsed entity spawned at live[i]
+            wax::Vector<uint32_t> order{allocator};
+            order.Resize(entities.Size());
+            for (size_t i = 0; i < entities.Size(); ++i)
+            {
+                order[groups[entities[i].m_group].m_firstEntity + entities[i].m_row] = static_cast<uint32_t>(i);
+            }
+
+            wax::Vector<Entity> live{allocator};
+            live.Resize(entities.Size());
+            const auto liveOf = [&](const ParsedEntity& entity) {
+                return live[groups[entity.m_group].m_firstEntity + entity.m_row];
+            };
+
+            const ComponentMeta parentMeta = ComponentMeta::Of<Parent>();
+            const ComponentMeta childrenMeta = ComponentMeta::Of<Children>();
+            wax::Vector<SpawnBatchComponent> spawn{allocator};
+            for (const SignatureGroup& group : groups)
+            {
+                spawn.Clear();
+                for (uint32_t c = 0; c < group.m_componentCount; ++c)
+                {
+                    spawn.PushBack(SpawnBatchComponent{components[group.m_firstComponent + c].m_component->m_meta});
+                }
+                if ((group.m_hierarchy & kHasParent) != 0)
+                {
+                    spawn.PushBack(SpawnBatchComponent{parentMeta});
+                }
+                if ((group.m_hierarchy & kHasChildren) != 0)
+                {
+                    // Zero-filled, Children has no default constructor. The lists are built in pass 3
+                    spawn.PushBack(SpawnBatchComponent{childrenMeta});
+                }
+
+                Entity* batch = live.Data() + group.m_firstEntity;
+                const uint32_t* rows = order.Data() + group.m_firstEntity;
+                world.SpawnBatchRaw(group.m_entityCount, spawn.Data(), spawn.Size(), batch);
+
+                for (uint32_t c = 0; c < group.m_componentCount; ++c)
+                {
+                    const RegisteredComponent* reg = components[group.m_firstComponent + c].m_component;
+                    const bool decoded = ForEachSpawned(
+                        world, batch, group.m_entityCount, reg->m_meta, [&](size_t i, void* data) {
+                            const size_t offset = components[entities[rows[i]].m_firstComponent + c].m_offset;
+                            return JsonDeserializer::DeserializeComponent(data, reg->m_reflection, json + offset)
+                                .m_success;
+                        });
+
+                    if (!decoded)
+                    {
+                        // Groups spawn in live order, so everything loaded so far is a prefix
+                        for (size_t i = 0; i < group.m_firstEntity + group.m_entityCount; ++i)
+                        {
+                            world.Despawn(live[i]);
+                        }
+                        result.m_componentsLoaded = 0;
+                        return Fail(result, "Failed to deserialize component");
+                    }
+                }
+            }
+
+            // --- Pass 3: entity field remapping and hierarchy, batched over the loaded entities ---
+            wax::HashMap<uint64_t, Entity> remap{allocator, entities.Size()};
+            for (const ParsedEntity& entity : entities)
+            {
+                remap.Insert(entity.m_serializedId, liveOf(entity));
+            }
+
+            for (const SignatureGroup& group : groups)
+            {
+                for (uint32_t c = 0; c < group.m_componentCount; ++c)
+                {
+                    const RegisteredComponent* reg = components[group.m_firstComponent + c].m_component;
+                    const ComponentReflection& reflection = reg->m_reflection;
+                    if (!detail::HasEntityFields(reflection.m_fields, reflection.m_fieldCount))
+                        continue;
+
+                    ForEachSpawned(world, live.Data() + group.m_firstEntity, group.m_entityCount, reg->m_meta,
+                                   [&](size_t, void* data) {
+                                       detail::RemapMappedFields(data, reflection.m_fields, reflection.m_fieldCount,
+                                                                 remap);
+                                       return true;
+                                   });
+                }
+            }
+
+            for (const SignatureGroup& group : groups)
+            {
+                const Entity* batch = live.Data() + group.m_firstEntity;
+                const uint32_t* rows = order.Data() + group.m_firstEntity;
+                if ((group.m_hierarchy & kHasChildren) != 0)
+                {
+                    ForEachSpawned(world, batch, group.m_entityCount, childrenMeta, [&](size_t, void* data) {
+                        new (data) Children{world.GetPersistentAllocator()};
+                        return true;
+                    });
+                }
+                if ((group.m_hierarchy & kHasParent) != 0)
+                {
+                    ForEachSpawned(world, batch, group.m_entityCount, parentMeta, [&](size_t i, void* data) {
+                        static_cast<Parent*>(data)->m_entity = liveOf(entities[entities[rows[i]].m_parent]);
+                        return true;
+                    });
+                }
+            }
 
-            // --- Post-processing: Rebuild hierarchy ---
-            for (size_t i = 0; i < parentCount; ++i)
+            // Children in file order, as one SetParent per link would list them
+            for (const ParsedEntity& entity : entities)
             {
-                Entity child = remapTable[parentLinks[i].m_entityIndex].m_liveEntity;
-                Entity parent = FindRemapped(remapTable, remapCount, parentLinks[i].m_parentId);
-                if (!parent.IsNull() && world.IsAlive(parent) && world.IsAlive(child))
+                if ((entity.m_hierarchy & kHasParent) != 0)
                 {
-                    world.SetParent(child, parent);
+                    world.Get<Children>(liveOf(entities[entity.m_parent]))->Add(liveOf(entity));
                 }
             }
 
+            // The OnAdd hooks SetParent fired (e.g. disabled propagation), by handle since callbacks may move rows
+            const bool parentObserved = world.m_observers.HasObservers(TriggerType::ADD, parentMeta.m_typeId);
+            const bool childrenObserved = world.m_observers.HasObservers(TriggerType::ADD, childrenMeta.m_typeId);
+            if (parentObserved || childrenObserved)
+            {
+                for (const ParsedEntity& parsed : entities)
+                {
+                    const Entity entity = liveOf(parsed);
+                    const Parent* parent = world.Get<Parent>(entity);
+                    if (parentObserved && (parsed.m_hierarchy & kHasParent) != 0 && parent != nullptr)
+                    {
+                        world.m_observers.Trigger(TriggerType::ADD, parentMeta.m_typeId, world, entity, parent);
+                    }
+
+                    const Children* children = world.Get<Children>(entity);
+                    if (childrenObserved && (parsed.m_hierarchy & kHasChildren) != 0 && children != nullptr)
+                    {
+                        world.m_observers.Trigger(TriggerType::ADD, childrenMeta.m_typeId, world, entity, children);
+                    }
+                }
+            }
+
+            p.SkipWhitespace();
+            if (p.Peek() == '}')
+                p.Advance();
+
+            result.m_entitiesLoaded = entities.Size();
+            result.m_success = true;
+            return result;
+        }
+
+        /**
+         * Patch a world in place with a WorldSerializer::SerializeDelta output
+         *
+         * Sections are replayed in order: a clear despawns every mapped
+         * entity, then despawns, unparenting and component removals, then
+         * the entity objects. Ids missing from entities are spawned and
+         * recorded, so a tick-0 delta seeds an empty world. Entity fields
+         * of applied components and parents are remapped through entities
+         * once every object is applied.
+         *
+         * A malformed delta fails with the sections read so far applied.
+         */
+        template <size_t MaxComponents>
+        static WorldDeserializeResult ApplyDelta(World& world, const ComponentRegistry<MaxComponents>& registry,
+                                                 const char* json, DeltaEntityMap& entities) noexcept
+        {
+            HIVE_PROFILE_SCOPE_N("WorldDeserializer::ApplyDelta");
+            WorldDeserializeResult result{};
+            Parser p{json};
+
+            wax::Vector<DeltaComponent> remapped{};
+            wax::Vector<DeltaParentLink> parentLinks{};
+
+            if (!p.Expect('{'))
+                return Fail(result, "Expected '{'");
+
             p.SkipWhitespace();
             if (p.Peek() == '}')
+            {
                 p.Advance();
+                result.m_success = true;
+                return result;
+            }
+
+            while (p.HasMore())
+            {
+                p.SkipWhitespace();
+                char key[64]{};
+                if (!p.ReadString(key, sizeof(key)))
+                    return Fail(result, "Expected key");
+                if (!p.Expect(':'))
+                    return Fail(result, "Expected ':'");
+                p.SkipWhitespace();
+
+                if (detail::StringsEqual(key, "cleared"))
+                {
+                    bool cleared = false;
+                    if (!p.ReadBool(cleared))
+                        return Fail(result, "Expected cleared flag");
+                    if (cleared)
+                    {
+                        entities.ForEach([&world](uint64_t, Entity live) { world.Despawn(live); });
+                        entities.Clear();
+                    }
+                }
+                else if (detail::StringsEqual(key, "despawned"))
+                {
+                    const bool ok = ReadIdArray(p, [&](uint64_t id) {
+                        const Entity live = FindMapped(entities, id);
+                        if (!live.IsNull())
+                        {
+                            world.RemoveParent(live);
+                            world.Despawn(live);
+                            entities.Remove(id);
+                        }
+                    });
+                    if (!ok)
+                        return Fail(result, "Expected despawned ids");
+                }
+                else if (detail::StringsEqual(key, "unparented"))
+                {
+                    const bool ok = ReadIdArray(p, [&](uint64_t id) {
+                        const Entity live = FindMapped(entities, id);
+                        if (!live.IsNull())
+                        {
+                            world.RemoveParent(live);
+                        }
+                    });
+                    if (!ok)
+                        return Fail(result, "Expected unparented ids");
+                }
+                else if (detail::StringsEqual(key, "removed"))
+                {
+                    if (!ApplyRemovals(p, world, registry, entities))
+                        return Fail(result, "Malformed removed components");
+                }
+                else if (detail::StringsEqual(key, "entities"))
+                {
+                    if (const char* error =
+                            ApplyEntities(p, world, registry, entities, remapped, parentLinks, result))
+                        return Fail(result, error);
+                }
+                else
+                {
+                    p.SkipValue();
+                }
+
+                p.SkipWhitespace();
+                if (p.Peek() == ',')
+                    p.Advance();
+                else if (p.Peek() == '}')
+                {
+                    p.Advance();
+                    break;
+                }
+                else
+                    return Fail(result, "Expected ',' or '}' in delta");
+            }
+
+            for (const DeltaComponent& applied : remapped)
+            {
+                void* data = world.GetComponentRaw(applied.m_entity, applied.m_component->m_meta.m_typeId);
+                if (data != nullptr)
+                {
+                    const ComponentReflection& reflection = applied.m_component->m_reflection;
+                    detail::RemapMappedFields(data, reflection.m_fields, reflection.m_fieldCount, entities);
+                }
+            }
+
+            for (const DeltaParentLink& link : parentLinks)
+            {
+                const Entity parent = FindMapped(entities, link.m_parentId);
+                if (!parent.IsNull() && world.IsAlive(link.m_child) && world.IsAlive(parent))
+                {
+                    world.SetParent(link.m_child, parent);
+                }
+            }
 
             result.m_success = true;
             return result;
         }
+
+    private:
+        // Parse [{"id":N,"component":"Name"}, ...] and remove each known component
+        template <size_t MaxComponents>
+        static bool ApplyRemovals(Parser& p, World& world, const ComponentRegistry<MaxComponents>& registry,
+                                  const DeltaEntityMap& entities) noexcept
+        {
+            if (!p.Expect('['))
+                return false;
+
+            p.SkipWhitespace();
+            if (p.Peek() == ']')
+            {
+                p.Advance();
+                return true;
+            }
+
+            while (p.HasMore())
+            {
+                if (!p.Expect('{'))
+                    return false;
+
+                uint64_t id = 0;
+                char compName[64]{};
+                while (p.HasMore())
+                {
+                    p.SkipWhitespace();
+                    char key[64]{};
+                    if (!p.ReadString(key, sizeof(key)) || !p.Expect(':'))
+                        return false;
+                    p.SkipWhitespace();
+
+                    if (detail::StringsEqual(key, "id"))
+                    {
+                        double num;
+                        if (!p.ReadNumber(num))
+                            return false;
+                        id = static_cast<uint64_t>(num);
+                    }
+                    else if (detail::StringsEqual(key, "component"))
+                    {
+                        if (!p.ReadString(compName, sizeof(compName)))
+                            return false;
+                    }
+                    else if (!p.SkipValue())
+                    {
+                        return false;
+                    }
+
+                    p.SkipWhitespace();
+                    if (p.Peek() == ',')
+                        p.Advance();
+                    else if (p.Expect('}'))
+                        break;
+                    else
+                        return false;
+                }
+
+                const Entity live = FindMapped(entities, id);
+                const RegisteredComponent* reg = registry.FindByName(compName);
+                if (!live.IsNull() && reg != nullptr)
+                {
+                    (void)world.RemoveComponentRaw(live, reg->m_meta.m_typeId);
+                }
+
+                p.SkipWhitespace();
+                if (p.Peek() == ',')
+                    p.Advance();
+                else
+                    return p.Expect(']');
+            }
+            return false;
+        }
+
+        // Parse the entity objects of a delta, nullptr on success
+        template <size_t MaxComponents>
+        static const char* ApplyEntities(Parser& p, World& world, const ComponentRegistry<MaxComponents>& registry,
+                                         DeltaEntityMap& entities, wax::Vector<DeltaComponent>& remapped,
+                                         wax::Vector<DeltaParentLink>& parentLinks,
+                                         WorldDeserializeResult& result) noexcept
+        {
+            if (!p.Expect('['))
+                return "Expected '['";
+
+            p.SkipWhitespace();
+            if (p.Peek() == ']')
+            {
+                p.Advance();
+                return nullptr;
+            }
+
+            while (p.HasMore())
+            {
+                if (!p.Expect('{'))
+                    return "Expected entity '{'";
+
+                Entity live = Entity::Invalid();
+                while (p.HasMore())
+                {
+                    p.SkipWhitespace();
+                    char fieldName[64]{};
+                    if (!p.ReadString(fieldName, sizeof(fieldName)))
+                        return "Expected field name";
+                    if (!p.Expect(':'))
+                        return "Expected ':'";
+                    p.SkipWhitespace();
+
+                    if (detail::StringsEqual(fieldName, "id"))
+                    {
+                        double num;
+                        if (!p.ReadNumber(num))
+                            return "Expected entity id";
+
+                        const uint64_t id = static_cast<uint64_t>(num);
+                        live = FindMapped(entities, id);
+                        if (live.IsNull() || !world.IsAlive(live))
+                        {
+                            live = world.Spawn().Build();
+                            entities.Insert(id, live);
+                            ++result.m_entitiesLoaded;
+                        }
+                    }
+                    else if (live.IsNull())
+                    {
+                        return "Expected entity id first";
+                    }
+                    else if (detail::StringsEqual(fieldName, "parent"))
+                    {
+                        double num;
+                        if (!p.ReadNumber(num))
+                            return "Expected parent id";
+                        parentLinks.PushBack(DeltaParentLink{live, static_cast<uint64_t>(num)});
+                    }
+                    else if (detail::StringsEqual(fieldName, "components"))
+                    {
+                        if (const char* error = ApplyComponents(p, world, registry, live, remapped, result))
+                            return error;
+                    }
+                    else
+                    {
+                        p.SkipValue();
+                    }
+
+                    p.SkipWhitespace();
+                    if (p.Peek() == ',')
+                        p.Advance();
+                    else if (p.Expect('}'))
+                        break;
+                    else
+                        return "Expected ',' or '}' in entity";
+                }
+
+                p.SkipWhitespace();
+                if (p.Peek() == ',')
+                    p.Advance();
+                else if (p.Expect(']'))
+                    return nullptr;
+                else
+                    return "Expected ',' or ']' in entities array";
+            }
+            return "Unterminated entities array";
+        }
+
+        template <size_t MaxComponents>
+        static const char* ApplyComponents(Parser& p, World& world, const ComponentRegistry<MaxComponents>& registry,
+                                           Entity live, wax::Vector<DeltaComponent>& remapped,
+                                           WorldDeserializeResult& result) noexcept
+        {
+            if (!p.Expect('{'))
+                return "Expected components '{'";
+
+            p.SkipWhitespace();
+            if (p.Peek() == '}')
+            {
+                p.Advance();
+                return nullptr;
+            }
+
+            while (p.HasMore())
+            {
+                p.SkipWhitespace();
+                char compName[64]{};
+                if (!p.ReadString(compName, sizeof(compName)))
+                    return "Expected component name";
+                if (!p.Expect(':'))
+                    return "Expected ':'";
+                p.SkipWhitespace();
+
+                const RegisteredComponent* reg = registry.FindByName(compName);
+                if (reg != nullptr && reg->HasReflection())
+                {
+                    if (reg->m_meta.m_size > kMaxComponentSize)
+                        return "Component too large";
+
+                    alignas(16) std::byte buffer[kMaxComponentSize]{};
+                    if (reg->m_meta.m_construct != nullptr)
+                    {
+                        reg->m_meta.m_construct(buffer);
+                    }
+
+                    const auto compResult =
+                        JsonDeserializer::DeserializeComponent(buffer, reg->m_reflection, p.m_data + p.m_pos);
+                    if (compResult.m_success)
+                    {
+                        world.SetComponentRaw(live, reg->m_meta, buffer);
+                    }
+
+                    if (reg->m_meta.m_destruct != nullptr)
+                    {
+                        reg->m_meta.m_destruct(buffer);
+                    }
+
+                    if (!compResult.m_success)
+                        return "Failed to deserialize component";
+
+                    p.SkipValue();
+                    ++result.m_componentsLoaded;
+
+                    const ComponentReflection& reflection = reg->m_reflection;
+                    if (detail::HasEntityFields(reflection.m_fields, reflection.m_fieldCount))
+                    {
+                        remapped.PushBack(DeltaComponent{live, reg});
+                    }
+                }
+                else
+                {
+                    p.SkipValue();
+                    ++result.m_componentsSkipped;
+                }
+
+                p.SkipWhitespace();
+                if (p.Peek() == ',')
+                    p.Advance();
+                else if (p.Expect('}'))
+                    return nullptr;
+                else
+                    return "Expected ',' or '}' in components";
+            }
+            return "Unterminated components";
+        }
     };
 } // namespace queen
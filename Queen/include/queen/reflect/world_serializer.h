@@ -1,12 +1,16 @@
 #pragma once
 
 #include <wax/containers/string.h>
+#include <wax/containers/vector.h>
+
+#include <drone/job_submitter.h>
 
 #include <queen/hierarchy/hierarchy.h>
 #include <queen/reflect/component_registry.h>
 #include <queen/reflect/json_serializer.h>
 #include <queen/world/world.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
@@ -23,8 +27,38 @@ namespace queen
         size_t m_componentsWritten = 0;
     };
 
+    /**
+     * Destination for streamed text, see WorldSerializer::SerializeTo
+     *
+     * m_write returns false to stop the stream. FromFile wraps a
+     * std::FILE*, a POSIX file descriptor can be used through fdopen or a
+     * custom m_write calling write().
+     */
+    struct TextSink
+    {
+        void* m_user = nullptr;
+        bool (*m_write)(void* user, const char* data, size_t size) = nullptr;
+
+        bool Write(const char* data, size_t size) const
+        {
+            return size == 0 || m_write(m_user, data, size);
+        }
+
+        [[nodiscard]] static TextSink FromFile(std::FILE* file) noexcept
+        {
+            return TextSink{file, [](void* user, const char* data, size_t size) {
+                                return std::fwrite(data, 1, size, static_cast<std::FILE*>(user)) == size;
+                            }};
+        }
+    };
+
     namespace detail
     {
+        [[nodiscard]] constexpr bool TicksAtLeast(const ComponentTicks& ticks, Tick since) noexcept
+        {
+            return ticks.m_added.IsAtLeast(since) || ticks.m_changed.IsAtLeast(since);
+        }
+
         template <typename Writer> class WorldSerializerCore
         {
         public:
@@ -33,84 +67,303 @@ namespace queen
             template <size_t MaxComponents>
             WorldSerializeResult Serialize(World& world, const ComponentRegistry<MaxComponents>& registry) noexcept
             {
+                HIVE_PROFILE_SCOPE_N("WorldSerializer::Serialize");
                 WorldSerializeResult result{};
                 m_writer.Reset();
 
-                WriteRaw("{\"version\":1,\"entities\":[");
+                WriteRaw(kWorldHeader);
 
                 bool firstEntity = true;
                 DynamicJsonSerializer componentSerializer{};
 
                 world.ForEachArchetype([&](Archetype<ComponentAllocator>& archetype) {
-                    if (!m_writer.Success())
+                    for (uint32_t row = 0; row < archetype.EntityCount() && m_writer.Success(); ++row)
                     {
-                        return;
-                    }
-
-                    const auto& types = archetype.GetComponentTypes();
-                    for (uint32_t row = 0; row < archetype.EntityCount(); ++row)
-                    {
-                        if (!m_writer.Success())
-                        {
-                            return;
-                        }
-
-                        const Entity entity = archetype.GetEntity(row);
                         if (!firstEntity)
                         {
                             Put(',');
                         }
                         firstEntity = false;
 
-                        WriteRaw("{\"id\":");
-                        WriteUint64(entity.ToU64());
+                        WriteEntity(m_writer, world, registry, archetype, row, componentSerializer, result);
+                    }
+                });
+
+                WriteRaw(kWorldFooter);
+                m_writer.Terminate();
+                result.m_success = m_writer.Success();
+                return result;
+            }
+
+            /**
+             * Serialize with archetype row ranges written in parallel
+             *
+             * Archetypes are cut into ranges of kRowsPerRange rows, each
+             * written by a drone job into its own buffer, and the buffers
+             * are concatenated in order. The output is identical to
+             * Serialize(). Falls back to a serial pass when jobs is invalid.
+             * The world must not be modified while this runs.
+             */
+            template <size_t MaxComponents>
+            WorldSerializeResult SerializeParallel(World& world, const ComponentRegistry<MaxComponents>& registry,
+                                                   drone::JobSubmitter jobs) noexcept
+            {
+                HIVE_PROFILE_SCOPE_N("WorldSerializer::SerializeParallel");
+                WorldSerializeResult result{};
+                m_writer.Reset();
+
+                WriteRaw(kWorldHeader);
+
+                wax::Vector<JsonRowRange> ranges{};
+                BuildRanges(world, ranges);
+
+                wax::Vector<DynamicTextWriter> outputs{};
+                wax::Vector<WorldSerializeResult> results{};
+                outputs.Resize(ranges.Size());
+                results.Resize(ranges.Size());
+                WriteRanges(world, registry, ranges.Data(), outputs.Data(), results.Data(), ranges.Size(), jobs);
+
+                for (size_t i = 0; i < ranges.Size(); ++i)
+                {
+                    if (i > 0)
+                    {
+                        Put(',');
+                    }
+                    m_writer.Write(outputs[i].CStr(), outputs[i].Size());
+                    Accumulate(result, results[i]);
+                }
+
+                WriteRaw(kWorldFooter);
+                m_writer.Terminate();
+                result.m_success = m_writer.Success();
+                return result;
+            }
+
+            /**
+             * Serialize straight to a sink instead of the serializer's buffer
+             *
+             * Row ranges are written in batches of a few ranges per worker
+             * (in parallel when jobs is valid) and handed to the sink in
+             * order, so memory stays bounded by one batch of text whatever
+             * the world size. The serializer's own buffer is left empty.
+             *
+             * @return m_success is false if the sink failed a write
+             */
+            template <size_t MaxComponents>
+            WorldSerializeResult SerializeTo(World& world, const ComponentRegistry<MaxComponents>& registry,
+                                             const TextSink& sink, drone::JobSubmitter jobs = {}) noexcept
+            {
+                HIVE_PROFILE_SCOPE_N("WorldSerializer::SerializeTo");
+                WorldSerializeResult result{};
+                m_writer.Reset();
 
-                        const Entity parent = world.GetParent(entity);
-                        if (!parent.IsNull())
+                bool ok = sink.Write(kWorldHeader, sizeof(kWorldHeader) - 1);
+
+                wax::Vector<JsonRowRange> ranges{};
+                BuildRanges(world, ranges);
+
+                const size_t batchSize = jobs.IsValid() ? (jobs.WorkerCount() + 1) * 4 : 1;
+                const size_t outputCount = std::min(batchSize, ranges.Size());
+                wax::Vector<DynamicTextWriter> outputs{};
+                wax::Vector<WorldSerializeResult> results{};
+                outputs.Resize(outputCount);
+                results.Resize(outputCount);
+
+                for (size_t first = 0; first < ranges.Size() && ok; first += batchSize)
+                {
+                    const size_t count = std::min(batchSize, ranges.Size() - first);
+                    WriteRanges(world, registry, ranges.Data() + first, outputs.Data(), results.Data(), count, jobs);
+
+                    for (size_t i = 0; i < count && ok; ++i)
+                    {
+                        ok = (first + i == 0 || sink.Write(",", 1)) && sink.Write(outputs[i].CStr(), outputs[i].Size());
+                        Accumulate(result, results[i]);
+                    }
+                }
+
+                ok = ok && sink.Write(kWorldFooter, sizeof(kWorldFooter) - 1);
+                result.m_success = ok;
+                return result;
+            }
+
+            /**
+             * Serialize what changed at tick since or later
+             *
+             * Emits, in this order: whether the world was cleared, despawned
+             * entities, entities whose Parent was removed, removed
+             * components, then one object per entity with the components
+             * added or changed since the tick (and its parent if that
+             * changed). Sparse components come in separate objects for the
+             * same id. ApplyDelta replays the sections in that order.
+             *
+             * Column and tick block summaries (Column::MaxTicks and
+             * BlockTicks) let unchanged archetypes and 64-row blocks be
+             * skipped without touching their rows. Despawns and removals
+             * come from the World's RemovalLog, enable it with
+             * World::TrackRemovals(true) before the first tick covered.
+             *
+             * since is inclusive: pass the CurrentTick() of the previous
+             * delta so nothing done later in that tick is lost. Changes made
+             * in that tick before the previous delta are sent twice, which
+             * applying is idempotent for. Tick 0 gives a full delta that
+             * ApplyDelta can use to seed an empty world.
+             *
+             * Limitations:
+             * - Structural moves reset component ticks, so every component
+             *   of an entity that gained or lost a component is resent
+             * - Entities without a registered component are not sent
+             */
+            template <size_t MaxComponents>
+            WorldSerializeResult SerializeDelta(World& world, const ComponentRegistry<MaxComponents>& registry,
+                                                Tick since) noexcept
+            {
+                HIVE_PROFILE_SCOPE_N("WorldSerializer::SerializeDelta");
+                WorldSerializeResult result{};
+                m_writer.Reset();
+
+                WriteRaw("{\"version\":1,\"since\":");
+                WriteUint64(since.m_value);
+                WriteRaw(",\"tick\":");
+                WriteUint64(world.CurrentTick().m_value);
+
+                const RemovalLog& log = world.GetRemovalLog();
+                const auto& records = log.Records();
+                const size_t firstRecord = log.FirstSince(since);
+                const bool cleared = firstRecord < records.Size() && records[firstRecord].IsClear();
+
+                WriteRaw(cleared ? ",\"cleared\":true" : ",\"cleared\":false");
+
+                WriteRaw(",\"despawned\":[");
+                bool first = true;
+                for (size_t i = firstRecord; i < records.Size(); ++i)
+                {
+                    if (records[i].IsDespawn())
+                    {
+                        WriteSeparatedId(first, records[i].m_entity);
+                    }
+                }
+
+                WriteRaw("],\"unparented\":[");
+                first = true;
+                for (size_t i = firstRecord; i < records.Size(); ++i)
+                {
+                    if (!records[i].IsClear() && records[i].m_typeId == TypeIdOf<Parent>())
+                    {
+                        WriteSeparatedId(first, records[i].m_entity);
+                    }
+                }
+
+                WriteRaw("],\"removed\":[");
+                first = true;
+                for (size_t i = firstRecord; i < records.Size(); ++i)
+                {
+                    const RegisteredComponent* reg =
+                        records[i].IsClear() ? nullptr : registry.Find(records[i].m_typeId);
+                    if (reg == nullptr || !reg->HasReflection())
+                    {
+                        continue;
+                    }
+
+                    if (!first)
+                    {
+                        Put(',');
+                    }
+                    first = false;
+                    WriteRaw("{\"id\":");
+                    WriteUint64(records[i].m_entity.ToU64());
+                    WriteRaw(",\"component\":\"");
+                    WriteRaw(reg->m_reflection.m_name);
+                    WriteRaw("\"}");
+                }
+
+                WriteRaw("],\"entities\":[");
+                first = true;
+                DynamicJsonSerializer componentSerializer{};
+
+                world.ForEachArchetype([&](Archetype<ComponentAllocator>& archetype) {
+                    Table<ComponentAllocator>& table = archetype.GetTable();
+
+                    bool archetypeChanged = false;
+                    for (size_t c = 0; c < table.ColumnCount() && !archetypeChanged; ++c)
+                    {
+                        archetypeChanged = TicksAtLeast(table.GetColumnAt(c).MaxTicks(), since);
+                    }
+                    if (!archetypeChanged)
+                    {
+                        return;
+                    }
+
+                    const Column<ComponentAllocator>* parentColumn = table.template GetColumn<Parent>();
+                    const size_t rows = table.RowCount();
+                    constexpr size_t kBlockSize = Column<ComponentAllocator>::kTickBlockSize;
+
+                    for (size_t blockStart = 0; blockStart < rows; blockStart += kBlockSize)
+                    {
+                        const size_t block = blockStart / kBlockSize;
+                        bool blockChanged = false;
+                        for (size_t c = 0; c < table.ColumnCount() && !blockChanged; ++c)
                         {
-                            WriteRaw(",\"parent\":");
-                            WriteUint64(parent.ToU64());
+                            blockChanged = TicksAtLeast(table.GetColumnAt(c).BlockTicks(block), since);
+                        }
+                        if (!blockChanged)
+                        {
+                            continue;
                         }
 
-                        WriteRaw(",\"components\":{");
-
-                        bool firstComp = true;
-                        for (size_t c = 0; c < types.Size(); ++c)
+                        const size_t blockEnd = std::min(rows, blockStart + kBlockSize);
+                        for (size_t row = blockStart; row < blockEnd; ++row)
                         {
-                            const TypeId typeId = types[c];
-                            if (typeId == TypeIdOf<Parent>() || typeId == TypeIdOf<Children>())
+                            const Entity entity = table.GetEntity(static_cast<uint32_t>(row));
+                            bool open = false;
+
+                            if (parentColumn != nullptr && TicksAtLeast(parentColumn->GetTicks(row), since))
                             {
-                                continue;
+                                OpenDeltaEntity(first, open, entity);
+                                WriteRaw(",\"parent\":");
+                                WriteUint64(static_cast<const Parent*>(parentColumn->GetRaw(row))->m_entity.ToU64());
                             }
 
-                            const RegisteredComponent* reg = registry.Find(typeId);
-                            if (reg == nullptr || !reg->HasReflection())
+                            for (size_t c = 0; c < table.ColumnCount(); ++c)
                             {
-                                continue;
+                                const Column<ComponentAllocator>& column = table.GetColumnAt(c);
+                                if (TicksAtLeast(column.GetTicks(row), since) &&
+                                    WriteDeltaComponent(first, open, entity, registry, column.GetTypeId(),
+                                                        column.GetRaw(row), componentSerializer))
+                                {
+                                    ++result.m_componentsWritten;
+                                }
                             }
 
-                            if (!firstComp)
+                            if (open)
                             {
-                                Put(',');
+                                CloseDeltaEntity(open);
+                                ++result.m_entitiesWritten;
                             }
-                            firstComp = false;
-
-                            Put('"');
-                            WriteRaw(reg->m_reflection.m_name);
-                            Put('"');
-                            Put(':');
+                        }
+                    }
+                });
 
-                            const void* data = archetype.GetComponentRaw(row, typeId);
-                            componentSerializer.SerializeComponent(data, reg->m_reflection);
-                            WriteRaw(componentSerializer.CStr());
+                const auto& sparse = world.GetSparseStorages();
+                for (size_t s = 0; s < sparse.StorageCount(); ++s)
+                {
+                    const Column<ComponentAllocator>& column = sparse.GetStorage(s)->GetColumn();
+                    if (!TicksAtLeast(column.MaxTicks(), since))
+                    {
+                        continue;
+                    }
 
+                    for (size_t i = 0; i < column.Size(); ++i)
+                    {
+                        bool open = false;
+                        if (TicksAtLeast(column.GetTicks(i), since) &&
+                            WriteDeltaComponent(first, open, sparse.GetStorage(s)->EntityAt(i), registry,
+                                                column.GetTypeId(), column.GetRaw(i), componentSerializer))
+                        {
+                            CloseDeltaEntity(open);
                             ++result.m_componentsWritten;
                         }
-
-                        WriteRaw("}}");
-                        ++result.m_entitiesWritten;
                     }
-                });
+                }
 
                 WriteRaw("]}");
                 m_writer.Terminate();
@@ -157,15 +410,227 @@ namespace queen
 
             void WriteUint64(uint64_t v) noexcept
             {
-                char tmp[24];
-                const int count = std::snprintf(tmp, sizeof(tmp), "%llu", static_cast<unsigned long long>(v));
-                for (int i = 0; i < count; ++i)
+                WriteId(m_writer, v);
+            }
+
+            static constexpr char kWorldHeader[] = "{\"version\":1,\"entities\":[";
+            static constexpr char kWorldFooter[] = "]}";
+            static constexpr uint32_t kRowsPerRange = 512;
+
+            struct JsonRowRange
+            {
+                Archetype<ComponentAllocator>* m_archetype = nullptr;
+                uint32_t m_begin = 0;
+                uint32_t m_end = 0;
+            };
+
+            template <size_t MaxComponents> struct RangeJob
+            {
+                World* m_world;
+                const ComponentRegistry<MaxComponents>* m_registry;
+                const JsonRowRange* m_ranges;
+                DynamicTextWriter* m_outputs;
+                WorldSerializeResult* m_results;
+            };
+
+            template <typename Out> static void WriteId(Out& out, uint64_t v) noexcept
+            {
+                char tmp[kNumberChars];
+                out.Write(tmp, FormatNumber(tmp, v));
+            }
+
+            static void Accumulate(WorldSerializeResult& total, const WorldSerializeResult& part) noexcept
+            {
+                total.m_entitiesWritten += part.m_entitiesWritten;
+                total.m_componentsWritten += part.m_componentsWritten;
+            }
+
+            static void BuildRanges(World& world, wax::Vector<JsonRowRange>& ranges)
+            {
+                world.ForEachArchetype([&](Archetype<ComponentAllocator>& archetype) {
+                    const uint32_t rows = static_cast<uint32_t>(archetype.EntityCount());
+                    for (uint32_t begin = 0; begin < rows; begin += kRowsPerRange)
+                    {
+                        ranges.PushBack(JsonRowRange{&archetype, begin, std::min(rows, begin + kRowsPerRange)});
+                    }
+                });
+            }
+
+            // Write ranges[i] into outputs[i], as drone jobs when jobs is valid
+            template <size_t MaxComponents>
+            static void WriteRanges(World& world, const ComponentRegistry<MaxComponents>& registry,
+                                    const JsonRowRange* ranges, DynamicTextWriter* outputs,
+                                    WorldSerializeResult* results, size_t count, drone::JobSubmitter& jobs)
+            {
+                RangeJob<MaxComponents> job{&world, &registry, ranges, outputs, results};
+                if (!jobs.IsValid() || count <= 1)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        WriteRange(job, i);
+                    }
+                    return;
+                }
+
+                jobs.ParallelFor(
+                    0, count,
+                    [](size_t index, void* data) { WriteRange(*static_cast<RangeJob<MaxComponents>*>(data), index); },
+                    &job, 1);
+            }
+
+            template <size_t MaxComponents> static void WriteRange(const RangeJob<MaxComponents>& job, size_t index)
+            {
+                const JsonRowRange& range = job.m_ranges[index];
+                DynamicTextWriter& out = job.m_outputs[index];
+                WorldSerializeResult& result = job.m_results[index];
+                DynamicJsonSerializer componentSerializer{};
+
+                out.Reset();
+                result = WorldSerializeResult{};
+                for (uint32_t row = range.m_begin; row < range.m_end; ++row)
                 {
-                    Put(tmp[i]);
+                    if (row > range.m_begin)
+                    {
+                        out.Put(',');
+                    }
+                    WriteEntity(out, *job.m_world, *job.m_registry, *range.m_archetype, row, componentSerializer,
+                                result);
                 }
             }
 
+            // One {"id":..,"parent":..,"components":{..}} object, shared by the serial and parallel paths
+            template <typename Out, size_t MaxComponents>
+            static void WriteEntity(Out& out, World& world, const ComponentRegistry<MaxComponents>& registry,
+                                    Archetype<ComponentAllocator>& archetype, uint32_t row,
+                                    DynamicJsonSerializer& componentSerializer, WorldSerializeResult& result)
+            {
+                const Entity entity = archetype.GetEntity(row);
+                out.WriteRaw("{\"id\":");
+                WriteId(out, entity.ToU64());
+
+                const Entity parent = world.GetParent(entity);
+                if (!parent.IsNull())
+                {
+                    out.WriteRaw(",\"parent\":");
+                    WriteId(out, parent.ToU64());
+                }
+
+                out.WriteRaw(",\"components\":{");
+
+                bool firstComp = true;
+                auto writeComponent = [&](TypeId typeId, const void* data) {
+                    const RegisteredComponent* reg = registry.Find(typeId);
+                    if (reg == nullptr || !reg->HasReflection())
+                    {
+                        return;
+                    }
+
+                    if (!firstComp)
+                    {
+                        out.Put(',');
+                    }
+                    firstComp = false;
+
+                    out.Put('"');
+                    out.WriteRaw(reg->m_reflection.m_name);
+                    out.WriteRaw("\":");
+
+                    componentSerializer.SerializeComponent(data, reg->m_reflection);
+                    out.Write(componentSerializer.CStr(), componentSerializer.Size());
+
+                    ++result.m_componentsWritten;
+                };
+
+                const auto& types = archetype.GetComponentTypes();
+                for (size_t c = 0; c < types.Size(); ++c)
+                {
+                    const TypeId typeId = types[c];
+                    if (typeId == TypeIdOf<Parent>() || typeId == TypeIdOf<Children>())
+                    {
+                        continue;
+                    }
+
+                    writeComponent(typeId, archetype.GetComponentRaw(row, typeId));
+                }
+
+                // Sparse components are not in the archetype
+                const auto& sparse = world.GetSparseStorages();
+                for (size_t s = 0; s < sparse.StorageCount(); ++s)
+                {
+                    const SparseStorage<ComponentAllocator>* storage = sparse.GetStorage(s);
+                    if (const void* data = storage->Get(entity))
+                    {
+                        writeComponent(storage->GetTypeId(), data);
+                    }
+                }
+
+                out.WriteRaw("}}");
+                ++result.m_entitiesWritten;
+            }
+
+            void WriteSeparatedId(bool& first, Entity entity) noexcept
+            {
+                if (!first)
+                {
+                    Put(',');
+                }
+                first = false;
+                WriteUint64(entity.ToU64());
+            }
+
+            // Entity objects of a delta are opened on their first changed value
+            void OpenDeltaEntity(bool& first, bool& open, Entity entity) noexcept
+            {
+                if (open)
+                {
+                    return;
+                }
+
+                if (!first)
+                {
+                    Put(',');
+                }
+                first = false;
+                open = true;
+                WriteRaw("{\"id\":");
+                WriteUint64(entity.ToU64());
+                m_componentsOpen = false;
+            }
+
+            void CloseDeltaEntity(bool& open) noexcept
+            {
+                WriteRaw(m_componentsOpen ? "}}" : "}");
+                open = false;
+            }
+
+            template <size_t MaxComponents>
+            bool WriteDeltaComponent(bool& first, bool& open, Entity entity,
+                                     const ComponentRegistry<MaxComponents>& registry, TypeId typeId,
+                                     const void* data, DynamicJsonSerializer& componentSerializer) noexcept
+            {
+                if (typeId == TypeIdOf<Parent>() || typeId == TypeIdOf<Children>())
+                {
+                    return false;
+                }
+
+                const RegisteredComponent* reg = registry.Find(typeId);
+                if (reg == nullptr || !reg->HasReflection())
+                {
+                    return false;
+                }
+
+                OpenDeltaEntity(first, open, entity);
+                WriteRaw(m_componentsOpen ? ",\"" : ",\"components\":{\"");
+                m_componentsOpen = true;
+                WriteRaw(reg->m_reflection.m_name);
+                WriteRaw("\":");
+                componentSerializer.SerializeComponent(data, reg->m_reflection);
+                WriteRaw(componentSerializer.CStr());
+                return true;
+            }
+
             Writer m_writer{};
+            bool m_componentsOpen{false};
         };
     } // namespace detail
 
@@ -180,6 +645,13 @@ namespace queen
     {
     };
 
+    /**
+     * Serializes a World to JSON into a growing string
+     *
+     * Large worlds can use SerializeParallel() to write archetype row
+     * ranges on drone workers, or SerializeTo() to stream the document to
+     * a TextSink (file, socket) without holding all of it in memory.
+     */
     class DynamicWorldSerializer : public detail::WorldSerializerCore<detail::DynamicTextWriter>
     {
     public:
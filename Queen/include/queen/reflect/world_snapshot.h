@@ -0,0 +1,705 @@
+#pragma once
+
+#include <wax/containers/hash_map.h>
+#include <wax/containers/vector.h>
+#include <wax/serialization/binary_reader.h>
+#include <wax/serialization/binary_writer.h>
+#include <wax/serialization/byte_span.h>
+
+#include <queen/hierarchy/hierarchy.h>
+#include <queen/reflect/component_registry.h>
+#include <queen/reflect/world_deserializer.h>
+#include <queen/reflect/world_serializer.h>
+#include <queen/world/world.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace queen
+{
+    /**
+     * How a snapshot column stores its rows
+     */
+    enum class SnapshotEncoding : uint8_t
+    {
+        RAW,     // Row bytes as laid out in memory, trivially copyable components
+        FIELDS,  // Reflected fields back to back, other reflectable components
+        REBUILT, // No row bytes, rebuilt on load from the other columns (Children)
+    };
+
+    namespace detail
+    {
+        // Bytes a FIELDS row takes: the reflected fields without padding
+        [[nodiscard]] inline size_t SnapshotFieldBytes(const ComponentReflection& reflection) noexcept
+        {
+            size_t bytes = 0;
+            for (size_t i = 0; i < reflection.m_fieldCount; ++i)
+            {
+                bytes += reflection.m_fields[i].m_size;
+            }
+            return bytes;
+        }
+    } // namespace detail
+
+    /**
+     * Binary world snapshot, column by column
+     *
+     * Save walks the non-empty archetypes and writes, per archetype, its
+     * entity ids followed by one block per registered component. Trivially
+     * copyable components are written as raw column bytes (one copy per
+     * column, or per chunk for chunked tables), other components with
+     * reflection as their reflected fields. Components that are neither
+     * are skipped. Parent is saved as a raw column and Children as an empty
+     * one, so the hierarchy needs no registry entry. Sparse components get
+     * their own section.
+     *
+     * Load spawns each archetype block with a single World::SpawnBatchRaw
+     * call, so every column is allocated once and raw blocks are copied
+     * straight from the snapshot bytes. The input is only read, so a
+     * memory-mapped file (e.g. nectar::MappedFile::View()) can be loaded
+     * without an intermediate copy. Loading is additive: entities get new
+     * ids, and Entity fields of reflected components as well as the
+     * hierarchy are remapped to them. Parented entities are spawned in
+     * their final archetype, their Parent rows are remapped once every
+     * block is loaded and the Children lists are filled in the same pass.
+     *
+     * Format (native endianness and layout, little-endian hosts):
+     * ┌──────────────────────────────────────────────────────────────┐
+     * │ magic: u32 "QSNP" | version: u32                             │
+     * │ block_count: u32 | entity_count: u64                         │
+     * │ block: rows: u32 | columns: u32                              │
+     * │        column headers: type_id u64, row_bytes u32, enc u8    │
+     * │        entity ids: u64[rows]                                 │
+     * │        per column: byte_count u64, bytes                     │
+     * │ sparse_count: u32                                            │
+     * │ sparse: header, count u32, ids u64[count], byte_count, bytes │
+     * └──────────────────────────────────────────────────────────────┘
+     *
+     * Performance characteristics:
+     * - Save: O(entities) for ids, one bulk copy per raw column
+     * - Load: one SpawnBatchRaw per archetype, O(entities) id remap,
+     *   O(rows) Entity field remap only for components that have one,
+     *   O(children) hierarchy remap without archetype moves
+     *
+     * Limitations:
+     * - Raw blocks are only portable between builds with the same
+     *   component layout and endianness, TypeId and size are checked
+     * - Entity fields are only remapped for components with reflection
+     * - Unknown components and mismatched layouts are skipped on load
+     * - Corrupt input fails the load but keeps the blocks spawned so far
+     *
+     * Example:
+     * @code
+     *   wax::BinaryWriter writer{alloc};
+     *   WorldSnapshot::Save(world, registry, writer);
+     *   WriteFile("autosave.bin", writer.View());
+     *
+     *   nectar::MappedFile file = nectar::MappedFile::Open("autosave.bin");
+     *   WorldSnapshot::Load(freshWorld, registry, file.View());
+     * @endcode
+     */
+    class WorldSnapshot
+    {
+    public:
+        static constexpr uint32_t kMagic = 0x504E5351; // "QSNP"
+        static constexpr uint32_t kVersion = 2;
+
+        template <size_t MaxComponents>
+        static WorldSerializeResult Save(World& world, const ComponentRegistry<MaxComponents>& registry,
+                                         wax::BinaryWriter& out)
+        {
+            HIVE_PROFILE_SCOPE_N("WorldSnapshot::Save");
+            WorldSerializeResult result{};
+
+            // Size the output once, BinaryWriter grows to the exact size on every append
+            uint32_t blockCount = 0;
+            size_t entityCount = 0;
+            size_t estimate = kHeaderBytes + sizeof(uint32_t);
+            world.ForEachArchetype([&](const Archetype<ComponentAllocator>& archetype) {
+                const auto& types = archetype.GetComponentTypes();
+                size_t rowBytes = sizeof(uint64_t);
+                for (size_t c = 0; c < types.Size(); ++c)
+                {
+                    const RegisteredComponent* component = FindComponent(registry, types[c]);
+                    rowBytes += component != nullptr ? component->m_meta.m_size : 0;
+                }
+                estimate += kBlockBytes + types.Size() * kColumnBytes + archetype.EntityCount() * rowBytes;
+                ++blockCount;
+                entityCount += archetype.EntityCount();
+            });
+
+            const auto& sparse = world.GetSparseStorages();
+            for (size_t s = 0; s < sparse.StorageCount(); ++s)
+            {
+                const SparseStorage<ComponentAllocator>* storage = sparse.GetStorage(s);
+                estimate += kColumnBytes + sizeof(uint32_t) +
+                            storage->Count() * (sizeof(uint64_t) + storage->GetColumn().GetMeta().m_size);
+            }
+            out.Reserve(out.Size() + estimate);
+
+            out.Write<uint32_t>(kMagic);
+            out.Write<uint32_t>(kVersion);
+            out.Write<uint32_t>(blockCount);
+            out.Write<uint64_t>(entityCount);
+
+            wax::Vector<SavedColumn> columns{world.GetComponentAllocator()};
+            wax::Vector<uint64_t> ids{world.GetComponentAllocator()};
+
+            world.ForEachArchetype([&](Archetype<ComponentAllocator>& archetype) {
+                const uint32_t rows = static_cast<uint32_t>(archetype.EntityCount());
+                Table<ComponentAllocator>& table = archetype.GetTable();
+
+                columns.Clear();
+                const auto& types = archetype.GetComponentTypes();
+                for (size_t c = 0; c < types.Size(); ++c)
+                {
+                    SavedColumn column{};
+                    if (DescribeColumn(FindComponent(registry, types[c]), column))
+                    {
+                        column.m_column = table.GetColumnByTypeId(types[c]);
+                        columns.PushBack(column);
+                    }
+                }
+
+                out.Write<uint32_t>(rows);
+                out.Write<uint32_t>(static_cast<uint32_t>(columns.Size()));
+                for (size_t c = 0; c < columns.Size(); ++c)
+                {
+                    WriteColumnHeader(out, columns[c]);
+                }
+
+                ids.Resize(rows);
+                for (uint32_t row = 0; row < rows; ++row)
+                {
+                    ids[row] = archetype.GetEntity(row).ToU64();
+                }
+                out.WriteBytes(ids.Data(), rows * sizeof(uint64_t));
+
+                for (size_t c = 0; c < columns.Size(); ++c)
+                {
+                    const SavedColumn& column = columns[c];
+                    out.Write<uint64_t>(uint64_t{rows} * column.m_rowBytes);
+                    for (size_t segment = 0; segment < rows;)
+                    {
+                        const size_t segmentEnd = std::min(size_t{rows}, table.ChunkEnd(segment));
+                        WriteRows(out, column, column.m_column->GetRaw(segment), segmentEnd - segment);
+                        segment = segmentEnd;
+                    }
+                    if (!IsHierarchy(column.m_component))
+                    {
+                        result.m_componentsWritten += rows;
+                    }
+                }
+
+                result.m_entitiesWritten += rows;
+            });
+
+            columns.Clear();
+            for (size_t s = 0; s < sparse.StorageCount(); ++s)
+            {
+                SavedColumn column{};
+                const SparseStorage<ComponentAllocator>* storage = sparse.GetStorage(s);
+                if (!storage->IsEmpty() && DescribeColumn(registry.Find(storage->GetTypeId()), column))
+                {
+                    column.m_sparse = storage;
+                    columns.PushBack(column);
+                }
+            }
+
+            out.Write<uint32_t>(static_cast<uint32_t>(columns.Size()));
+            for (size_t c = 0; c < columns.Size(); ++c)
+            {
+                const SavedColumn& column = columns[c];
+                const SparseStorage<ComponentAllocator>* storage = column.m_sparse;
+                const uint32_t count = static_cast<uint32_t>(storage->Count());
+
+                WriteColumnHeader(out, column);
+                out.Write<uint32_t>(count);
+                ids.Resize(count);
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    ids[i] = storage->EntityAt(i).ToU64();
+                }
+                out.WriteBytes(ids.Data(), count * sizeof(uint64_t));
+
+                out.Write<uint64_t>(uint64_t{count} * column.m_rowBytes);
+                WriteRows(out, column, storage->GetColumn().GetRaw(0), count);
+                result.m_componentsWritten += count;
+            }
+
+            result.m_success = true;
+            return result;
+        }
+
+        template <size_t MaxComponents>
+        static WorldDeserializeResult Load(World& world, const ComponentRegistry<MaxComponents>& registry,
+                                           wax::ByteSpan data)
+        {
+            HIVE_PROFILE_SCOPE_N("WorldSnapshot::Load");
+            WorldDeserializeResult result{};
+            wax::BinaryReader reader{data};
+
+            uint32_t magic = 0;
+            uint32_t version = 0;
+            uint32_t blockCount = 0;
+            uint64_t entityCount = 0;
+            if (!reader.TryRead(magic) || magic != kMagic)
+                return Fail(result, "Not a world snapshot");
+            if (!reader.TryRead(version) || version != kVersion)
+                return Fail(result, "Unsupported snapshot version");
+            if (!reader.TryRead(blockCount) || !reader.TryRead(entityCount))
+                return Fail(result, "Truncated snapshot header");
+            if (entityCount > reader.Remaining() / sizeof(uint64_t))
+                return Fail(result, "Entity count exceeds snapshot size");
+
+            ComponentAllocator& allocator = world.GetComponentAllocator();
+            wax::HashMap<uint64_t, Entity> remap{allocator, static_cast<size_t>(entityCount)};
+            wax::Vector<Entity> live{allocator};
+            live.Resize(static_cast<size_t>(entityCount));
+
+            wax::Vector<LoadedColumn> columns{allocator};
+            wax::Vector<SpawnBatchComponent> spawn{allocator};
+            wax::Vector<RemapRange> remapRanges{allocator};
+            wax::Vector<HierarchyRange> parentRanges{allocator};
+            wax::Vector<HierarchyRange> childrenRanges{allocator};
+            size_t loaded = 0;
+
+            for (uint32_t b = 0; b < blockCount; ++b)
+            {
+                uint32_t rows = 0;
+                uint32_t columnCount = 0;
+                if (!reader.TryRead(rows) || !reader.TryRead(columnCount))
+                    return Fail(result, "Truncated archetype block");
+                if (rows > live.Size() - loaded)
+                    return Fail(result, "Archetype block exceeds entity count");
+
+                columns.Clear();
+                for (uint32_t c = 0; c < columnCount; ++c)
+                {
+                    LoadedColumn column{};
+                    if (!ReadColumnHeader(reader, registry, column))
+                        return Fail(result, "Truncated column header");
+                    columns.PushBack(column);
+                }
+
+                wax::ByteSpan idBytes{};
+                if (!reader.TryReadBytes(size_t{rows} * sizeof(uint64_t), idBytes))
+                    return Fail(result, "Truncated entity ids");
+
+                spawn.Clear();
+                bool valid = true;
+                bool hasChildren = false;
+                for (size_t c = 0; c < columns.Size(); ++c)
+                {
+                    LoadedColumn& column = columns[c];
+                    if (!ReadColumnBytes(reader, column, rows))
+                    {
+                        valid = false;
+                        break;
+                    }
+
+                    if (column.m_component == nullptr)
+                    {
+                        result.m_componentsSkipped += rows;
+                        continue;
+                    }
+
+                    // Parent rows are spawned unlinked and remapped from the saved bytes once every block is
+                    // loaded. Children rows are zero-filled, it has no default constructor
+                    if (IsHierarchy(column.m_component))
+                    {
+                        if (column.m_encoding == SnapshotEncoding::REBUILT)
+                        {
+                            hasChildren = true;
+                        }
+                        else
+                        {
+                            parentRanges.PushBack(HierarchyRange{loaded, rows, column.m_bytes});
+                        }
+                        spawn.PushBack(SpawnBatchComponent{column.m_component->m_meta});
+                        continue;
+                    }
+
+                    spawn.PushBack(SpawnBatchComponent{column.m_component->m_meta,
+                                                       DecodeRows(allocator, column, rows),
+                                                       column.m_component->m_meta.m_size});
+                    result.m_componentsLoaded += rows;
+                }
+
+                if (valid)
+                {
+                    world.SpawnBatchRaw(rows, spawn.Data(), spawn.Size(), live.Data() + loaded);
+                }
+
+                for (size_t c = 0; c < columns.Size(); ++c)
+                {
+                    ReleaseDecoded(allocator, columns[c], rows);
+                }
+
+                if (!valid)
+                    return Fail(result, "Truncated column data");
+
+                if (hasChildren)
+                {
+                    for (uint32_t row = 0; row < rows; ++row)
+                    {
+                        new (world.GetComponentRaw(live[loaded + row], TypeIdOf<Children>()))
+                            Children{world.GetPersistentAllocator()};
+                    }
+                    childrenRanges.PushBack(HierarchyRange{loaded, rows, {}});
+                }
+
+                for (uint32_t row = 0; row < rows; ++row)
+                {
+                    remap.Insert(idBytes.Read<uint64_t>(row * sizeof(uint64_t)), live[loaded + row]);
+                }
+
+                for (size_t c = 0; c < columns.Size(); ++c)
+                {
+                    if (columns[c].m_component != nullptr && columns[c].m_hasEntityFields)
+                    {
+                        remapRanges.PushBack(RemapRange{columns[c].m_component, loaded, rows});
+                    }
+                }
+
+                loaded += rows;
+                result.m_entitiesLoaded += rows;
+            }
+
+            uint32_t sparseCount = 0;
+            if (!reader.TryRead(sparseCount))
+                return Fail(result, "Truncated sparse section");
+
+            wax::Vector<Entity> sparseEntities{allocator};
+            for (uint32_t s = 0; s < sparseCount; ++s)
+            {
+                LoadedColumn column{};
+                uint32_t count = 0;
+                wax::ByteSpan idBytes{};
+                if (!ReadColumnHeader(reader, registry, column) || !reader.TryRead(count) ||
+                    !reader.TryReadBytes(size_t{count} * sizeof(uint64_t), idBytes) ||
+                    !ReadColumnBytes(reader, column, count))
+                {
+                    return Fail(result, "Truncated sparse component");
+                }
+
+                if (column.m_component == nullptr)
+                {
+                    result.m_componentsSkipped += count;
+                    continue;
+                }
+
+                const ComponentMeta& meta = column.m_component->m_meta;
+                const auto* rows = static_cast<const std::byte*>(DecodeRows(allocator, column, count));
+                const size_t firstRemap = sparseEntities.Size();
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    const Entity* entity = remap.Find(idBytes.Read<uint64_t>(i * sizeof(uint64_t)));
+                    if (entity != nullptr)
+                    {
+                        world.SetSparseRaw(*entity, meta, rows + i * meta.m_size);
+                        sparseEntities.PushBack(*entity);
+                        ++result.m_componentsLoaded;
+                    }
+                }
+                ReleaseDecoded(allocator, column, count);
+
+                if (column.m_hasEntityFields)
+                {
+                    remapRanges.PushBack(RemapRange{column.m_component, firstRemap, sparseEntities.Size() - firstRemap,
+                                                    true});
+                }
+            }
+
+            for (const RemapRange& range : remapRanges)
+            {
+                const Entity* entities = range.m_sparse ? sparseEntities.Data() : live.Data();
+                const ComponentReflection& reflection = range.m_component->m_reflection;
+                for (size_t i = range.m_first; i < range.m_first + range.m_count; ++i)
+                {
+                    void* component = world.GetComponentRaw(entities[i], range.m_component->m_meta.m_typeId);
+                    detail::RemapMappedFields(component, reflection.m_fields, reflection.m_fieldCount, remap);
+                }
+            }
+
+            // Children are listed in block order, as one SetParent per saved link would list them
+            for (const HierarchyRange& range : parentRanges)
+            {
+                for (size_t i = 0; i < range.m_count; ++i)
+                {
+                    Parent saved{};
+                    std::memcpy(&saved, range.m_parents.Data() + i * sizeof(Parent), sizeof(Parent));
+                    const Entity child = live[range.m_first + i];
+                    const Entity* parent = remap.Find(saved.m_entity.ToU64());
+                    Children* children = parent != nullptr ? world.Get<Children>(*parent) : nullptr;
+                    if (children != nullptr)
+                    {
+                        world.Get<Parent>(child)->m_entity = *parent;
+                        children->Add(child);
+                    }
+                }
+            }
+
+            // The OnAdd hooks SetParent fired (e.g. disabled propagation), by handle since callbacks may move rows
+            TriggerHierarchyAdds<Parent>(world, live, parentRanges);
+            TriggerHierarchyAdds<Children>(world, live, childrenRanges);
+
+            result.m_success = true;
+            return result;
+        }
+
+    private:
+        static constexpr size_t kHeaderBytes = 3 * sizeof(uint32_t) + sizeof(uint64_t);
+        static constexpr size_t kBlockBytes = 2 * sizeof(uint32_t);
+        static constexpr size_t kColumnBytes = sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint64_t);
+
+        struct SavedColumn
+        {
+            const RegisteredComponent* m_component{nullptr};
+            const Column<ComponentAllocator>* m_column{nullptr};
+            const SparseStorage<ComponentAllocator>* m_sparse{nullptr};
+            SnapshotEncoding m_encoding{SnapshotEncoding::RAW};
+            uint32_t m_rowBytes{0};
+        };
+
+        struct LoadedColumn
+        {
+            const RegisteredComponent* m_component{nullptr}; // nullptr when skipped
+            SnapshotEncoding m_encoding{SnapshotEncoding::RAW};
+            uint32_t m_rowBytes{0};
+            bool m_hasEntityFields{false};
+            wax::ByteSpan m_bytes{};
+            void* m_decoded{nullptr};
+        };
+
+        // Rows of one block holding Parent (with its saved bytes) or Children
+        struct HierarchyRange
+        {
+            size_t m_first{0};
+            size_t m_count{0};
+            wax::ByteSpan m_parents{};
+        };
+
+        struct RemapRange
+        {
+            const RegisteredComponent* m_component{nullptr};
+            size_t m_first{0};
+            size_t m_count{0};
+            bool m_sparse{false};
+        };
+
+        static WorldDeserializeResult Fail(WorldDeserializeResult& result, const char* error) noexcept
+        {
+            result.m_error = error;
+            return result;
+        }
+
+        // Parent and Children are saved without a registry entry
+        template <size_t MaxComponents>
+        [[nodiscard]] static const RegisteredComponent* FindComponent(const ComponentRegistry<MaxComponents>& registry,
+                                                                      TypeId typeId) noexcept
+        {
+            static const RegisteredComponent parent{ComponentMeta::Of<Parent>(), {}};
+            static const RegisteredComponent children{ComponentMeta::Of<Children>(), {}};
+            if (typeId == parent.m_meta.m_typeId)
+            {
+                return &parent;
+            }
+            if (typeId == children.m_meta.m_typeId)
+            {
+                return &children;
+            }
+            return registry.Find(typeId);
+        }
+
+        [[nodiscard]] static bool IsHierarchy(const RegisteredComponent* component) noexcept
+        {
+            const TypeId typeId = component->m_meta.m_typeId;
+            return typeId == TypeIdOf<Parent>() || typeId == TypeIdOf<Children>();
+        }
+
+        template <typename T>
+        static void TriggerHierarchyAdds(World& world, const wax::Vector<Entity>& live,
+                                         const wax::Vector<HierarchyRange>& ranges)
+        {
+            if (!world.m_observers.HasObservers(TriggerType::ADD, TypeIdOf<T>()))
+            {
+                return;
+            }
+
+            for (const HierarchyRange& range : ranges)
+            {
+                for (size_t i = range.m_first; i < range.m_first + range.m_count; ++i)
+                {
+                    if (const T* component = world.Get<T>(live[i]))
+                    {
+                        world.m_observers.Trigger(TriggerType::ADD, TypeIdOf<T>(), world, live[i], component);
+                    }
+                }
+            }
+        }
+
+        // Pick the encoding of a registered component, false if it cannot be saved
+        static bool DescribeColumn(const RegisteredComponent* component, SavedColumn& column) noexcept
+        {
+            if (component == nullptr)
+            {
+                return false;
+            }
+
+            column.m_component = component;
+            if (component->m_meta.m_typeId == TypeIdOf<Children>())
+            {
+                column.m_encoding = SnapshotEncoding::REBUILT;
+                column.m_rowBytes = 0;
+                return true;
+            }
+            if (component->m_meta.IsTriviallyCopyable())
+            {
+                column.m_encoding = SnapshotEncoding::RAW;
+                column.m_rowBytes = static_cast<uint32_t>(component->m_meta.m_size);
+                return true;
+            }
+            if (component->HasReflection())
+            {
+                column.m_encoding = SnapshotEncoding::FIELDS;
+                column.m_rowBytes = static_cast<uint32_t>(detail::SnapshotFieldBytes(component->m_reflection));
+                return true;
+            }
+            return false;
+        }
+
+        static void WriteColumnHeader(wax::BinaryWriter& out, const SavedColumn& column)
+        {
+            out.Write<uint64_t>(column.m_component->m_meta.m_typeId);
+            out.Write<uint32_t>(column.m_rowBytes);
+            out.Write<uint8_t>(static_cast<uint8_t>(column.m_encoding));
+        }
+
+        static void WriteRows(wax::BinaryWriter& out, const SavedColumn& column, const void* first, size_t count)
+        {
+            const size_t stride = column.m_component->m_meta.m_size;
+            if (column.m_encoding == SnapshotEncoding::REBUILT)
+            {
+                return;
+            }
+            if (column.m_encoding == SnapshotEncoding::RAW)
+            {
+                out.WriteBytes(first, count * stride);
+                return;
+            }
+
+            const ComponentReflection& reflection = column.m_component->m_reflection;
+            for (size_t row = 0; row < count; ++row)
+            {
+                const auto* base = static_cast<const std::byte*>(first) + row * stride;
+                for (size_t f = 0; f < reflection.m_fieldCount; ++f)
+                {
+                    out.WriteBytes(base + reflection.m_fields[f].m_offset, reflection.m_fields[f].m_size);
+                }
+            }
+        }
+
+        // Resolve the registered component, leaving m_component null when the layout does not match
+        template <size_t MaxComponents>
+        static bool ReadColumnHeader(wax::BinaryReader& reader, const ComponentRegistry<MaxComponents>& registry,
+                                     LoadedColumn& column) noexcept
+        {
+            uint64_t typeId = 0;
+            uint8_t encoding = 0;
+            if (!reader.TryRead(typeId) || !reader.TryRead(column.m_rowBytes) || !reader.TryRead(encoding))
+            {
+                return false;
+            }
+
+            column.m_encoding = static_cast<SnapshotEncoding>(encoding);
+            SavedColumn expected{};
+            const RegisteredComponent* component = FindComponent(registry, typeId);
+            if (DescribeColumn(component, expected) && expected.m_encoding == column.m_encoding &&
+                expected.m_rowBytes == column.m_rowBytes)
+            {
+                column.m_component = component;
+                column.m_hasEntityFields =
+                    component->HasReflection() &&
+                    detail::HasEntityFields(component->m_reflection.m_fields, component->m_reflection.m_fieldCount);
+            }
+            return true;
+        }
+
+        static bool ReadColumnBytes(wax::BinaryReader& reader, LoadedColumn& column, uint32_t rows) noexcept
+        {
+            uint64_t byteCount = 0;
+            if (!reader.TryRead(byteCount) || byteCount > reader.Remaining() ||
+                !reader.TryReadBytes(static_cast<size_t>(byteCount), column.m_bytes))
+            {
+                return false;
+            }
+
+            if (column.m_component != nullptr && byteCount != uint64_t{rows} * column.m_rowBytes)
+            {
+                column.m_component = nullptr;
+            }
+            return true;
+        }
+
+        // Packed rows for SpawnBatchRaw: the snapshot bytes themselves for aligned RAW columns
+        static const void* DecodeRows(ComponentAllocator& allocator, LoadedColumn& column, size_t rows)
+        {
+            if (rows == 0)
+            {
+                return column.m_bytes.Data();
+            }
+
+            const ComponentMeta& meta = column.m_component->m_meta;
+            if (column.m_encoding == SnapshotEncoding::RAW)
+            {
+                // Sparse rows are copy-constructed one by one and need aligned sources
+                if (reinterpret_cast<uintptr_t>(column.m_bytes.Data()) % meta.m_alignment == 0)
+                {
+                    return column.m_bytes.Data();
+                }
+
+                column.m_decoded = allocator.Allocate(rows * meta.m_size, meta.m_alignment);
+                std::memcpy(column.m_decoded, column.m_bytes.Data(), rows * meta.m_size);
+                return column.m_decoded;
+            }
+
+            const ComponentReflection& reflection = column.m_component->m_reflection;
+            column.m_decoded = allocator.Allocate(rows * meta.m_size, meta.m_alignment);
+
+            const uint8_t* src = column.m_bytes.Data();
+            for (size_t row = 0; row < rows; ++row)
+            {
+                auto* dst = static_cast<std::byte*>(column.m_decoded) + row * meta.m_size;
+                World::ConstructRaw(meta, dst, nullptr);
+                for (size_t f = 0; f < reflection.m_fieldCount; ++f)
+                {
+                    std::memcpy(dst + reflection.m_fields[f].m_offset, src, reflection.m_fields[f].m_size);
+                    src += reflection.m_fields[f].m_size;
+                }
+            }
+            return column.m_decoded;
+        }
+
+        static void ReleaseDecoded(ComponentAllocator& allocator, LoadedColumn& column, size_t rows)
+        {
+            if (column.m_decoded == nullptr)
+            {
+                return;
+            }
+
+            const ComponentMeta& meta = column.m_component->m_meta;
+            if (meta.m_destruct != nullptr)
+            {
+                for (size_t row = 0; row < rows; ++row)
+                {
+                    meta.m_destruct(static_cast<std::byte*>(column.m_decoded) + row * meta.m_size);
+                }
+            }
+            allocator.Deallocate(column.m_decoded);
+            column.m_decoded = nullptr;
+        }
+    };
+} // namespace queen
@@ -12,6 +12,8 @@
 #include <queen/system/access_descriptor.h>
 #include <queen/system/system_id.h>
 
+#include <algorithm>
+
 namespace queen
 {
     template <comb::Allocator Allocator> class SystemStorage;
@@ -34,6 +36,7 @@ namespace queen
      * │ adjacency_: Vector<Vector<uint32_t>> (dependents per node)      │
      * │ roots_: Vector<uint32_t> (systems with no dependencies)         │
      * │ execution_order_: Vector<uint32_t> (topologically sorted)       │
+     * │ max_critical_path_: int64_t (longest root-to-sink time)         │
      * │ dirty_: bool (needs rebuild)                                    │
      * └─────────────────────────────────────────────────────────────────┘
      *
@@ -41,6 +44,7 @@ namespace queen
      * - Build: O(N^2) where N = number of systems
      * - Topological sort: O(N + E) where E = number of edges
      * - Reset: O(N)
+     * - UpdateCriticalPaths: O(N + E log E)
      */
     template <comb::Allocator Allocator> class DependencyGraph
     {
@@ -51,6 +55,7 @@ namespace queen
             , m_roots{allocator}
             , m_executionOrder{allocator}
             , m_allocator{allocator}
+            , m_maxCriticalPath{0}
             , m_dirty{true}
         {
         }
@@ -70,6 +75,15 @@ namespace queen
         void Build(const SystemStorage<Allocator>& storage)
         {
             HIVE_PROFILE_SCOPE_N("DependencyGraph::Build");
+
+            // Measured timings outlive the graph shape, keep them across the rebuild
+            wax::Vector<SystemNode> previous{m_allocator};
+            previous.Reserve(m_nodes.Size());
+            for (size_t i = 0; i < m_nodes.Size(); ++i)
+            {
+                previous.PushBack(m_nodes[i]);
+            }
+
             Clear();
 
             const size_t systemCount = storage.SystemCount();
@@ -87,7 +101,12 @@ namespace queen
                 const auto* system = storage.GetSystemByIndex(i);
                 if (system != nullptr)
                 {
-                    m_nodes.PushBack(SystemNode{system->Id()});
+                    SystemNode node{system->Id()};
+                    if (i < previous.Size() && previous[i].Id() == system->Id())
+                    {
+                        node.SetAverageNanos(previous[i].AverageNanos());
+                    }
+                    m_nodes.PushBack(node);
                     m_adjacency.PushBack(wax::Vector<uint32_t>{m_allocator});
                 }
             }
@@ -169,6 +188,7 @@ namespace queen
                 hive::Assert(false, "System dependency cycle in Queen scheduler");
             }
 
+            UpdateCriticalPaths();
             m_dirty = false;
         }
 
@@ -183,6 +203,53 @@ namespace queen
             }
         }
 
+        /**
+         * Recompute critical-path lengths from the nodes' average timings
+         *
+         * A node's critical path is its own average plus the longest
+         * critical path among its dependents, i.e. the time still needed
+         * to drain the graph once it starts. Roots and every dependent
+         * list are reordered longest first, so the scheduler releases the
+         * long pole before the systems that have slack. Ties keep
+         * registration order.
+         */
+        void UpdateCriticalPaths()
+        {
+            m_maxCriticalPath = 0;
+            if (HasCycle())
+            {
+                return;
+            }
+
+            for (size_t i = m_executionOrder.Size(); i > 0; --i)
+            {
+                const uint32_t index = m_executionOrder[i - 1];
+                auto& dependents = m_adjacency[index];
+
+                int64_t longestTail = 0;
+                for (size_t d = 0; d < dependents.Size(); ++d)
+                {
+                    longestTail = std::max(longestTail, m_nodes[dependents[d]].CriticalPathNanos());
+                }
+
+                const int64_t path = m_nodes[index].AverageNanos() + longestTail;
+                m_nodes[index].SetCriticalPathNanos(path);
+                m_maxCriticalPath = std::max(m_maxCriticalPath, path);
+
+                SortByCriticalPath(dependents);
+            }
+
+            SortByCriticalPath(m_roots);
+        }
+
+        /**
+         * Longest critical path in the graph (0 until systems were timed)
+         */
+        [[nodiscard]] int64_t MaxCriticalPath() const noexcept
+        {
+            return m_maxCriticalPath;
+        }
+
         /**
          * Mark graph as needing rebuild
          */
@@ -279,12 +346,22 @@ namespace queen
             return false;
         }
 
+        void SortByCriticalPath(wax::Vector<uint32_t>& indices)
+        {
+            std::sort(indices.begin(), indices.end(), [this](uint32_t a, uint32_t b) {
+                const int64_t pathA = m_nodes[a].CriticalPathNanos();
+                const int64_t pathB = m_nodes[b].CriticalPathNanos();
+                return pathA != pathB ? pathA > pathB : a < b;
+            });
+        }
+
         void Clear()
         {
             m_nodes.Clear();
             m_adjacency.Clear();
             m_roots.Clear();
             m_executionOrder.Clear();
+            m_maxCriticalPath = 0;
         }
 
         void ComputeTopologicalOrder()
@@ -335,6 +412,7 @@ namespace queen
         wax::Vector<uint32_t> m_roots;
         wax::Vector<uint32_t> m_executionOrder;
         Allocator& m_allocator;
+        int64_t m_maxCriticalPath;
         bool m_dirty;
     };
 } // namespace queen
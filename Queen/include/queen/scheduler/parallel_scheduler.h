@@ -1,6 +1,7 @@
 #pragma once
 
 #include <hive/core/assert.h>
+#include <hive/core/clock.h>
 #include <hive/profiling/profiler.h>
 
 #include <comb/allocator_concepts.h>
@@ -11,7 +12,6 @@
 
 #include <queen/core/tick.h>
 #include <queen/scheduler/dependency_graph.h>
-#include <queen/scheduler/scheduler_scratch.h>
 #include <queen/system/system_storage.h>
 
 #include <atomic>
@@ -39,7 +39,8 @@ namespace queen
      * │ pool_: ThreadPool* (worker threads)                             │
      * │ owns_pool_: bool (whether we created the pool)                  │
      * │ remaining_: atomic<size_t>* (per-node remaining deps)           │
-     * │ remaining_count_: size_t (size of remaining array)              │
+     * │ tasks_: TaskData* (per-node job payload, one submit per frame)  │
+     * │ remaining_count_: size_t (size of remaining/tasks arrays)       │
      * └─────────────────────────────────────────────────────────────────┘
      *
      * Algorithm:
@@ -48,12 +49,23 @@ namespace queen
      * 3. When a system completes, decrement dependency counts of dependents
      * 4. When a dependent's count reaches 0, submit it to thread pool
      * 5. Wait for all systems to complete
-     * 6. Flush command buffers
+     * 6. Refresh critical paths from the measured timings
+     *    (every run also feeds SystemStats and the SystemTimeline)
+     * 7. Flush command buffers
+     *
+     * Prioritization:
+     * Every execution is timed and folded into the node's moving average.
+     * Roots and newly ready dependents are submitted longest remaining
+     * critical path first. Systems whose critical path is at least
+     * 1 / kLongPoleDivisor of the graph's longest one run at HIGH
+     * priority, the rest at NORMAL so they fill the gaps.
      *
      * Performance characteristics:
      * - Build: O(N^2) where N = number of systems
      * - Update: O(N/P) with P workers for independent systems
      * - Parallel speedup depends on system graph structure
+     * - Systems skipped by their run criteria cost no job, their
+     *   dependents are released on the spot
      *
      * Limitations:
      * - Systems must be thread-safe
@@ -63,10 +75,13 @@ namespace queen
     template <comb::Allocator Allocator> class ParallelScheduler
     {
     public:
+        static constexpr int64_t kLongPoleDivisor = 2;
+
         explicit ParallelScheduler(Allocator& allocator, drone::JobSubmitter jobs)
             : m_graph{allocator}
             , m_jobs{jobs}
             , m_remaining{nullptr}
+            , m_tasks{nullptr}
             , m_remainingCount{0}
             , m_allocator{&allocator}
         {
@@ -74,14 +89,7 @@ namespace queen
 
         ~ParallelScheduler()
         {
-            if (m_remaining != nullptr)
-            {
-                for (size_t i = 0; i < m_remainingCount; ++i)
-                {
-                    m_remaining[i].~atomic<uint16_t>();
-                }
-                m_allocator->Deallocate(m_remaining);
-            }
+            ReleaseRemaining();
         }
 
         ParallelScheduler(const ParallelScheduler&) = delete;
@@ -156,10 +164,37 @@ namespace queen
             return m_graph.HasCycle();
         }
 
+        /**
+         * Job priority a node is submitted with
+         *
+         * HIGH for long-pole systems, NORMAL for systems with slack. Every
+         * system is HIGH until timings exist.
+         */
+        [[nodiscard]] drone::Priority PriorityOf(uint32_t nodeIndex) const noexcept
+        {
+            const SystemNode* node = m_graph.GetNode(nodeIndex);
+            const int64_t longest = m_graph.MaxCriticalPath();
+            if (node == nullptr || longest == 0 || node->CriticalPathNanos() * kLongPoleDivisor >= longest)
+            {
+                return drone::Priority::HIGH;
+            }
+            return drone::Priority::NORMAL;
+        }
+
     private:
-        void ReallocateRemaining(size_t count)
+        struct TaskData
+        {
+            ParallelScheduler* m_scheduler;
+            World* m_world;
+            SystemStorage<Allocator>* m_storage;
+            uint32_t m_nodeIndex;
+            Tick m_tick;
+            drone::Counter* m_counter;
+            hive::Clock::TimePoint m_readyTime;
+        };
+
+        void ReleaseRemaining()
         {
-            // Clean up old array
             if (m_remaining != nullptr)
             {
                 for (size_t i = 0; i < m_remainingCount; ++i)
@@ -167,8 +202,16 @@ namespace queen
                     m_remaining[i].~atomic<uint16_t>();
                 }
                 m_allocator->Deallocate(m_remaining);
+                m_allocator->Deallocate(m_tasks);
                 m_remaining = nullptr;
+                m_tasks = nullptr;
             }
+            m_remainingCount = 0;
+        }
+
+        void ReallocateRemaining(size_t count)
+        {
+            ReleaseRemaining();
 
             m_remainingCount = count;
             if (count == 0)
@@ -183,6 +226,9 @@ namespace queen
             {
                 new (&m_remaining[i]) std::atomic<uint16_t>{0};
             }
+
+            // A node is submitted at most once per frame, so its payload slot is its index
+            m_tasks = static_cast<TaskData*>(m_allocator->Allocate(sizeof(TaskData) * count, alignof(TaskData)));
         }
 
         void ResetRemainingCounts()
@@ -200,26 +246,24 @@ namespace queen
         void SubmitSystemTask(uint32_t nodeIndex, World& world, SystemStorage<Allocator>& storage, Tick tick,
                               drone::Counter& counter)
         {
-            struct TaskData
+            // Run criteria are checked once the dependencies completed, a skipped
+            // system never reaches the job queue and releases its dependents now
+            SystemDescriptor<Allocator>* system = storage.GetSystemByIndex(nodeIndex);
+            if (system == nullptr || !system->ShouldRun(world))
             {
-                ParallelScheduler* m_scheduler;
-                World* m_world;
-                SystemStorage<Allocator>* m_storage;
-                uint32_t m_nodeIndex;
-                Tick m_tick;
-                drone::Counter* m_counter;
-            };
-            static_assert(sizeof(TaskData) <= sizeof(SchedulerTaskSlot));
+                CompleteSystem(nodeIndex, world, storage, tick, counter);
+                return;
+            }
 
-            size_t slot = AllocateSchedulerTaskSlot();
-            auto& td = *reinterpret_cast<TaskData*>(&GetSchedulerTaskBuffer()[slot]);
+            TaskData& task = m_tasks[nodeIndex];
 
-            td.m_scheduler = this;
-            td.m_world = &world;
-            td.m_storage = &storage;
-            td.m_nodeIndex = nodeIndex;
-            td.m_tick = tick;
-            td.m_counter = &counter;
+            task.m_scheduler = this;
+            task.m_world = &world;
+            task.m_storage = &storage;
+            task.m_nodeIndex = nodeIndex;
+            task.m_tick = tick;
+            task.m_counter = &counter;
+            task.m_readyTime = hive::Clock::Now();
 
             drone::JobDecl job;
             job.m_func = [](void* data) {
@@ -227,8 +271,8 @@ namespace queen
                 td->m_scheduler->ExecuteSystem(td->m_nodeIndex, *td->m_world, *td->m_storage, td->m_tick,
                                                *td->m_counter);
             };
-            job.m_userData = &td;
-            job.m_priority = drone::Priority::HIGH;
+            job.m_userData = &task;
+            job.m_priority = PriorityOf(nodeIndex);
 
             m_jobs.SubmitDetached(job);
         }
@@ -237,34 +281,42 @@ namespace queen
                            drone::Counter& counter)
         {
             SystemNode* node = m_graph.GetNode(nodeIndex);
-            if (node == nullptr)
-            {
-                counter.Decrement();
-                return;
-            }
-
-            node->SetState(SystemState::RUNNING);
-
             SystemDescriptor<Allocator>* system = storage.GetSystemByIndex(nodeIndex);
-            if (system != nullptr)
+            if (node != nullptr)
             {
+                node->SetState(SystemState::RUNNING);
+
                 HIVE_PROFILE_SCOPE_N("ExecuteSystem");
                 HIVE_PROFILE_ZONE_NAME(system->Name(), std::strlen(system->Name()));
-                system->Execute(world, tick);
+                const hive::Clock::TimePoint start = hive::Clock::Now();
+                system->Run(world, tick);
+                const hive::Clock::TimePoint end = hive::Clock::Now();
+                node->RecordExecution(hive::Clock::NanosBetween(start, end));
+                storage.RecordRun(nodeIndex, m_tasks[nodeIndex].m_readyTime, start, end);
             }
 
-            node->SetState(SystemState::COMPLETE);
+            CompleteSystem(nodeIndex, world, storage, tick, counter);
+        }
 
-            const auto* dependents = m_graph.GetDependents(nodeIndex);
-            if (dependents != nullptr)
+        void CompleteSystem(uint32_t nodeIndex, World& world, SystemStorage<Allocator>& storage, Tick tick,
+                            drone::Counter& counter)
+        {
+            SystemNode* node = m_graph.GetNode(nodeIndex);
+            if (node != nullptr)
             {
-                for (size_t i = 0; i < dependents->Size(); ++i)
+                node->SetState(SystemState::COMPLETE);
+
+                const auto* dependents = m_graph.GetDependents(nodeIndex);
+                if (dependents != nullptr)
                 {
-                    uint32_t depIdx = (*dependents)[i];
-                    uint16_t prev = m_remaining[depIdx].fetch_sub(1, std::memory_order_acq_rel);
-                    if (prev == 1)
+                    for (size_t i = 0; i < dependents->Size(); ++i)
                     {
-                        SubmitSystemTask(depIdx, world, storage, tick, counter);
+                        uint32_t depIdx = (*dependents)[i];
+                        uint16_t prev = m_remaining[depIdx].fetch_sub(1, std::memory_order_acq_rel);
+                        if (prev == 1)
+                        {
+                            SubmitSystemTask(depIdx, world, storage, tick, counter);
+                        }
                     }
                 }
             }
@@ -275,6 +327,7 @@ namespace queen
         DependencyGraph<Allocator> m_graph;
         drone::JobSubmitter m_jobs;
         std::atomic<uint16_t>* m_remaining;
+        TaskData* m_tasks;
         size_t m_remainingCount;
         Allocator* m_allocator;
     };
@@ -16,12 +16,11 @@ namespace queen
             return;
         }
 
-        hive::Assert(nodeCount <= 256, "ParallelScheduler: system count exceeds ring buffer (256 max)");
-
         m_graph.Reset();
         ResetRemainingCounts();
 
         Tick currentTick = world.CurrentTick();
+        storage.Timeline().BeginFrame(storage.SystemCount(), currentTick);
 
         drone::Counter counter{static_cast<int64_t>(nodeCount)};
 
@@ -33,6 +32,9 @@ namespace queen
 
         counter.Wait();
 
+        // Next frame's submission order and priorities follow this frame's timings
+        m_graph.UpdateCriticalPaths();
+
         world.GetCommands().FlushAll(world);
     }
 } // namespace queen
@@ -7,6 +7,7 @@
  * It must be included AFTER the World class is fully defined.
  */
 
+#include <hive/core/clock.h>
 #include <hive/profiling/profiler.h>
 
 namespace queen
@@ -25,6 +26,9 @@ namespace queen
 
         Tick currentTick = world.CurrentTick();
 
+        storage.Timeline().BeginFrame(storage.SystemCount(), currentTick);
+        hive::Clock::TimePoint ready = hive::Clock::Now();
+
         const auto& order = m_graph.ExecutionOrder();
         for (size_t i = 0; i < order.Size(); ++i)
         {
@@ -40,7 +44,13 @@ namespace queen
                 {
                     HIVE_PROFILE_SCOPE_N("ExecuteSystem");
                     HIVE_PROFILE_ZONE_NAME(system->Name(), std::strlen(system->Name()));
-                    system->Execute(world, currentTick);
+                    const hive::Clock::TimePoint start = hive::Clock::Now();
+                    if (system->Execute(world, currentTick))
+                    {
+                        const hive::Clock::TimePoint end = hive::Clock::Now();
+                        storage.RecordRun(nodeIndex, ready, start, end);
+                        ready = end;
+                    }
                 }
 
                 node->SetState(SystemState::COMPLETE);
@@ -35,19 +35,29 @@ namespace queen
      * │ state_: SystemState                                             │
      * │ dependency_count_: uint16_t (original count)                    │
      * │ unfinished_deps_: uint16_t (runtime countdown)                  │
+     * │ average_nanos_: int64_t (EMA of execution time)                 │
+     * │ critical_path_nanos_: int64_t (longest path to a sink)          │
      * └─────────────────────────────────────────────────────────────────┘
      *
+     * Timing survives Reset(): the scheduler feeds every execution into
+     * RecordExecution() and derives priorities from the smoothed value.
+     *
      * Note: Dependencies and dependents are stored externally in the graph
      * using adjacency lists to allow dynamic sizing with allocators.
      */
     class SystemNode
     {
     public:
+        // EMA weight of a new sample is 1 / kTimingSmoothing
+        static constexpr int64_t kTimingSmoothing = 8;
+
         constexpr SystemNode() noexcept
             : m_systemId{}
             , m_state{SystemState::PENDING}
             , m_dependencyCount{0}
             , m_unfinishedDeps{0}
+            , m_averageNanos{0}
+            , m_criticalPathNanos{0}
         {
         }
 
@@ -56,6 +66,8 @@ namespace queen
             , m_state{SystemState::PENDING}
             , m_dependencyCount{0}
             , m_unfinishedDeps{0}
+            , m_averageNanos{0}
+            , m_criticalPathNanos{0}
         {
         }
 
@@ -75,6 +87,14 @@ namespace queen
         {
             return m_unfinishedDeps;
         }
+        [[nodiscard]] constexpr int64_t AverageNanos() const noexcept
+        {
+            return m_averageNanos;
+        }
+        [[nodiscard]] constexpr int64_t CriticalPathNanos() const noexcept
+        {
+            return m_criticalPathNanos;
+        }
 
         constexpr void SetState(SystemState state) noexcept
         {
@@ -92,6 +112,33 @@ namespace queen
             ++m_unfinishedDeps;
         }
 
+        constexpr void SetAverageNanos(int64_t nanos) noexcept
+        {
+            m_averageNanos = nanos;
+        }
+        constexpr void SetCriticalPathNanos(int64_t nanos) noexcept
+        {
+            m_criticalPathNanos = nanos;
+        }
+
+        /**
+         * Fold one measured execution into the moving average
+         *
+         * The first sample seeds the average so a new system does not
+         * need several frames to reach its real cost.
+         */
+        constexpr void RecordExecution(int64_t nanos) noexcept
+        {
+            if (m_averageNanos == 0)
+            {
+                m_averageNanos = nanos;
+            }
+            else
+            {
+                m_averageNanos += (nanos - m_averageNanos) / kTimingSmoothing;
+            }
+        }
+
         /**
          * Reset to pending state for a new frame
          */
@@ -124,5 +171,7 @@ namespace queen
         SystemState m_state;
         uint16_t m_dependencyCount;
         uint16_t m_unfinishedDeps;
+        int64_t m_averageNanos;
+        int64_t m_criticalPathNanos;
     };
 } // namespace queen
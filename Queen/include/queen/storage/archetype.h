@@ -8,6 +8,8 @@
 #include <wax/containers/vector.h>
 
 #include <queen/core/component_info.h>
+#include <queen/core/component_mask.h>
+#include <queen/core/dense_id.h>
 #include <queen/core/entity.h>
 #include <queen/core/type_id.h>
 #include <queen/storage/table.h>
@@ -44,15 +46,18 @@ namespace queen
      * │ id_: ArchetypeId (hash of sorted TypeIds)                  │
      * │ component_types_: sorted [TypeId_A, TypeId_B, ...]         │
      * │ component_metas_: [Meta_A, Meta_B, ...]                    │
+     * │ signature_: ComponentMask (bit per DenseId, for matching)  │
      * │ table_: Table<Allocator> (owns component storage)          │
-     * │ add_edges_: HashMap<TypeId, Archetype*> (transitions)      │
-     * │ remove_edges_: HashMap<TypeId, Archetype*> (transitions)   │
+     * │ add_edges_: [DenseId → Archetype*] (transitions)           │
+     * │ remove_edges_: [DenseId → Archetype*] (transitions)        │
      * └────────────────────────────────────────────────────────────┘
      *
      * Performance characteristics:
-     * - HasComponent: O(log N) binary search on sorted types
+     * - HasComponent(TypeId): O(log N) binary search on sorted types
+     * - HasComponent<T> / GetComponent<T>: O(1) DenseId array lookup
+     * - GetSignature: O(1), query matching tests it with mask AND/ANDNOT
      * - GetColumnIndex: O(log N) binary search
-     * - Edge lookup: O(1) hash map
+     * - Edge lookup by DenseId: O(1) array access
      * - Entity count: O(1)
      *
      * Limitations:
@@ -74,11 +79,13 @@ namespace queen
     template <comb::Allocator Allocator> class Archetype
     {
     public:
-        Archetype(Allocator& allocator, wax::Vector<ComponentMeta> componentMetas, size_t initialCapacity = 64)
+        Archetype(Allocator& allocator, wax::Vector<ComponentMeta> componentMetas, size_t initialCapacity = 64,
+                  size_t chunkBytes = 0)
             : m_allocator{&allocator}
             , m_componentTypes{allocator}
             , m_componentMetas{std::move(componentMetas)}
-            , m_table{allocator, m_componentMetas, initialCapacity}
+            , m_signature{allocator}
+            , m_table{allocator, m_componentMetas, initialCapacity, chunkBytes}
             , m_addEdges{allocator}
             , m_removeEdges{allocator}
         {
@@ -86,6 +93,7 @@ namespace queen
             for (size_t i = 0; i < m_componentMetas.Size(); ++i)
             {
                 m_componentTypes.PushBack(m_componentMetas[i].m_typeId);
+                m_signature.Set(m_componentMetas[i].ResolveDenseId());
             }
 
             SortComponentTypes();
@@ -111,7 +119,7 @@ namespace queen
 
         template <typename T> [[nodiscard]] bool HasComponent() const noexcept
         {
-            return HasComponent(TypeIdOf<T>());
+            return m_table.template HasComponent<T>();
         }
 
         [[nodiscard]] size_t GetColumnIndex(TypeId typeId) const noexcept
@@ -234,26 +242,57 @@ namespace queen
             return m_componentMetas;
         }
 
+        /**
+         * Component set as a mask with one bit per component DenseId
+         */
+        [[nodiscard]] const ComponentMask<Allocator>& GetSignature() const noexcept
+        {
+            return m_signature;
+        }
+
+        /**
+         * Cached archetype transitions, indexed by the component's DenseId
+         */
+        void SetAddEdgeByDenseId(DenseId denseId, Archetype* target)
+        {
+            SetEdge(m_addEdges, denseId, target);
+        }
+
+        void SetRemoveEdgeByDenseId(DenseId denseId, Archetype* target)
+        {
+            SetEdge(m_removeEdges, denseId, target);
+        }
+
+        [[nodiscard]] Archetype* GetAddEdgeByDenseId(DenseId denseId) const noexcept
+        {
+            return denseId < m_addEdges.Size() ? m_addEdges[denseId] : nullptr;
+        }
+
+        [[nodiscard]] Archetype* GetRemoveEdgeByDenseId(DenseId denseId) const noexcept
+        {
+            return denseId < m_removeEdges.Size() ? m_removeEdges[denseId] : nullptr;
+        }
+
         void SetAddEdge(TypeId typeId, Archetype* target)
         {
-            m_addEdges.Insert(typeId, target);
+            SetAddEdgeByDenseId(RegisterDenseId(typeId), target);
         }
 
         void SetRemoveEdge(TypeId typeId, Archetype* target)
         {
-            m_removeEdges.Insert(typeId, target);
+            SetRemoveEdgeByDenseId(RegisterDenseId(typeId), target);
         }
 
         [[nodiscard]] Archetype* GetAddEdge(TypeId typeId) noexcept
         {
-            Archetype** result = m_addEdges.Find(typeId);
-            return result ? *result : nullptr;
+            const DenseId denseId = FindDenseId(typeId);
+            return denseId != kInvalidDenseId ? GetAddEdgeByDenseId(denseId) : nullptr;
         }
 
         [[nodiscard]] Archetype* GetRemoveEdge(TypeId typeId) noexcept
         {
-            Archetype** result = m_removeEdges.Find(typeId);
-            return result ? *result : nullptr;
+            const DenseId denseId = FindDenseId(typeId);
+            return denseId != kInvalidDenseId ? GetRemoveEdgeByDenseId(denseId) : nullptr;
         }
 
         [[nodiscard]] Table<Allocator>& GetTable() noexcept
@@ -266,6 +305,15 @@ namespace queen
         }
 
     private:
+        static void SetEdge(wax::Vector<Archetype*>& edges, DenseId denseId, Archetype* target)
+        {
+            if (edges.Size() <= denseId)
+            {
+                edges.Resize(denseId + 1, nullptr);
+            }
+            edges[denseId] = target;
+        }
+
         void SortComponentTypes()
         {
             for (size_t i = 1; i < m_componentTypes.Size(); ++i)
@@ -315,8 +363,9 @@ namespace queen
         ArchetypeId m_id;
         wax::Vector<TypeId> m_componentTypes;
         wax::Vector<ComponentMeta> m_componentMetas;
+        ComponentMask<Allocator> m_signature;
         Table<Allocator> m_table;
-        wax::HashMap<TypeId, Archetype*> m_addEdges;
-        wax::HashMap<TypeId, Archetype*> m_removeEdges;
+        wax::Vector<Archetype*> m_addEdges;
+        wax::Vector<Archetype*> m_removeEdges;
     };
 } // namespace queen
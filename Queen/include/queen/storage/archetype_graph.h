@@ -39,6 +39,9 @@ namespace queen
      * - GetOrCreateAddTarget: O(1) cache hit, O(n) cache miss (n = components)
      * - GetOrCreateRemoveTarget: O(1) cache hit, O(n) cache miss
      *
+     * Archetypes created by a graph built with a non-zero tableChunkBytes
+     * use the chunked table layout (see Table).
+     *
      * Limitations:
      * - Not thread-safe
      * - Archetypes are never removed once created
@@ -57,10 +60,11 @@ namespace queen
     template <comb::Allocator Allocator> class ArchetypeGraph
     {
     public:
-        explicit ArchetypeGraph(Allocator& allocator)
+        explicit ArchetypeGraph(Allocator& allocator, size_t tableChunkBytes = 0)
             : m_allocator{&allocator}
             , m_archetypes{allocator}
             , m_archetypeStorage{allocator}
+            , m_tableChunkBytes{tableChunkBytes}
         {
             CreateEmptyArchetype();
         }
@@ -81,6 +85,7 @@ namespace queen
             , m_archetypes{static_cast<wax::HashMap<ArchetypeId, Archetype<Allocator>*>&&>(other.m_archetypes)}
             , m_archetypeStorage{static_cast<wax::Vector<Archetype<Allocator>*>&&>(other.m_archetypeStorage)}
             , m_emptyArchetype{other.m_emptyArchetype}
+            , m_tableChunkBytes{other.m_tableChunkBytes}
         {
             other.m_emptyArchetype = nullptr;
         }
@@ -97,6 +102,7 @@ namespace queen
                 m_archetypes = static_cast<wax::HashMap<ArchetypeId, Archetype<Allocator>*>&&>(other.m_archetypes);
                 m_archetypeStorage = static_cast<wax::Vector<Archetype<Allocator>*>&&>(other.m_archetypeStorage);
                 m_emptyArchetype = other.m_emptyArchetype;
+                m_tableChunkBytes = other.m_tableChunkBytes;
                 other.m_emptyArchetype = nullptr;
             }
             return *this;
@@ -131,15 +137,15 @@ namespace queen
         [[nodiscard]] Archetype<Allocator>* GetOrCreateAddTarget(Archetype<Allocator>& source,
                                                                  const ComponentMeta& newComponent)
         {
-            TypeId typeId = newComponent.m_typeId;
+            const DenseId denseId = newComponent.ResolveDenseId();
 
-            Archetype<Allocator>* cached = source.GetAddEdge(typeId);
+            Archetype<Allocator>* cached = source.GetAddEdgeByDenseId(denseId);
             if (cached != nullptr)
             {
                 return cached;
             }
 
-            if (source.HasComponent(typeId))
+            if (source.GetTable().GetColumnByDenseId(denseId) != nullptr)
             {
                 return &source;
             }
@@ -153,32 +159,45 @@ namespace queen
                 newMetas.PushBack(sourceMetas[i]);
             }
             newMetas.PushBack(newComponent);
+            newMetas.Back().m_denseId = denseId;
 
             Archetype<Allocator>* target = GetOrCreateArchetype(std::move(newMetas));
 
-            source.SetAddEdge(typeId, target);
-            target->SetRemoveEdge(typeId, &source);
+            source.SetAddEdgeByDenseId(denseId, target);
+            target->SetRemoveEdgeByDenseId(denseId, &source);
 
             return target;
         }
 
         template <typename T> [[nodiscard]] Archetype<Allocator>* GetOrCreateRemoveTarget(Archetype<Allocator>& source)
         {
-            return GetOrCreateRemoveTarget(source, TypeIdOf<T>());
+            return GetOrCreateRemoveTarget(source, DenseIdOf<T>());
         }
 
         [[nodiscard]] Archetype<Allocator>* GetOrCreateRemoveTarget(Archetype<Allocator>& source, TypeId typeId)
         {
-            Archetype<Allocator>* cached = source.GetRemoveEdge(typeId);
+            const Column<Allocator>* column = source.GetColumn(typeId);
+            if (column == nullptr)
+            {
+                return &source;
+            }
+            return GetOrCreateRemoveTarget(source, column->GetMeta().m_denseId);
+        }
+
+        [[nodiscard]] Archetype<Allocator>* GetOrCreateRemoveTarget(Archetype<Allocator>& source, DenseId denseId)
+        {
+            Archetype<Allocator>* cached = source.GetRemoveEdgeByDenseId(denseId);
             if (cached != nullptr)
             {
                 return cached;
             }
 
-            if (!source.HasComponent(typeId))
+            const Column<Allocator>* column = source.GetTable().GetColumnByDenseId(denseId);
+            if (column == nullptr)
             {
                 return &source;
             }
+            const TypeId typeId = column->GetMeta().m_typeId;
 
             wax::Vector<ComponentMeta> newMetas{*m_allocator};
             const auto& sourceMetas = source.GetComponentMetas();
@@ -194,8 +213,8 @@ namespace queen
 
             Archetype<Allocator>* target = GetOrCreateArchetype(std::move(newMetas));
 
-            source.SetRemoveEdge(typeId, target);
-            target->SetAddEdge(typeId, &source);
+            source.SetRemoveEdgeByDenseId(denseId, target);
+            target->SetAddEdgeByDenseId(denseId, &source);
 
             return target;
         }
@@ -230,7 +249,8 @@ namespace queen
 
         Archetype<Allocator>* CreateArchetype(wax::Vector<ComponentMeta> metas)
         {
-            auto* archetype = comb::New<Archetype<Allocator>>(*m_allocator, *m_allocator, std::move(metas));
+            auto* archetype = comb::New<Archetype<Allocator>>(*m_allocator, *m_allocator, std::move(metas), size_t{64},
+                                                            m_tableChunkBytes);
             m_archetypeStorage.PushBack(archetype);
             m_archetypes.Insert(archetype->GetId(), archetype);
             return archetype;
@@ -255,5 +275,6 @@ namespace queen
         wax::HashMap<ArchetypeId, Archetype<Allocator>*> m_archetypes;
         wax::Vector<Archetype<Allocator>*> m_archetypeStorage;
         Archetype<Allocator>* m_emptyArchetype{nullptr};
+        size_t m_tableChunkBytes;
     };
 } // namespace queen
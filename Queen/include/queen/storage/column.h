@@ -4,11 +4,14 @@
 
 #include <comb/allocator_concepts.h>
 
+#include <wax/containers/vector.h>
+
 #include <queen/core/component_info.h>
 #include <queen/core/tick.h>
 #include <queen/core/type_id.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 
 namespace queen
@@ -20,6 +23,12 @@ namespace queen
      * Used by Table to store one column per component type. Supports
      * type-erased operations via ComponentMeta function pointers.
      *
+     * A column built with a non-zero chunkShift stores rows in fixed
+     * chunks of (1 << chunkShift) rows instead. Growing appends chunks,
+     * so existing components never move and pointers to them stay valid
+     * until the row is removed. Rows are contiguous only within a chunk:
+     * use ChunkEnd() to find where a run of rows stops.
+     *
      * Memory layout:
      * ┌────────────────────────────────────────────────────────────┐
      * │ data_: aligned byte array                                  │
@@ -28,21 +37,41 @@ namespace queen
      * │ ticks_: ComponentTicks array (for change detection)        │
      * │   [Ticks0, Ticks1, Ticks2, ...]                            │
      * │                                                            │
+     * │ block_ticks_: newest ticks per 64-row block                │
+     * │ max_ticks_: newest ticks across the whole column           │
+     * │                                                            │
      * │ Each component at: data_ + (index * stride_)               │
      * │ Stride includes alignment padding                          │
      * └────────────────────────────────────────────────────────────┘
      *
+     * Chunked layout (chunkShift != 0):
+     * ┌────────────────────────────────────────────────────────────┐
+     * │ chunks_: [Chunk0*, Chunk1*, ...]                           │
+     * │ Chunk:   [C0 .. C(rows-1)][Ticks0 .. Ticks(rows-1)]        │
+     * │ Component i at: chunks_[i >> shift] + (i & mask) * stride_ │
+     * └────────────────────────────────────────────────────────────┘
+     *
      * Performance characteristics:
-     * - Push: O(1) amortized (may reallocate)
+     * - Push: O(1) amortized (may reallocate; chunked only appends a chunk)
      * - Pop: O(1)
      * - SwapRemove: O(1)
      * - Get: O(1) - direct index access
      * - Memory: O(capacity * component_size)
+     * - Tick summaries: O(1) upkeep per push, remove and MarkChanged
+     *
+     * The block and column summaries are conservative upper bounds: a
+     * row's ticks are never newer than its block's. Change-filtered
+     * queries use them to skip whole columns and blocks.
      *
      * Limitations:
      * - Single component type per column
      * - Not thread-safe
      * - Requires ComponentMeta for lifecycle operations
+     * - Writes through GetTicks()/TicksData() bypass the summaries, use
+     *   MarkChanged() or SetTicks() instead
+     * - Data() and TicksData() require the contiguous layout
+     * - Chunks hold at least kTickBlockSize rows so tick blocks never
+     *   straddle two chunks
      *
      * Example:
      * @code
@@ -58,31 +87,30 @@ namespace queen
     template <comb::Allocator Allocator> class Column
     {
     public:
-        Column(Allocator& allocator, ComponentMeta meta, size_t initialCapacity = 64)
+        static constexpr size_t kTickBlockShift = 6;
+        static constexpr size_t kTickBlockSize = size_t{1} << kTickBlockShift;
+
+        Column(Allocator& allocator, ComponentMeta meta, size_t initialCapacity = 64, size_t chunkShift = 0)
             : m_allocator{&allocator}
             , m_meta{meta}
             , m_data{nullptr}
             , m_ticks{nullptr}
+            , m_blockTicks{nullptr}
+            , m_chunks{allocator}
             , m_size{0}
             , m_capacity{0}
+            , m_blockCapacity{0}
+            , m_chunkShift{chunkShift}
         {
             hive::Assert(meta.IsValid(), "Column requires valid ComponentMeta");
+            hive::Assert(chunkShift == 0 || chunkShift >= kTickBlockShift, "Column chunks must hold a tick block");
             Reserve(initialCapacity);
         }
 
         ~Column()
         {
             Clear();
-            if (m_data != nullptr)
-            {
-                m_allocator->Deallocate(m_data);
-                m_data = nullptr;
-            }
-            if (m_ticks != nullptr)
-            {
-                m_allocator->Deallocate(m_ticks);
-                m_ticks = nullptr;
-            }
+            ReleaseStorage();
         }
 
         Column(const Column&) = delete;
@@ -93,13 +121,20 @@ namespace queen
             , m_meta{other.m_meta}
             , m_data{other.m_data}
             , m_ticks{other.m_ticks}
+            , m_blockTicks{other.m_blockTicks}
+            , m_chunks{static_cast<wax::Vector<void*>&&>(other.m_chunks)}
+            , m_maxTicks{other.m_maxTicks}
             , m_size{other.m_size}
             , m_capacity{other.m_capacity}
+            , m_blockCapacity{other.m_blockCapacity}
+            , m_chunkShift{other.m_chunkShift}
         {
             other.m_data = nullptr;
             other.m_ticks = nullptr;
+            other.m_blockTicks = nullptr;
             other.m_size = 0;
             other.m_capacity = 0;
+            other.m_blockCapacity = 0;
         }
 
         Column& operator=(Column&& other) noexcept
@@ -107,26 +142,26 @@ namespace queen
             if (this != &other)
             {
                 Clear();
-                if (m_data != nullptr)
-                {
-                    m_allocator->Deallocate(m_data);
-                }
-                if (m_ticks != nullptr)
-                {
-                    m_allocator->Deallocate(m_ticks);
-                }
+                ReleaseStorage();
 
                 m_allocator = other.m_allocator;
                 m_meta = other.m_meta;
                 m_data = other.m_data;
                 m_ticks = other.m_ticks;
+                m_blockTicks = other.m_blockTicks;
+                m_chunks = static_cast<wax::Vector<void*>&&>(other.m_chunks);
+                m_maxTicks = other.m_maxTicks;
                 m_size = other.m_size;
                 m_capacity = other.m_capacity;
+                m_blockCapacity = other.m_blockCapacity;
+                m_chunkShift = other.m_chunkShift;
 
                 other.m_data = nullptr;
                 other.m_ticks = nullptr;
+                other.m_blockTicks = nullptr;
                 other.m_size = 0;
                 other.m_capacity = 0;
+                other.m_blockCapacity = 0;
             }
             return *this;
         }
@@ -144,7 +179,8 @@ namespace queen
             {
                 std::memset(dst, 0, m_meta.m_size);
             }
-            m_ticks[m_size].SetAdded(currentTick);
+            TickRef(m_size).SetAdded(currentTick);
+            NoteTicks(m_size);
             ++m_size;
         }
 
@@ -162,7 +198,8 @@ namespace queen
             {
                 std::memcpy(dst, src, m_meta.m_size);
             }
-            m_ticks[m_size].SetAdded(currentTick);
+            TickRef(m_size).SetAdded(currentTick);
+            NoteTicks(m_size);
             ++m_size;
         }
 
@@ -171,17 +208,33 @@ namespace queen
             hive::Assert(src != nullptr, "Cannot push null source");
             EnsureCapacity(m_size + 1);
 
-            void* dst = GetRaw(m_size);
-            if (m_meta.m_move != nullptr)
-            {
-                m_meta.m_move(dst, src);
-            }
-            else
+            m_meta.MoveConstruct(GetRaw(m_size), src);
+            TickRef(m_size).SetAdded(currentTick);
+            NoteTicks(m_size);
+            ++m_size;
+        }
+
+        /**
+         * Append count slots without constructing them
+         *
+         * Ticks are set to currentTick. The caller must construct every
+         * new slot before the column is used again. In the chunked layout
+         * the new slots are contiguous only up to ChunkEnd().
+         *
+         * @return Pointer to the first new slot
+         */
+        [[nodiscard]] void* GrowUninitialized(size_t count, Tick currentTick = Tick{0})
+        {
+            EnsureCapacity(m_size + count);
+
+            void* first = GetRaw(m_size);
+            for (size_t i = 0; i < count; ++i)
             {
-                std::memcpy(dst, src, m_meta.m_size);
+                TickRef(m_size + i).SetAdded(currentTick);
+                NoteTicks(m_size + i);
             }
-            m_ticks[m_size].SetAdded(currentTick);
-            ++m_size;
+            m_size += count;
+            return first;
         }
 
         void Pop()
@@ -205,26 +258,27 @@ namespace queen
                 void* dst = GetRaw(index);
                 void* src = GetRaw(m_size - 1);
 
-                if (m_meta.m_destruct != nullptr)
-                {
-                    m_meta.m_destruct(dst);
-                }
-
-                if (m_meta.m_move != nullptr)
+                if (m_meta.m_triviallyRelocatable)
                 {
-                    m_meta.m_move(dst, src);
+                    std::memcpy(dst, src, m_meta.m_size);
                 }
                 else
                 {
-                    std::memcpy(dst, src, m_meta.m_size);
-                }
+                    if (m_meta.m_destruct != nullptr)
+                    {
+                        m_meta.m_destruct(dst);
+                    }
 
-                if (m_meta.m_destruct != nullptr)
-                {
-                    m_meta.m_destruct(src);
+                    m_meta.MoveConstruct(dst, src);
+
+                    if (m_meta.m_destruct != nullptr)
+                    {
+                        m_meta.m_destruct(src);
+                    }
                 }
 
-                m_ticks[index] = m_ticks[m_size - 1];
+                TickRef(index) = TickRef(m_size - 1);
+                NoteTicks(index);
             }
             else
             {
@@ -240,12 +294,21 @@ namespace queen
         [[nodiscard]] void* GetRaw(size_t index) noexcept
         {
             hive::Assert(index < m_capacity, "Index out of bounds");
+            if (m_chunkShift != 0)
+            {
+                return static_cast<std::byte*>(m_chunks[index >> m_chunkShift]) + (InChunk(index) * m_meta.m_size);
+            }
             return static_cast<std::byte*>(m_data) + (index * m_meta.m_size);
         }
 
         [[nodiscard]] const void* GetRaw(size_t index) const noexcept
         {
             hive::Assert(index < m_capacity, "Index out of bounds");
+            if (m_chunkShift != 0)
+            {
+                return static_cast<const std::byte*>(m_chunks[index >> m_chunkShift]) +
+                       (InChunk(index) * m_meta.m_size);
+            }
             return static_cast<const std::byte*>(m_data) + (index * m_meta.m_size);
         }
 
@@ -266,12 +329,14 @@ namespace queen
         template <typename T> [[nodiscard]] T* Data() noexcept
         {
             hive::Assert(TypeIdOf<T>() == m_meta.m_typeId, "Type mismatch");
+            hive::Assert(m_chunkShift == 0, "Data() requires a contiguous column");
             return static_cast<T*>(m_data);
         }
 
         template <typename T> [[nodiscard]] const T* Data() const noexcept
         {
             hive::Assert(TypeIdOf<T>() == m_meta.m_typeId, "Type mismatch");
+            hive::Assert(m_chunkShift == 0, "Data() requires a contiguous column");
             return static_cast<const T*>(m_data);
         }
 
@@ -284,6 +349,12 @@ namespace queen
                     m_meta.m_destruct(GetRaw(i));
                 }
             }
+
+            for (size_t b = 0; b < m_blockCapacity; ++b)
+            {
+                m_blockTicks[b] = ComponentTicks{};
+            }
+            m_maxTicks = ComponentTicks{};
             m_size = 0;
         }
 
@@ -294,48 +365,63 @@ namespace queen
                 return;
             }
 
-            void* newData = m_allocator->Allocate(newCapacity * m_meta.m_size, m_meta.m_alignment);
-            hive::Assert(newData != nullptr, "Column data allocation failed");
+            if (m_chunkShift != 0)
+            {
+                ReserveChunks(newCapacity);
+                return;
+            }
 
-            ComponentTicks* newTicks = static_cast<ComponentTicks*>(
-                m_allocator->Allocate(newCapacity * sizeof(ComponentTicks), alignof(ComponentTicks)));
-            hive::Assert(newTicks != nullptr, "Column ticks allocation failed");
+            Reallocate(newCapacity);
+        }
 
-            if (m_data != nullptr)
+        /**
+         * Release capacity beyond max(Size(), minCapacity)
+         *
+         * The contiguous layout moves the rows into a smaller allocation,
+         * or frees everything when no row is kept. The chunked layout frees
+         * trailing chunks only, so components never move. Block tick
+         * summaries are kept, they are a few bytes per 64 rows.
+         *
+         * @return true if any memory was returned to the allocator
+         */
+        bool ShrinkToFit(size_t minCapacity = 0)
+        {
+            const size_t target = m_size > minCapacity ? m_size : minCapacity;
+
+            if (m_chunkShift != 0)
             {
-                for (size_t i = 0; i < m_size; ++i)
+                const size_t chunkCount = (target + (size_t{1} << m_chunkShift) - 1) >> m_chunkShift;
+                if (chunkCount >= m_chunks.Size())
                 {
-                    void* dst = static_cast<std::byte*>(newData) + (i * m_meta.m_size);
-                    void* src = GetRaw(i);
-
-                    if (m_meta.m_move != nullptr)
-                    {
-                        m_meta.m_move(dst, src);
-                    }
-                    else
-                    {
-                        std::memcpy(dst, src, m_meta.m_size);
-                    }
-
-                    if (m_meta.m_destruct != nullptr)
-                    {
-                        m_meta.m_destruct(src);
-                    }
+                    return false;
+                }
 
-                    newTicks[i] = m_ticks[i];
+                while (m_chunks.Size() > chunkCount)
+                {
+                    m_allocator->Deallocate(m_chunks.Back());
+                    m_chunks.PopBack();
                 }
+                m_capacity = chunkCount << m_chunkShift;
+                return true;
+            }
 
-                m_allocator->Deallocate(m_data);
+            if (target >= m_capacity)
+            {
+                return false;
             }
 
-            if (m_ticks != nullptr)
+            if (target == 0)
             {
+                m_allocator->Deallocate(m_data);
                 m_allocator->Deallocate(m_ticks);
+                m_data = nullptr;
+                m_ticks = nullptr;
+                m_capacity = 0;
+                return true;
             }
 
-            m_data = newData;
-            m_ticks = newTicks;
-            m_capacity = newCapacity;
+            Reallocate(target);
+            return true;
         }
 
         [[nodiscard]] size_t Size() const noexcept
@@ -359,19 +445,57 @@ namespace queen
             return m_meta;
         }
 
+        [[nodiscard]] bool IsChunked() const noexcept
+        {
+            return m_chunkShift != 0;
+        }
+
+        /**
+         * Rows per chunk, 0 for the contiguous layout
+         */
+        [[nodiscard]] size_t ChunkRows() const noexcept
+        {
+            return m_chunkShift != 0 ? size_t{1} << m_chunkShift : 0;
+        }
+
+        [[nodiscard]] size_t ChunkCount() const noexcept
+        {
+            return m_chunks.Size();
+        }
+
+        /**
+         * First row past the contiguous run containing index
+         *
+         * GetRaw(index) + k * stride and TicksAt(index) + k are valid for
+         * index + k < ChunkEnd(index). Returns SIZE_MAX when contiguous.
+         */
+        [[nodiscard]] size_t ChunkEnd(size_t index) const noexcept
+        {
+            return m_chunkShift != 0 ? ((index >> m_chunkShift) + 1) << m_chunkShift : SIZE_MAX;
+        }
+
         /**
          * Get ticks for a component at the given index
          */
         [[nodiscard]] ComponentTicks& GetTicks(size_t index) noexcept
         {
             hive::Assert(index < m_size, "Index out of bounds");
-            return m_ticks[index];
+            return TickRef(index);
         }
 
         [[nodiscard]] const ComponentTicks& GetTicks(size_t index) const noexcept
         {
             hive::Assert(index < m_size, "Index out of bounds");
-            return m_ticks[index];
+            return TickRef(index);
+        }
+
+        /**
+         * Pointer to the ticks at index, contiguous up to ChunkEnd(index)
+         */
+        [[nodiscard]] const ComponentTicks* TicksAt(size_t index) const noexcept
+        {
+            hive::Assert(index < m_capacity, "Index out of bounds");
+            return &TickRef(index);
         }
 
         /**
@@ -379,10 +503,12 @@ namespace queen
          */
         [[nodiscard]] ComponentTicks* TicksData() noexcept
         {
+            hive::Assert(m_chunkShift == 0, "TicksData() requires a contiguous column");
             return m_ticks;
         }
         [[nodiscard]] const ComponentTicks* TicksData() const noexcept
         {
+            hive::Assert(m_chunkShift == 0, "TicksData() requires a contiguous column");
             return m_ticks;
         }
 
@@ -392,13 +518,216 @@ namespace queen
         void MarkChanged(size_t index, Tick currentTick) noexcept
         {
             hive::Assert(index < m_size, "Index out of bounds");
-            m_ticks[index].MarkChanged(currentTick);
+            TickRef(index).MarkChanged(currentTick);
+            NoteTicks(index);
+        }
+
+        /**
+         * Overwrite the ticks of a component (e.g. when moving rows between tables)
+         */
+        void SetTicks(size_t index, const ComponentTicks& ticks) noexcept
+        {
+            hive::Assert(index < m_size, "Index out of bounds");
+            TickRef(index) = ticks;
+            NoteTicks(index);
+        }
+
+        /**
+         * Newest added/changed ticks of any component ever stored in the column
+         */
+        [[nodiscard]] const ComponentTicks& MaxTicks() const noexcept
+        {
+            return m_maxTicks;
+        }
+
+        /**
+         * Newest added/changed ticks of rows [block * kTickBlockSize, (block + 1) * kTickBlockSize)
+         */
+        [[nodiscard]] const ComponentTicks& BlockTicks(size_t block) const noexcept
+        {
+            hive::Assert(block < BlockCount(), "Block index out of bounds");
+            return m_blockTicks[block];
+        }
+
+        [[nodiscard]] size_t BlockCount() const noexcept
+        {
+            return BlockCountFor(m_size);
         }
 
     private:
+        static constexpr size_t BlockCountFor(size_t rows) noexcept
+        {
+            return (rows + kTickBlockSize - 1) >> kTickBlockShift;
+        }
+
+        [[nodiscard]] size_t InChunk(size_t index) const noexcept
+        {
+            return index & ((size_t{1} << m_chunkShift) - 1);
+        }
+
+        // Ticks follow the component data inside each chunk
+        [[nodiscard]] size_t ChunkTicksOffset() const noexcept
+        {
+            const size_t dataBytes = (size_t{1} << m_chunkShift) * m_meta.m_size;
+            return (dataBytes + alignof(ComponentTicks) - 1) & ~(alignof(ComponentTicks) - 1);
+        }
+
+        [[nodiscard]] ComponentTicks& TickRef(size_t index) noexcept
+        {
+            if (m_chunkShift != 0)
+            {
+                std::byte* chunk = static_cast<std::byte*>(m_chunks[index >> m_chunkShift]);
+                auto* ticks = reinterpret_cast<ComponentTicks*>(chunk + ChunkTicksOffset());
+                return ticks[InChunk(index)];
+            }
+            return m_ticks[index];
+        }
+
+        [[nodiscard]] const ComponentTicks& TickRef(size_t index) const noexcept
+        {
+            return const_cast<Column*>(this)->TickRef(index);
+        }
+
+        void NoteTicks(size_t index) noexcept
+        {
+            const ComponentTicks& ticks = TickRef(index);
+            m_blockTicks[index >> kTickBlockShift].Merge(ticks);
+            m_maxTicks.Merge(ticks);
+        }
+
+        // Grow the per-block summaries geometrically, they are small and rarely reallocated
+        void ReserveBlockTicks(size_t blocks)
+        {
+            if (blocks <= m_blockCapacity)
+            {
+                return;
+            }
+
+            size_t newCapacity = m_blockCapacity == 0 ? blocks : m_blockCapacity * 2;
+            while (newCapacity < blocks)
+            {
+                newCapacity *= 2;
+            }
+
+            ComponentTicks* newBlockTicks = static_cast<ComponentTicks*>(
+                m_allocator->Allocate(newCapacity * sizeof(ComponentTicks), alignof(ComponentTicks)));
+            hive::Assert(newBlockTicks != nullptr, "Column block ticks allocation failed");
+
+            for (size_t b = 0; b < newCapacity; ++b)
+            {
+                newBlockTicks[b] = b < m_blockCapacity ? m_blockTicks[b] : ComponentTicks{};
+            }
+
+            if (m_blockTicks != nullptr)
+            {
+                m_allocator->Deallocate(m_blockTicks);
+            }
+
+            m_blockTicks = newBlockTicks;
+            m_blockCapacity = newCapacity;
+        }
+
+        // Move the contiguous rows into a new allocation of newCapacity rows, newCapacity >= m_size
+        void Reallocate(size_t newCapacity)
+        {
+            void* newData = m_allocator->Allocate(newCapacity * m_meta.m_size, m_meta.m_alignment);
+            hive::Assert(newData != nullptr, "Column data allocation failed");
+
+            ComponentTicks* newTicks = static_cast<ComponentTicks*>(
+                m_allocator->Allocate(newCapacity * sizeof(ComponentTicks), alignof(ComponentTicks)));
+            hive::Assert(newTicks != nullptr, "Column ticks allocation failed");
+
+            ReserveBlockTicks(BlockCountFor(newCapacity));
+
+            if (m_data != nullptr && m_meta.m_triviallyRelocatable)
+            {
+                std::memcpy(newData, m_data, m_size * m_meta.m_size);
+            }
+            else if (m_data != nullptr)
+            {
+                for (size_t i = 0; i < m_size; ++i)
+                {
+                    void* src = GetRaw(i);
+                    m_meta.MoveConstruct(static_cast<std::byte*>(newData) + (i * m_meta.m_size), src);
+
+                    if (m_meta.m_destruct != nullptr)
+                    {
+                        m_meta.m_destruct(src);
+                    }
+                }
+            }
+
+            if (m_data != nullptr)
+            {
+                std::memcpy(newTicks, m_ticks, m_size * sizeof(ComponentTicks));
+                m_allocator->Deallocate(m_data);
+            }
+
+            if (m_ticks != nullptr)
+            {
+                m_allocator->Deallocate(m_ticks);
+            }
+
+            m_data = newData;
+            m_ticks = newTicks;
+            m_capacity = newCapacity;
+        }
+
+        // Append chunks until newCapacity rows fit, existing chunks never move
+        void ReserveChunks(size_t newCapacity)
+        {
+            const size_t chunkRows = size_t{1} << m_chunkShift;
+            const size_t chunkCount = (newCapacity + chunkRows - 1) >> m_chunkShift;
+            const size_t chunkBytes = ChunkTicksOffset() + chunkRows * sizeof(ComponentTicks);
+            const size_t chunkAlign =
+                m_meta.m_alignment > alignof(ComponentTicks) ? m_meta.m_alignment : alignof(ComponentTicks);
+
+            ReserveBlockTicks(BlockCountFor(chunkCount << m_chunkShift));
+
+            m_chunks.Reserve(chunkCount);
+            while (m_chunks.Size() < chunkCount)
+            {
+                void* chunk = m_allocator->Allocate(chunkBytes, chunkAlign);
+                hive::Assert(chunk != nullptr, "Column chunk allocation failed");
+                m_chunks.PushBack(chunk);
+            }
+
+            m_capacity = chunkCount << m_chunkShift;
+        }
+
+        void ReleaseStorage()
+        {
+            if (m_data != nullptr)
+            {
+                m_allocator->Deallocate(m_data);
+                m_data = nullptr;
+            }
+            if (m_ticks != nullptr)
+            {
+                m_allocator->Deallocate(m_ticks);
+                m_ticks = nullptr;
+            }
+            if (m_blockTicks != nullptr)
+            {
+                m_allocator->Deallocate(m_blockTicks);
+                m_blockTicks = nullptr;
+            }
+            for (size_t i = 0; i < m_chunks.Size(); ++i)
+            {
+                m_allocator->Deallocate(m_chunks[i]);
+            }
+            m_chunks.Clear();
+            m_capacity = 0;
+            m_blockCapacity = 0;
+        }
+
         void EnsureCapacity(size_t required)
         {
-            if (required > m_capacity)
+            if (required > m_capacity && m_chunkShift != 0)
+            {
+                Reserve(required);
+            }
+            else if (required > m_capacity)
             {
                 size_t newCapacity = m_capacity == 0 ? 8 : m_capacity * 2;
                 while (newCapacity < required)
@@ -413,7 +742,12 @@ namespace queen
         ComponentMeta m_meta;
         void* m_data;
         ComponentTicks* m_ticks;
+        ComponentTicks* m_blockTicks;
+        wax::Vector<void*> m_chunks;
+        ComponentTicks m_maxTicks{};
         size_t m_size;
         size_t m_capacity;
+        size_t m_blockCapacity;
+        size_t m_chunkShift;
     };
 } // namespace queen
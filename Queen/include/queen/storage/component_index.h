@@ -5,6 +5,8 @@
 #include <wax/containers/hash_map.h>
 #include <wax/containers/vector.h>
 
+#include <queen/core/component_mask.h>
+#include <queen/core/dense_id.h>
 #include <queen/core/type_id.h>
 #include <queen/storage/archetype.h>
 
@@ -29,16 +31,20 @@ namespace queen
      *   Query<Position, Velocity>:
      *   1. Get archetypes with Position: {1, 3, 7}
      *   2. Get archetypes with Velocity: {1, 5}
-     *   3. Intersection: {1}
+     *   3. Start from the rarest list ({1, 5}) and keep the candidates
+     *      whose signature mask contains both: {1}
      *
      * Performance characteristics:
      * - RegisterArchetype: O(n) where n = component count
+     * - UnregisterArchetype: O(n * m) where m = list size
      * - GetArchetypesWith: O(1) hash lookup
-     * - GetArchetypesWithAll: O(k*m) where k = types, m = avg archetypes
+     * - FindRarest: O(k) hash lookups where k = types
+     * - GetArchetypesWithAll: O(k + m*B) where m = rarest list size,
+     *   B = signature mask blocks
      *
      * Limitations:
      * - Not thread-safe
-     * - Archetypes cannot be unregistered
+     * - UnregisterArchetype keeps list order and is O(n * m)
      *
      * Example:
      * @code
@@ -85,6 +91,39 @@ namespace queen
             }
         }
 
+        /**
+         * Remove archetype from the list of each of its components
+         *
+         * Used by World::Compact to retire empty archetypes. The relative
+         * order of the remaining archetypes is kept.
+         *
+         * @return true if the archetype was registered
+         */
+        bool UnregisterArchetype(const Archetype<Allocator>* archetype)
+        {
+            bool removed = false;
+            const auto& types = archetype->GetComponentTypes();
+            for (size_t i = 0; i < types.Size(); ++i)
+            {
+                ArchetypeList* list = m_index.Find(types[i]);
+                if (list == nullptr)
+                {
+                    continue;
+                }
+
+                for (size_t j = 0; j < list->Size(); ++j)
+                {
+                    if ((*list)[j] == archetype)
+                    {
+                        list->Erase(list->Begin() + j);
+                        removed = true;
+                        break;
+                    }
+                }
+            }
+            return removed;
+        }
+
         template <typename T> [[nodiscard]] const ArchetypeList* GetArchetypesWith() const noexcept
         {
             return GetArchetypesWith(TypeIdOf<T>());
@@ -114,48 +153,54 @@ namespace queen
         {
             ArchetypeList result{*m_allocator};
 
-            if (count == 0)
+            const ArchetypeList* rarest = FindRarest(typeIds, count);
+            if (rarest == nullptr)
             {
                 return result;
             }
 
-            size_t smallestIdx = 0;
-            size_t smallestSize = SIZE_MAX;
+            ComponentMask<Allocator> required{*m_allocator};
             for (size_t i = 0; i < count; ++i)
             {
-                const ArchetypeList* list = GetArchetypesWith(typeIds[i]);
-                if (list == nullptr)
-                {
-                    return result;
-                }
-                if (list->Size() < smallestSize)
+                required.Set(RegisterDenseId(typeIds[i]));
+            }
+
+            for (size_t i = 0; i < rarest->Size(); ++i)
+            {
+                Archetype<Allocator>* arch = (*rarest)[i];
+                if (arch->GetSignature().ContainsAll(required))
                 {
-                    smallestSize = list->Size();
-                    smallestIdx = i;
+                    result.PushBack(arch);
                 }
             }
 
-            const ArchetypeList* smallest = GetArchetypesWith(typeIds[smallestIdx]);
-            for (size_t i = 0; i < smallest->Size(); ++i)
-            {
-                Archetype<Allocator>* arch = (*smallest)[i];
-                bool hasAll = true;
+            return result;
+        }
 
-                for (size_t j = 0; j < count && hasAll; ++j)
+        /**
+         * Shortest archetype list among typeIds
+         *
+         * Every archetype holding all of typeIds is in this list, so
+         * intersecting starts from it and only tests the fewest candidates.
+         *
+         * @return nullptr if count is 0 or some type has no archetype
+         */
+        [[nodiscard]] const ArchetypeList* FindRarest(const TypeId* typeIds, size_t count) const noexcept
+        {
+            const ArchetypeList* rarest = nullptr;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const ArchetypeList* list = GetArchetypesWith(typeIds[i]);
+                if (list == nullptr)
                 {
-                    if (!arch->HasComponent(typeIds[j]))
-                    {
-                        hasAll = false;
-                    }
+                    return nullptr;
                 }
-
-                if (hasAll)
+                if (rarest == nullptr || list->Size() < rarest->Size())
                 {
-                    result.PushBack(arch);
+                    rarest = list;
                 }
             }
-
-            return result;
+            return rarest;
         }
 
         [[nodiscard]] size_t ComponentTypeCount() const noexcept
@@ -0,0 +1,345 @@
+#pragma once
+
+#include <hive/core/assert.h>
+
+#include <comb/allocator_concepts.h>
+#include <comb/new.h>
+
+#include <wax/containers/hash_map.h>
+#include <wax/containers/vector.h>
+
+#include <queen/core/component_info.h>
+#include <queen/core/entity.h>
+#include <queen/core/tick.h>
+#include <queen/core/type_id.h>
+#include <queen/storage/column.h>
+
+#include <cstdint>
+
+namespace queen
+{
+    /**
+     * Type-erased sparse set storage for one component type
+     *
+     * Backing store for components declared with StorageType::SPARSE. The
+     * entity's archetype does not contain the component, so adding or
+     * removing it never migrates the entity between tables. Data and ticks
+     * live in a Column packed parallel to the dense entity array.
+     *
+     * Memory layout:
+     * ┌─────────────────────────────────────────────────────────────┐
+     * │ sparse_: [_, 0, _, 2, 1, ...]  Entity.Index() → dense index │
+     * │ dense_:  [e1, e4, e3]          packed entities              │
+     * │ column_: [c1, c4, c3]          data + ComponentTicks        │
+     * └─────────────────────────────────────────────────────────────┘
+     *
+     * Performance characteristics:
+     * - Insert: O(1) amortized
+     * - Remove: O(1) (swap-and-pop)
+     * - Contains/Get: O(1)
+     * - Memory: O(max_entity_index) + O(count * component_size)
+     *
+     * Limitations:
+     * - Not thread-safe
+     * - Component addresses change when another entity is removed
+     *
+     * Example:
+     * @code
+     *   SparseStorage<Allocator> stunned{alloc, ComponentMeta::Of<Stunned>()};
+     *   Stunned value{2.0f};
+     *   stunned.InsertCopy(entity, &value, currentTick);
+     *   auto* s = static_cast<Stunned*>(stunned.Get(entity));
+     *   stunned.Remove(entity);
+     * @endcode
+     */
+    template <comb::Allocator Allocator> class SparseStorage
+    {
+    public:
+        static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+        SparseStorage(Allocator& allocator, const ComponentMeta& meta)
+            : m_sparse{allocator}
+            , m_dense{allocator}
+            , m_column{allocator, meta, 8}
+        {
+        }
+
+        SparseStorage(const SparseStorage&) = delete;
+        SparseStorage& operator=(const SparseStorage&) = delete;
+
+        [[nodiscard]] uint32_t IndexOf(Entity entity) const noexcept
+        {
+            const uint32_t index = entity.Index();
+            if (index >= m_sparse.Size())
+            {
+                return kInvalidIndex;
+            }
+
+            const uint32_t denseIndex = m_sparse[index];
+            if (denseIndex >= m_dense.Size() || !(m_dense[denseIndex] == entity))
+            {
+                return kInvalidIndex;
+            }
+
+            return denseIndex;
+        }
+
+        [[nodiscard]] bool Contains(Entity entity) const noexcept
+        {
+            return IndexOf(entity) != kInvalidIndex;
+        }
+
+        [[nodiscard]] void* Get(Entity entity) noexcept
+        {
+            const uint32_t denseIndex = IndexOf(entity);
+            return denseIndex != kInvalidIndex ? m_column.GetRaw(denseIndex) : nullptr;
+        }
+
+        [[nodiscard]] const void* Get(Entity entity) const noexcept
+        {
+            const uint32_t denseIndex = IndexOf(entity);
+            return denseIndex != kInvalidIndex ? m_column.GetRaw(denseIndex) : nullptr;
+        }
+
+        [[nodiscard]] ComponentTicks* GetTicks(Entity entity) noexcept
+        {
+            const uint32_t denseIndex = IndexOf(entity);
+            return denseIndex != kInvalidIndex ? &m_column.GetTicks(denseIndex) : nullptr;
+        }
+
+        [[nodiscard]] const ComponentTicks* GetTicks(Entity entity) const noexcept
+        {
+            const uint32_t denseIndex = IndexOf(entity);
+            return denseIndex != kInvalidIndex ? &m_column.GetTicks(denseIndex) : nullptr;
+        }
+
+        void MarkChanged(Entity entity, Tick currentTick) noexcept
+        {
+            const uint32_t denseIndex = IndexOf(entity);
+            if (denseIndex != kInvalidIndex)
+            {
+                m_column.MarkChanged(denseIndex, currentTick);
+            }
+        }
+
+        /**
+         * Insert by moving from src, entity must not already be present
+         *
+         * @return Pointer to the stored component
+         */
+        void* InsertMove(Entity entity, void* src, Tick currentTick)
+        {
+            hive::Assert(!Contains(entity), "Entity already in sparse storage");
+            Link(entity);
+            m_column.PushMove(src, currentTick);
+            return m_column.GetRaw(m_column.Size() - 1);
+        }
+
+        /**
+         * Insert by copying from src, entity must not already be present
+         *
+         * @return Pointer to the stored component
+         */
+        void* InsertCopy(Entity entity, const void* src, Tick currentTick)
+        {
+            hive::Assert(!Contains(entity), "Entity already in sparse storage");
+            Link(entity);
+            m_column.PushCopy(src, currentTick);
+            return m_column.GetRaw(m_column.Size() - 1);
+        }
+
+        bool Remove(Entity entity)
+        {
+            const uint32_t denseIndex = IndexOf(entity);
+            if (denseIndex == kInvalidIndex)
+            {
+                return false;
+            }
+
+            const uint32_t last = static_cast<uint32_t>(m_dense.Size() - 1);
+            m_column.SwapRemove(denseIndex);
+
+            if (denseIndex != last)
+            {
+                const Entity moved = m_dense[last];
+                m_dense[denseIndex] = moved;
+                m_sparse[moved.Index()] = denseIndex;
+            }
+
+            m_dense.PopBack();
+            m_sparse[entity.Index()] = kInvalidIndex;
+            return true;
+        }
+
+        void Clear()
+        {
+            for (size_t i = 0; i < m_dense.Size(); ++i)
+            {
+                m_sparse[m_dense[i].Index()] = kInvalidIndex;
+            }
+            m_dense.Clear();
+            m_column.Clear();
+        }
+
+        [[nodiscard]] size_t Count() const noexcept
+        {
+            return m_dense.Size();
+        }
+
+        [[nodiscard]] bool IsEmpty() const noexcept
+        {
+            return m_dense.IsEmpty();
+        }
+
+        [[nodiscard]] const Entity* GetEntities() const noexcept
+        {
+            return m_dense.Data();
+        }
+
+        [[nodiscard]] Entity EntityAt(size_t denseIndex) const noexcept
+        {
+            return m_dense[denseIndex];
+        }
+
+        [[nodiscard]] Column<Allocator>& GetColumn() noexcept
+        {
+            return m_column;
+        }
+
+        [[nodiscard]] const Column<Allocator>& GetColumn() const noexcept
+        {
+            return m_column;
+        }
+
+        [[nodiscard]] const ComponentMeta& GetMeta() const noexcept
+        {
+            return m_column.GetMeta();
+        }
+
+        [[nodiscard]] TypeId GetTypeId() const noexcept
+        {
+            return m_column.GetTypeId();
+        }
+
+    private:
+        void Link(Entity entity)
+        {
+            const uint32_t index = entity.Index();
+            while (m_sparse.Size() <= index)
+            {
+                m_sparse.PushBack(kInvalidIndex);
+            }
+
+            m_sparse[index] = static_cast<uint32_t>(m_dense.Size());
+            m_dense.PushBack(entity);
+        }
+
+        wax::Vector<uint32_t> m_sparse;
+        wax::Vector<Entity> m_dense;
+        Column<Allocator> m_column;
+    };
+
+    /**
+     * Per-type SparseStorage lookup owned by the World
+     *
+     * Storages are created on first insert of a sparse component type and
+     * kept for the lifetime of the registry, so pointers stay valid.
+     *
+     * Performance characteristics:
+     * - Find: O(1) hash lookup
+     * - RemoveEntity: O(s) where s = number of sparse component types
+     *
+     * Limitations:
+     * - Not thread-safe
+     */
+    template <comb::Allocator Allocator> class SparseStorageRegistry
+    {
+    public:
+        explicit SparseStorageRegistry(Allocator& allocator)
+            : m_allocator{&allocator}
+            , m_storages{allocator}
+            , m_lookup{allocator}
+        {
+        }
+
+        ~SparseStorageRegistry()
+        {
+            for (size_t i = 0; i < m_storages.Size(); ++i)
+            {
+                comb::Delete(*m_allocator, m_storages[i]);
+            }
+        }
+
+        SparseStorageRegistry(const SparseStorageRegistry&) = delete;
+        SparseStorageRegistry& operator=(const SparseStorageRegistry&) = delete;
+
+        [[nodiscard]] SparseStorage<Allocator>* Find(TypeId typeId) noexcept
+        {
+            SparseStorage<Allocator>** found = m_lookup.Find(typeId);
+            return found != nullptr ? *found : nullptr;
+        }
+
+        [[nodiscard]] const SparseStorage<Allocator>* Find(TypeId typeId) const noexcept
+        {
+            SparseStorage<Allocator>* const* found = m_lookup.Find(typeId);
+            return found != nullptr ? *found : nullptr;
+        }
+
+        [[nodiscard]] SparseStorage<Allocator>& GetOrCreate(const ComponentMeta& meta)
+        {
+            hive::Assert(meta.m_storage == StorageType::SPARSE, "Component is not declared sparse");
+
+            if (SparseStorage<Allocator>* existing = Find(meta.m_typeId))
+            {
+                return *existing;
+            }
+
+            auto* storage = comb::New<SparseStorage<Allocator>>(*m_allocator, *m_allocator, meta);
+            m_storages.PushBack(storage);
+            m_lookup.Insert(meta.m_typeId, storage);
+            return *storage;
+        }
+
+        /**
+         * Remove an entity from every sparse storage (used on despawn)
+         */
+        void RemoveEntity(Entity entity)
+        {
+            for (size_t i = 0; i < m_storages.Size(); ++i)
+            {
+                m_storages[i]->Remove(entity);
+            }
+        }
+
+        /**
+         * Empty every sparse storage, the storages themselves stay registered
+         */
+        void Clear()
+        {
+            for (size_t i = 0; i < m_storages.Size(); ++i)
+            {
+                m_storages[i]->Clear();
+            }
+        }
+
+        [[nodiscard]] size_t StorageCount() const noexcept
+        {
+            return m_storages.Size();
+        }
+
+        [[nodiscard]] SparseStorage<Allocator>* GetStorage(size_t index) noexcept
+        {
+            return m_storages[index];
+        }
+
+        [[nodiscard]] const SparseStorage<Allocator>* GetStorage(size_t index) const noexcept
+        {
+            return m_storages[index];
+        }
+
+    private:
+        Allocator* m_allocator;
+        wax::Vector<SparseStorage<Allocator>*> m_storages;
+        wax::HashMap<TypeId, SparseStorage<Allocator>*> m_lookup;
+    };
+} // namespace queen
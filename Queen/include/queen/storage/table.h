@@ -8,11 +8,14 @@
 #include <wax/containers/vector.h>
 
 #include <queen/core/component_info.h>
+#include <queen/core/dense_id.h>
 #include <queen/core/entity.h>
 #include <queen/core/tick.h>
 #include <queen/core/type_id.h>
 #include <queen/storage/column.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 namespace queen
@@ -28,24 +31,39 @@ namespace queen
      * ┌────────────────────────────────────────────────────────────┐
      * │ entities_: [Entity0, Entity1, Entity2, ...]                │
      * │                                                            │
-     * │ columns_: HashMap<TypeId, Column>                          │
-     * │   TypeId_A -> [A0, A1, A2, ...]                            │
-     * │   TypeId_B -> [B0, B1, B2, ...]                            │
-     * │   TypeId_C -> [C0, C1, C2, ...]                            │
+     * │ columns_: [Column_A, Column_B, Column_C]                   │
+     * │   Column_A -> [A0, A1, A2, ...]                            │
+     * │   Column_B -> [B0, B1, B2, ...]                            │
+     * │                                                            │
+     * │ dense_to_column_: [_, 1, _, 0, 2] DenseId → column slot    │
+     * │ type_to_column_index_: HashMap<TypeId, size_t>             │
      * │                                                            │
      * │ Row i contains: entities_[i], columns_[A][i], ...          │
      * └────────────────────────────────────────────────────────────┘
      *
+     * Typed access (GetColumn<T>, HasComponent<T>, SetComponent<T>) and
+     * row moves resolve columns through the flat DenseId array. The TypeId
+     * hash map only serves type-erased callers.
+     *
+     * With a non-zero chunkBytes every column uses the chunked layout with
+     * the same rows per chunk, picked so that one row range across all
+     * columns and ticks fits in about chunkBytes. Growth then appends
+     * chunks instead of reallocating, and a chunk is a row range that can
+     * be handed to a worker as a unit (see ChunkEnd()).
+     *
      * Performance characteristics:
      * - AllocateRow: O(C) where C = number of columns
      * - FreeRow (swap-and-pop): O(C)
-     * - GetColumn: O(1) hash lookup
+     * - GetColumn<T> / GetColumnByDenseId: O(1) array lookup
+     * - GetColumnByTypeId: O(1) hash lookup
      * - Iteration: O(N) cache-friendly per column
+     * - ShrinkToFit: O(N * C) contiguous, O(freed chunks) chunked
      *
      * Limitations:
      * - Fixed set of component types after construction
      * - Not thread-safe
      * - Swap-and-pop changes row indices
+     * - The entity list stays contiguous in both layouts
      *
      * Example:
      * @code
@@ -63,19 +81,31 @@ namespace queen
     template <comb::Allocator Allocator> class Table
     {
     public:
-        Table(Allocator& allocator, const wax::Vector<ComponentMeta>& componentMetas, size_t initialCapacity = 64)
+        Table(Allocator& allocator, const wax::Vector<ComponentMeta>& componentMetas, size_t initialCapacity = 64,
+              size_t chunkBytes = 0)
             : m_allocator{&allocator}
             , m_entities{allocator}
             , m_columns{allocator}
             , m_typeToColumnIndex{allocator}
+            , m_denseToColumn{allocator}
+            , m_chunkShift{ChunkShiftFor(componentMetas, chunkBytes)}
         {
             m_entities.Reserve(initialCapacity);
+            m_columns.Reserve(componentMetas.Size());
 
             for (size_t i = 0; i < componentMetas.Size(); ++i)
             {
-                const ComponentMeta& meta = componentMetas[i];
+                ComponentMeta meta = componentMetas[i];
+                meta.m_denseId = meta.ResolveDenseId();
+
+                if (m_denseToColumn.Size() <= meta.m_denseId)
+                {
+                    m_denseToColumn.Resize(meta.m_denseId + 1, kNoColumn);
+                }
+                m_denseToColumn[meta.m_denseId] = static_cast<uint16_t>(m_columns.Size());
+
                 m_typeToColumnIndex.Insert(meta.m_typeId, m_columns.Size());
-                m_columns.EmplaceBack(allocator, meta, initialCapacity);
+                m_columns.EmplaceBack(allocator, meta, initialCapacity, m_chunkShift);
             }
         }
 
@@ -101,6 +131,115 @@ namespace queen
             return row;
         }
 
+        /**
+         * Reserve room for additional rows in the entity list and every column
+         */
+        void Reserve(size_t additionalRows)
+        {
+            const size_t required = m_entities.Size() + additionalRows;
+            m_entities.Reserve(required);
+
+            for (size_t i = 0; i < m_columns.Size(); ++i)
+            {
+                m_columns[i].Reserve(required);
+            }
+        }
+
+        /**
+         * Drop every row, destroying components whose type has a destructor
+         *
+         * Capacity is kept, see ShrinkToFit to release it.
+         */
+        void Clear()
+        {
+            m_entities.Clear();
+            for (size_t i = 0; i < m_columns.Size(); ++i)
+            {
+                m_columns[i].Clear();
+            }
+        }
+
+        /**
+         * Release row capacity beyond max(RowCount(), minCapacity)
+         *
+         * See Column::ShrinkToFit. Used by World::Compact after mass
+         * despawns, growing again later reallocates as usual.
+         *
+         * @return Number of columns that released memory
+         */
+        size_t ShrinkToFit(size_t minCapacity = 0)
+        {
+            const size_t target = m_entities.Size() > minCapacity ? m_entities.Size() : minCapacity;
+            if (m_entities.Capacity() > target)
+            {
+                m_entities.ShrinkToFit();
+                m_entities.Reserve(target);
+            }
+
+            size_t shrunk = 0;
+            for (size_t i = 0; i < m_columns.Size(); ++i)
+            {
+                if (m_columns[i].ShrinkToFit(minCapacity))
+                {
+                    ++shrunk;
+                }
+            }
+            return shrunk;
+        }
+
+        /**
+         * Rows the table holds without growing, the entity list's capacity
+         */
+        [[nodiscard]] size_t Capacity() const noexcept
+        {
+            return m_entities.Capacity();
+        }
+
+        /**
+         * Append count rows whose components are left unconstructed
+         *
+         * The caller must construct every component of every new row (see
+         * Column::GrowUninitialized) before the table is used again.
+         *
+         * @return Index of the first new row
+         */
+        uint32_t AllocateRowsUninitialized(const Entity* entities, size_t count, Tick currentTick = Tick{0})
+        {
+            const uint32_t first = static_cast<uint32_t>(m_entities.Size());
+            Entity* slots = AppendRowsUninitialized(count, currentTick);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                hive::Assert(!entities[i].IsNull(), "Cannot allocate row for null entity");
+                slots[i] = entities[i];
+            }
+
+            return first;
+        }
+
+        /**
+         * Append count rows whose entities and components are left unassigned
+         *
+         * Lets batch spawns allocate entity ids straight into the table. The
+         * caller must write every returned entity slot and construct every
+         * component of every new row before the table is used again.
+         *
+         * @return Entity slots of the new rows, starting at the old RowCount()
+         */
+        [[nodiscard]] Entity* AppendRowsUninitialized(size_t count, Tick currentTick = Tick{0})
+        {
+            const size_t first = m_entities.Size();
+            Reserve(count);
+            m_entities.Resize(first + count);
+
+            for (size_t i = 0; i < m_columns.Size(); ++i)
+            {
+                static_cast<void>(m_columns[i].GrowUninitialized(count, currentTick));
+            }
+
+            return m_entities.Data() + first;
+        }
+
         Entity FreeRow(uint32_t row)
         {
             hive::Assert(row < m_entities.Size(), "Row index out of bounds");
@@ -151,14 +290,45 @@ namespace queen
             return &m_columns[*index];
         }
 
+        [[nodiscard]] Column<Allocator>* GetColumnByDenseId(DenseId denseId) noexcept
+        {
+            if (denseId >= m_denseToColumn.Size() || m_denseToColumn[denseId] == kNoColumn)
+            {
+                return nullptr;
+            }
+            return &m_columns[m_denseToColumn[denseId]];
+        }
+
+        [[nodiscard]] const Column<Allocator>* GetColumnByDenseId(DenseId denseId) const noexcept
+        {
+            if (denseId >= m_denseToColumn.Size() || m_denseToColumn[denseId] == kNoColumn)
+            {
+                return nullptr;
+            }
+            return &m_columns[m_denseToColumn[denseId]];
+        }
+
+        /**
+         * Column by position, in the order of the metas passed at construction
+         */
+        [[nodiscard]] Column<Allocator>& GetColumnAt(size_t index) noexcept
+        {
+            return m_columns[index];
+        }
+
+        [[nodiscard]] const Column<Allocator>& GetColumnAt(size_t index) const noexcept
+        {
+            return m_columns[index];
+        }
+
         template <typename T> [[nodiscard]] Column<Allocator>* GetColumn() noexcept
         {
-            return GetColumnByTypeId(TypeIdOf<T>());
+            return GetColumnByDenseId(DenseIdOf<T>());
         }
 
         template <typename T> [[nodiscard]] const Column<Allocator>* GetColumn() const noexcept
         {
-            return GetColumnByTypeId(TypeIdOf<T>());
+            return GetColumnByDenseId(DenseIdOf<T>());
         }
 
         [[nodiscard]] bool HasComponent(TypeId typeId) const noexcept
@@ -168,7 +338,7 @@ namespace queen
 
         template <typename T> [[nodiscard]] bool HasComponent() const noexcept
         {
-            return HasComponent(TypeIdOf<T>());
+            return GetColumnByDenseId(DenseIdOf<T>()) != nullptr;
         }
 
         [[nodiscard]] Entity GetEntity(uint32_t row) const noexcept
@@ -184,62 +354,24 @@ namespace queen
 
         void SetComponent(uint32_t row, TypeId typeId, const void* data)
         {
-            Column<Allocator>* column = GetColumnByTypeId(typeId);
-            hive::Assert(column != nullptr, "Component type not in table");
-            hive::Assert(row < m_entities.Size(), "Row index out of bounds");
-
-            void* dst = column->GetRaw(row);
-            const ComponentMeta& meta = column->GetMeta();
-
-            if (meta.m_destruct != nullptr)
-            {
-                meta.m_destruct(dst);
-            }
-
-            if (meta.m_copy != nullptr)
-            {
-                meta.m_copy(dst, data);
-            }
-            else
-            {
-                std::memcpy(dst, data, meta.m_size);
-            }
+            CopyInto(GetColumnByTypeId(typeId), row, data);
         }
 
         template <typename T> void SetComponent(uint32_t row, const T& value)
         {
-            SetComponent(row, TypeIdOf<T>(), &value);
+            CopyInto(GetColumn<T>(), row, &value);
         }
 
         template <typename T>
         void SetComponent(uint32_t row, T&& value)
             requires(!std::is_lvalue_reference_v<T &&>)
         {
-            MoveComponent(row, TypeIdOf<std::remove_cvref_t<T>>(), &value);
+            MoveInto(GetColumn<std::remove_cvref_t<T>>(), row, &value);
         }
 
         void MoveComponent(uint32_t row, TypeId typeId, void* data)
         {
-            Column<Allocator>* column = GetColumnByTypeId(typeId);
-            hive::Assert(column != nullptr, "Component type not in table");
-            hive::Assert(row < m_entities.Size(), "Row index out of bounds");
-
-            void* dst = column->GetRaw(row);
-            const ComponentMeta& meta = column->GetMeta();
-
-            if (meta.m_destruct != nullptr)
-            {
-                meta.m_destruct(dst);
-            }
-
-            if (meta.m_move != nullptr)
-            {
-                meta.m_move(dst, data);
-            }
-            else
-            {
-                std::memcpy(dst, data, meta.m_size);
-            }
+            MoveInto(GetColumnByTypeId(typeId), row, data);
         }
 
         [[nodiscard]] size_t RowCount() const noexcept
@@ -255,6 +387,24 @@ namespace queen
             return m_entities.IsEmpty();
         }
 
+        /**
+         * Rows per chunk shared by every column, 0 for the contiguous layout
+         */
+        [[nodiscard]] size_t ChunkRows() const noexcept
+        {
+            return m_chunkShift != 0 ? size_t{1} << m_chunkShift : 0;
+        }
+
+        /**
+         * First row past the chunk containing row, SIZE_MAX when contiguous
+         *
+         * Column pointers taken at row stay valid for every row before it.
+         */
+        [[nodiscard]] size_t ChunkEnd(size_t row) const noexcept
+        {
+            return m_chunkShift != 0 ? ((row >> m_chunkShift) + 1) << m_chunkShift : SIZE_MAX;
+        }
+
         /**
          * Move a row to another table
          *
@@ -277,9 +427,7 @@ namespace queen
             for (size_t i = 0; i < m_columns.Size(); ++i)
             {
                 Column<Allocator>& srcCol = m_columns[i];
-                TypeId typeId = srcCol.GetMeta().m_typeId;
-
-                Column<Allocator>* dstCol = target.GetColumnByTypeId(typeId);
+                Column<Allocator>* dstCol = target.GetColumnByDenseId(srcCol.GetMeta().m_denseId);
                 if (dstCol != nullptr)
                 {
                     void* src = srcCol.GetRaw(sourceRow);
@@ -291,16 +439,9 @@ namespace queen
                         meta.m_destruct(dst);
                     }
 
-                    if (meta.m_move != nullptr)
-                    {
-                        meta.m_move(dst, src);
-                    }
-                    else
-                    {
-                        std::memcpy(dst, src, meta.m_size);
-                    }
+                    meta.MoveConstruct(dst, src);
 
-                    dstCol->GetTicks(destRow) = srcCol.GetTicks(sourceRow);
+                    dstCol->SetTicks(destRow, srcCol.GetTicks(sourceRow));
                     ++movedCount;
                 }
             }
@@ -323,9 +464,78 @@ namespace queen
         }
 
     private:
+        static constexpr uint16_t kNoColumn = UINT16_MAX;
+
+        void CopyInto(Column<Allocator>* column, uint32_t row, const void* data)
+        {
+            hive::Assert(column != nullptr, "Component type not in table");
+            hive::Assert(row < m_entities.Size(), "Row index out of bounds");
+
+            void* dst = column->GetRaw(row);
+            const ComponentMeta& meta = column->GetMeta();
+
+            if (meta.m_destruct != nullptr)
+            {
+                meta.m_destruct(dst);
+            }
+
+            if (meta.m_copy != nullptr)
+            {
+                meta.m_copy(dst, data);
+            }
+            else
+            {
+                std::memcpy(dst, data, meta.m_size);
+            }
+        }
+
+        void MoveInto(Column<Allocator>* column, uint32_t row, void* data)
+        {
+            hive::Assert(column != nullptr, "Component type not in table");
+            hive::Assert(row < m_entities.Size(), "Row index out of bounds");
+
+            void* dst = column->GetRaw(row);
+            const ComponentMeta& meta = column->GetMeta();
+
+            if (meta.m_destruct != nullptr)
+            {
+                meta.m_destruct(dst);
+            }
+
+            meta.MoveConstruct(dst, data);
+        }
+
+        // Largest power-of-two row count whose components and ticks fit in chunkBytes
+        static size_t ChunkShiftFor(const wax::Vector<ComponentMeta>& componentMetas, size_t chunkBytes)
+        {
+            if (chunkBytes == 0)
+            {
+                return 0;
+            }
+
+            size_t rowBytes = 0;
+            for (size_t i = 0; i < componentMetas.Size(); ++i)
+            {
+                rowBytes += componentMetas[i].m_size + sizeof(ComponentTicks);
+            }
+            if (rowBytes == 0)
+            {
+                rowBytes = sizeof(Entity);
+            }
+
+            size_t shift = Column<Allocator>::kTickBlockShift;
+            while ((size_t{2} << shift) * rowBytes <= chunkBytes)
+            {
+                ++shift;
+            }
+            return shift;
+        }
+
         Allocator* m_allocator;
         wax::Vector<Entity> m_entities;
         wax::Vector<Column<Allocator>> m_columns;
         wax::HashMap<TypeId, size_t> m_typeToColumnIndex;
+        wax::Vector<uint16_t> m_denseToColumn;
+        size_t m_chunkShift;
     };
 } // namespace queen
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <hive/core/assert.h>
+
+#include <drone/counter.h>
+#include <drone/job_submitter.h>
+#include <drone/task.h>
+
+#include <queen/core/tick.h>
+
+#include <coroutine>
+
+namespace queen
+{
+    class World;
+
+    /**
+     * Handle passed to coroutine systems registered with SystemBuilder::Async
+     *
+     * An async system is a drone::Task<void> coroutine that may stay
+     * suspended across several frames. It is only ever resumed from its
+     * own system executor, so the code between two suspension points runs
+     * inside the schedule with the system's declared access, and commands
+     * recorded there are flushed at the normal sync point. While the
+     * coroutine waits, a run only checks the wait condition, so the
+     * system's slot in the schedule stays nearly free while the expensive
+     * work overlaps the following frames.
+     *
+     * The coroutine suspends through the context only:
+     * - NextTick(): resume on the system's next run
+     * - WaitFor(counter): resume on the first run where counter is done,
+     *   typically a batch of jobs submitted through Jobs()
+     *
+     * Memory layout:
+     * ┌──────────────────────────────────────────────────────────────┐
+     * │ world_: World* (set while a section runs, nullptr otherwise) │
+     * │ jobs_: drone::JobSubmitter                                   │
+     * │ tick_: Tick of the running section                           │
+     * │ pending_: coroutine_handle<> (innermost suspended frame)     │
+     * │ counter_: const drone::Counter* (WaitFor target or nullptr)  │
+     * └──────────────────────────────────────────────────────────────┘
+     *
+     * Performance characteristics:
+     * - Waiting run: O(1), one counter load
+     * - Resumed section: cost of the user code up to the next suspension
+     *
+     * Limitations:
+     * - drone::ScheduleOn and drone::AwaitCounter resume on a worker
+     *   outside the schedule and must not be awaited by async systems
+     * - GetWorld() is only valid between suspension points
+     * - Jobs() is invalid under the sequential World::Update, see
+     *   World::GetJobSubmitter()
+     * - Jobs still running when the system is removed must not reference
+     *   the coroutine frame
+     *
+     * Example:
+     * @code
+     *   world.System<Read<NavAgent>>("Pathfinding")
+     *       .Async([](AsyncSystemContext& ctx) -> drone::Task<> {
+     *           PathBatch batch{};  // Lives in the coroutine frame across frames
+     *           GatherRequests(ctx.GetWorld(), batch);
+     *
+     *           drone::JobDecl job{};
+     *           job.m_func = [](void* data) { SolvePaths(*static_cast<PathBatch*>(data)); };
+     *           job.m_userData = &batch;
+     *
+     *           drone::Counter done;
+     *           ctx.Jobs().Submit(job, done);
+     *           co_await ctx.WaitFor(done);
+     *           ApplyPaths(ctx.GetWorld(), batch);
+     *       });
+     * @endcode
+     */
+    class AsyncSystemContext
+    {
+    public:
+        struct NextTickAwaiter
+        {
+            AsyncSystemContext* m_context;
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) noexcept
+            {
+                m_context->Suspend(handle, nullptr);
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+        };
+
+        struct CounterAwaiter
+        {
+            AsyncSystemContext* m_context;
+            const drone::Counter* m_counter;
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return m_counter->IsDone();
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) noexcept
+            {
+                m_context->Suspend(handle, m_counter);
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+        };
+
+        /**
+         * World of the running section
+         */
+        [[nodiscard]] World& GetWorld() const noexcept
+        {
+            hive::Assert(m_world != nullptr, "AsyncSystemContext::GetWorld() used while suspended");
+            return *m_world;
+        }
+
+        [[nodiscard]] Tick CurrentTick() const noexcept
+        {
+            return m_tick;
+        }
+
+        [[nodiscard]] const drone::JobSubmitter& Jobs() const noexcept
+        {
+            return m_jobs;
+        }
+
+        /**
+         * Suspend until the system's next run
+         */
+        [[nodiscard]] NextTickAwaiter NextTick() noexcept
+        {
+            return NextTickAwaiter{this};
+        }
+
+        /**
+         * Suspend until counter reaches zero, checked once per system run
+         *
+         * Does not suspend when the counter is already done.
+         */
+        [[nodiscard]] CounterAwaiter WaitFor(const drone::Counter& counter) noexcept
+        {
+            return CounterAwaiter{this, &counter};
+        }
+
+        /**
+         * Whether a suspended coroutine can be resumed on this run
+         */
+        [[nodiscard]] bool IsResumable() const noexcept
+        {
+            return m_pending && (m_counter == nullptr || m_counter->IsDone());
+        }
+
+        [[nodiscard]] bool IsSuspended() const noexcept
+        {
+            return static_cast<bool>(m_pending);
+        }
+
+        // Called by the system executor around each section
+        void BeginSection(World& world, Tick tick, const drone::JobSubmitter& jobs) noexcept
+        {
+            m_world = &world;
+            m_tick = tick;
+            m_jobs = jobs;
+        }
+
+        void EndSection() noexcept
+        {
+            m_world = nullptr;
+        }
+
+        void ResumePending()
+        {
+            std::coroutine_handle<> handle = m_pending;
+            m_pending = nullptr;
+            m_counter = nullptr;
+            handle.resume();
+        }
+
+        // Drop the pending resume point, the owning Task destroys the frames
+        void Reset() noexcept
+        {
+            m_pending = nullptr;
+            m_counter = nullptr;
+        }
+
+    private:
+        void Suspend(std::coroutine_handle<> handle, const drone::Counter* counter) noexcept
+        {
+            m_pending = handle;
+            m_counter = counter;
+        }
+
+        World* m_world{nullptr};
+        drone::JobSubmitter m_jobs{};
+        Tick m_tick{0};
+        std::coroutine_handle<> m_pending{};
+        const drone::Counter* m_counter{nullptr};
+    };
+} // namespace queen
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <hive/core/assert.h>
+
 #include <comb/allocator_concepts.h>
 
 #include <queen/core/tick.h>
+#include <queen/core/type_id.h>
 #include <queen/query/query_descriptor.h>
 #include <queen/system/access_descriptor.h>
 #include <queen/system/system_id.h>
+#include <queen/system/system_stats.h>
 
 #include <cstring>
 
@@ -31,6 +35,28 @@ namespace queen
      */
     using SystemExecutorFn = void (*)(World& world, void* userData);
 
+    /**
+     * Returns the number of entities the system's last run visited
+     *
+     * Set by SystemBuilder for query-driven systems, reads the same
+     * userData as the executor.
+     */
+    using SystemEntityCounterFn = size_t (*)(const void* userData);
+
+    /**
+     * Returns true if any component the system's query reads was added or
+     * changed at or after since
+     *
+     * Set by SystemBuilder for query-driven systems, reads the same
+     * userData as the executor.
+     */
+    using SystemChangeProbeFn = bool (*)(const void* userData, Tick since);
+
+    /**
+     * User run condition, the system is skipped when it returns false
+     */
+    using SystemConditionFn = bool (*)(World& world, void* conditionData);
+
     /**
      * Describes a registered system
      *
@@ -47,10 +73,30 @@ namespace queen
      * │ executor_fn_: function pointer                                  │
      * │ user_data_: void* (for lambda captures)                         │
      * │ executor_mode_: SystemExecutor                                  │
+     * │ run criteria: change probe flag, resource triggers, condition   │
+     * │ stats_: SystemStats (always-on execution counters)              │
      * └─────────────────────────────────────────────────────────────────┘
      *
+     * Run criteria:
+     * - RunIfChanged: run when an input column (Read, Maybe or change
+     *   filter term) of a matched archetype was added to or changed.
+     *   Plain writes through Write<T> are not stamped and do not count
+     * - Resource triggers: run when one of the resources changed (see
+     *   World::MarkResourceChanged)
+     * - Run period: with RunEvery(n) the system only runs on ticks where
+     *   (tick + phase) % n == 0, SystemStorage picks the phase
+     * - Triggers are OR-ed: with any configured, the system runs if at
+     *   least one fires. The condition must hold in addition.
+     * - Changes stamped with the last run tick still trigger, since ticks
+     *   cannot order them against the run. A system may therefore run
+     *   once more than needed, but never misses a change.
+     * - A skipped system keeps its last run tick, so changes made while
+     *   it was skipped still trigger it later
+     *
      * Performance characteristics:
      * - Execution: O(1) function call + query iteration
+     * - ShouldRun: O(A * S) column tick summaries with RunIfChanged
+     *   (A matched archetypes, S data terms), O(R) resource lookups
      * - Name lookup: O(n) linear search (use SystemId for fast access)
      *
      * Limitations:
@@ -69,6 +115,7 @@ namespace queen
     public:
         static constexpr size_t kMaxNameLength = 63;
         static constexpr size_t kMaxExplicitDeps = 8;
+        static constexpr size_t kMaxResourceTriggers = 8;
 
         SystemDescriptor(Allocator& allocator, SystemId id, const char* name)
             : m_id{id}
@@ -78,6 +125,11 @@ namespace queen
             , m_executorFn{nullptr}
             , m_userData{nullptr}
             , m_destructorFn{nullptr}
+            , m_entityCounterFn{nullptr}
+            , m_changeProbeFn{nullptr}
+            , m_conditionFn{nullptr}
+            , m_conditionData{nullptr}
+            , m_conditionDestructorFn{nullptr}
             , m_executorMode{SystemExecutor::PARALLEL}
             , m_enabled{true}
         {
@@ -105,6 +157,7 @@ namespace queen
                 }
                 m_allocator->Deallocate(m_userData);
             }
+            ReleaseCondition();
         }
 
         SystemDescriptor(const SystemDescriptor&) = delete;
@@ -117,17 +170,30 @@ namespace queen
             , m_executorFn{other.m_executorFn}
             , m_userData{other.m_userData}
             , m_destructorFn{other.m_destructorFn}
+            , m_entityCounterFn{other.m_entityCounterFn}
+            , m_changeProbeFn{other.m_changeProbeFn}
+            , m_conditionFn{other.m_conditionFn}
+            , m_conditionData{other.m_conditionData}
+            , m_conditionDestructorFn{other.m_conditionDestructorFn}
             , m_executorMode{other.m_executorMode}
             , m_enabled{other.m_enabled}
+            , m_runIfChanged{other.m_runIfChanged}
+            , m_runPeriod{other.m_runPeriod}
+            , m_runPhase{other.m_runPhase}
             , m_afterCount{other.m_afterCount}
             , m_beforeCount{other.m_beforeCount}
+            , m_resourceTriggerCount{other.m_resourceTriggerCount}
             , m_lastRunTick{other.m_lastRunTick}
+            , m_stats{other.m_stats}
         {
             std::memcpy(m_name, other.m_name, sizeof(m_name));
             std::memcpy(m_explicitAfter, other.m_explicitAfter, sizeof(SystemId) * m_afterCount);
             std::memcpy(m_explicitBefore, other.m_explicitBefore, sizeof(SystemId) * m_beforeCount);
+            std::memcpy(m_resourceTriggers, other.m_resourceTriggers, sizeof(TypeId) * m_resourceTriggerCount);
             other.m_userData = nullptr;
             other.m_destructorFn = nullptr;
+            other.m_conditionData = nullptr;
+            other.m_conditionDestructorFn = nullptr;
         }
 
         SystemDescriptor& operator=(SystemDescriptor&& other) noexcept
@@ -142,6 +208,7 @@ namespace queen
                     }
                     m_allocator->Deallocate(m_userData);
                 }
+                ReleaseCondition();
 
                 m_id = other.m_id;
                 m_allocator = other.m_allocator;
@@ -151,16 +218,29 @@ namespace queen
                 m_executorFn = other.m_executorFn;
                 m_userData = other.m_userData;
                 m_destructorFn = other.m_destructorFn;
+                m_entityCounterFn = other.m_entityCounterFn;
+                m_changeProbeFn = other.m_changeProbeFn;
+                m_conditionFn = other.m_conditionFn;
+                m_conditionData = other.m_conditionData;
+                m_conditionDestructorFn = other.m_conditionDestructorFn;
                 m_executorMode = other.m_executorMode;
                 m_enabled = other.m_enabled;
+                m_runIfChanged = other.m_runIfChanged;
+                m_runPeriod = other.m_runPeriod;
+                m_runPhase = other.m_runPhase;
                 m_afterCount = other.m_afterCount;
                 m_beforeCount = other.m_beforeCount;
+                m_resourceTriggerCount = other.m_resourceTriggerCount;
                 std::memcpy(m_explicitAfter, other.m_explicitAfter, sizeof(SystemId) * m_afterCount);
                 std::memcpy(m_explicitBefore, other.m_explicitBefore, sizeof(SystemId) * m_beforeCount);
+                std::memcpy(m_resourceTriggers, other.m_resourceTriggers, sizeof(TypeId) * m_resourceTriggerCount);
                 m_lastRunTick = other.m_lastRunTick;
+                m_stats = other.m_stats;
 
                 other.m_userData = nullptr;
                 other.m_destructorFn = nullptr;
+                other.m_conditionData = nullptr;
+                other.m_conditionDestructorFn = nullptr;
             }
             return *this;
         }
@@ -201,6 +281,14 @@ namespace queen
         {
             return m_lastRunTick;
         }
+        [[nodiscard]] const SystemStats& Stats() const noexcept
+        {
+            return m_stats;
+        }
+        [[nodiscard]] SystemStats& Stats() noexcept
+        {
+            return m_stats;
+        }
 
         void SetExecutorMode(SystemExecutor mode) noexcept
         {
@@ -229,21 +317,132 @@ namespace queen
             m_executorFn = fn;
             m_userData = userData;
             m_destructorFn = destructor;
+            m_entityCounterFn = nullptr;
+            m_changeProbeFn = nullptr;
+        }
+
+        /**
+         * Set the entity counter, must follow SetExecutor (which clears it)
+         */
+        void SetEntityCounter(SystemEntityCounterFn fn) noexcept
+        {
+            m_entityCounterFn = fn;
+        }
+
+        /**
+         * Set the change probe used by RunIfChanged, must follow SetExecutor
+         */
+        void SetChangeProbe(SystemChangeProbeFn fn) noexcept
+        {
+            m_changeProbeFn = fn;
         }
 
         /**
-         * Execute the system and update last_run_tick
+         * Only run when the query's input components changed since the last run
+         *
+         * Has no effect on systems without a query (no change probe).
+         */
+        void SetRunIfChanged(bool enabled) noexcept
+        {
+            m_runIfChanged = enabled;
+        }
+
+        /**
+         * Only run when the resource changed since the last run
+         *
+         * Up to kMaxResourceTriggers resources, any of them triggers a run.
+         */
+        void AddResourceTrigger(TypeId resourceType) noexcept
+        {
+            hive::Assert(m_resourceTriggerCount < kMaxResourceTriggers, "Too many resource triggers");
+            if (m_resourceTriggerCount < kMaxResourceTriggers)
+            {
+                m_resourceTriggers[m_resourceTriggerCount++] = resourceType;
+            }
+        }
+
+        /**
+         * Set the user run condition, replacing any previous one
+         *
+         * conditionData is owned by the descriptor and released with
+         * destructor then the allocator, like the executor's userData.
+         */
+        void SetCondition(SystemConditionFn fn, void* conditionData, void (*destructor)(void*))
+        {
+            ReleaseCondition();
+            m_conditionFn = fn;
+            m_conditionData = conditionData;
+            m_conditionDestructorFn = destructor;
+        }
+
+        /**
+         * Only run on ticks where (tick + phase) % period == 0
+         *
+         * A period of 1 runs every tick.
+         */
+        void SetRunPeriod(uint32_t period, uint32_t phase) noexcept
+        {
+            hive::Assert(period > 0, "Run period must be at least 1");
+            m_runPeriod = period > 0 ? period : 1;
+            m_runPhase = phase % m_runPeriod;
+        }
+
+        [[nodiscard]] uint32_t RunPeriod() const noexcept
+        {
+            return m_runPeriod;
+        }
+
+        [[nodiscard]] uint32_t RunPhase() const noexcept
+        {
+            return m_runPhase;
+        }
+
+        [[nodiscard]] bool HasRunCriteria() const noexcept
+        {
+            return m_runPeriod > 1 || m_runIfChanged || m_resourceTriggerCount > 0 || m_conditionFn != nullptr;
+        }
+
+        /**
+         * Entities the last run iterated, 0 for systems without a query
+         */
+        [[nodiscard]] size_t CountEntities() const
+        {
+            return m_entityCounterFn != nullptr ? m_entityCounterFn(m_userData) : 0;
+        }
+
+        /**
+         * Check whether the system runs this tick
+         *
+         * False without an executor, when disabled, or when the run
+         * criteria are not met. Evaluated once the system's dependencies
+         * completed. Implementation in system_impl.h.
+         */
+        [[nodiscard]] bool ShouldRun(World& world);
+
+        /**
+         * Run the executor unconditionally and update last_run_tick
+         */
+        void Run(World& world, Tick currentTick)
+        {
+            m_executorFn(world, m_userData);
+            m_lastRunTick = currentTick;
+        }
+
+        /**
+         * Execute the system if ShouldRun() and update last_run_tick
          *
          * @param world The world to execute on
          * @param current_tick The current world tick (for change detection)
+         * @return true if the system ran, false if it was skipped
          */
-        void Execute(World& world, Tick currentTick)
+        bool Execute(World& world, Tick currentTick)
         {
-            if (m_executorFn != nullptr && m_enabled)
+            if (!ShouldRun(world))
             {
-                m_executorFn(world, m_userData);
-                m_lastRunTick = currentTick;
+                return false;
             }
+            Run(world, currentTick);
+            return true;
         }
 
         [[nodiscard]] bool HasExecutor() const noexcept
@@ -285,6 +484,21 @@ namespace queen
         }
 
     private:
+        void ReleaseCondition()
+        {
+            if (m_conditionData != nullptr)
+            {
+                if (m_conditionDestructorFn != nullptr)
+                {
+                    m_conditionDestructorFn(m_conditionData);
+                }
+                m_allocator->Deallocate(m_conditionData);
+            }
+            m_conditionFn = nullptr;
+            m_conditionData = nullptr;
+            m_conditionDestructorFn = nullptr;
+        }
+
         SystemId m_id;
         Allocator* m_allocator;
         char m_name[kMaxNameLength + 1];
@@ -293,12 +507,23 @@ namespace queen
         SystemExecutorFn m_executorFn;
         void* m_userData;
         void (*m_destructorFn)(void*);
+        SystemEntityCounterFn m_entityCounterFn;
+        SystemChangeProbeFn m_changeProbeFn;
+        SystemConditionFn m_conditionFn;
+        void* m_conditionData;
+        void (*m_conditionDestructorFn)(void*);
         SystemExecutor m_executorMode;
         bool m_enabled;
+        bool m_runIfChanged{false};
+        uint32_t m_runPeriod{1};
+        uint32_t m_runPhase{0};
         uint8_t m_afterCount{0};
         uint8_t m_beforeCount{0};
+        uint8_t m_resourceTriggerCount{0};
         SystemId m_explicitAfter[kMaxExplicitDeps];
         SystemId m_explicitBefore[kMaxExplicitDeps];
+        TypeId m_resourceTriggers[kMaxResourceTriggers];
         Tick m_lastRunTick{0};
+        SystemStats m_stats{};
     };
 } // namespace queen
@@ -7,6 +7,7 @@
 #include <queen/command/commands.h>
 #include <queen/query/query.h>
 #include <queen/query/query_term.h>
+#include <queen/system/async_system.h>
 #include <queen/system/resource_param.h>
 #include <queen/system/system.h>
 #include <queen/system/system_storage.h>
@@ -145,6 +146,124 @@ namespace queen
             return *this;
         }
 
+        /**
+         * Skip the system on ticks where none of its query components changed
+         *
+         * Checks the tick summary of every input column (Read, Maybe and
+         * change filter terms) in the matched archetypes, no row is
+         * visited. Write terms are outputs and do not trigger the system.
+         * Skipped systems release their dependents immediately.
+         *
+         * Only stamped changes are seen: spawning or adding the component,
+         * World::Set and the raw setters, and QueryChunk::MarkChanged<T>().
+         * Plain writes through a Write<T> reference in Each or ParEach are
+         * not tracked, so a writer feeding this system should use EachChunk
+         * and mark the rows it modified.
+         *
+         * Example:
+         * @code
+         *   world.System<Read<Health>, Write<HealthBar>>("UpdateHealthBars")
+         *       .RunIfChanged()
+         *       .Each([](const Health& hp, HealthBar& bar) { ... });
+         * @endcode
+         */
+        SystemBuilder& RunIfChanged()
+        {
+            m_descriptor->SetRunIfChanged(true);
+            return *this;
+        }
+
+        /**
+         * Skip the system on ticks where resource T did not change
+         *
+         * A resource changes on InsertResource, when a system takes it as
+         * ResMut<T>, or through World::MarkResourceChanged<T>(). Adds read
+         * access to T so the check is ordered after the resource's writers.
+         * A system taking ResMut<T> itself would retrigger every tick.
+         */
+        template <typename T> SystemBuilder& RunIfResourceChanged()
+        {
+            m_descriptor->Access().template AddResourceRead<T>();
+            m_descriptor->AddResourceTrigger(TypeIdOf<T>());
+            return *this;
+        }
+
+        /**
+         * Run the system on one tick out of every n
+         *
+         * The phase is picked so that reduced-rate systems registered with
+         * compatible periods land on different ticks instead of all running
+         * on the same frame. Skipped ticks release dependents immediately.
+         *
+         * Example:
+         * @code
+         *   world.System<Read<Transform>, Write<AiState>>("AiPlanning")
+         *       .RunEvery(4)
+         *       .Each([](const Transform& t, AiState& ai) { ... });
+         * @endcode
+         */
+        SystemBuilder& RunEvery(uint32_t n)
+        {
+            hive::Assert(n > 0, "RunEvery needs a period of at least 1");
+            m_descriptor->SetRunPeriod(n, m_storage->AssignRunPhase(n));
+            return *this;
+        }
+
+        /**
+         * Process about 1/n of the matched entities per run
+         *
+         * A cursor kept in SystemStorage rotates through the query's rows,
+         * so every entity is visited once every n runs. The cursor is kept
+         * when new archetypes are matched. Only supported by Each,
+         * EachWithEntity, EachWithCommands, EachWithRes and EachWithResMut.
+         *
+         * Example:
+         * @code
+         *   world.System<Write<Visibility>, Read<Transform>>("Culling")
+         *       .TimeSliced(4)
+         *       .Each([](Visibility& v, const Transform& t) { ... });
+         * @endcode
+         */
+        SystemBuilder& TimeSliced(uint32_t n)
+        {
+            m_storage->SetTimeSliced(m_descriptor->Id(), n);
+            return *this;
+        }
+
+        /**
+         * Only run the system on ticks where predicate(world) returns true
+         *
+         * The predicate is evaluated once the system's dependencies have
+         * completed, possibly on a worker thread, so it must only read
+         * state the system declares access to. Replaces a previous RunIf.
+         *
+         * Example:
+         * @code
+         *   world.System("Autosave")
+         *       .WithResource<Settings>()
+         *       .RunIf([](World& w) { return w.Resource<Settings>()->autosave; })
+         *       .Run([](World& w) { ... });
+         * @endcode
+         */
+        template <typename F> SystemBuilder& RunIf(F&& predicate)
+        {
+            using PredicateType = std::decay_t<F>;
+
+            void* conditionData = m_allocator->Allocate(sizeof(PredicateType), alignof(PredicateType));
+            new (conditionData) PredicateType{std::forward<F>(predicate)};
+
+            auto condition = [](World& world, void* data) -> bool {
+                return (*static_cast<PredicateType*>(data))(world);
+            };
+
+            auto destructor = [](void* data) {
+                static_cast<PredicateType*>(data)->~PredicateType();
+            };
+
+            m_descriptor->SetCondition(condition, conditionData, destructor);
+            return *this;
+        }
+
         /**
          * Register an entity iteration callback
          *
@@ -166,6 +285,70 @@ namespace queen
          */
         template <typename F> SystemId EachWithEntity(F&& func); // Implementation in system_builder_impl.h
 
+        /**
+         * Register an entity iteration callback that runs over row ranges in parallel
+         *
+         * Under World::UpdateParallel the matched rows are split into batches of at
+         * least minBatchSize rows and run on the scheduler's job submitter. Without
+         * a job submitter it behaves like Each(). The callback is invoked
+         * concurrently and must only touch the components it receives.
+         *
+         * @tparam F Lambda type
+         * @param func The callback function
+         * @param minBatchSize Minimum rows per job
+         * @return SystemId for the registered system
+         *
+         * Example:
+         * @code
+         *   world.System<Read<Velocity>, Write<Position>>("Integrate")
+         *       .ParEach([](const Velocity& vel, Position& pos) {
+         *           pos.x += vel.dx;
+         *       }, 4096);
+         * @endcode
+         */
+        template <typename F>
+        SystemId ParEach(F&& func,
+                         size_t minBatchSize = kDefaultParEachBatchSize); // Implementation in system_builder_impl.h
+
+        /**
+         * Register a callback that iterates contiguous chunks of rows
+         *
+         * The callback receives a QueryChunk followed by one wax::Span per data
+         * term (see Query::EachChunk), so it can run tight or SIMD loops over
+         * the component arrays.
+         *
+         * @tparam F Lambda type (const QueryChunk<Allocator>&, wax::Span<...>...)
+         * @param func The callback function
+         * @return SystemId for the registered system
+         *
+         * Example:
+         * @code
+         *   world.System<Read<Velocity>, Write<Position>>("Integrate")
+         *       .EachChunk([](const auto& chunk, wax::Span<const Velocity> vel, wax::Span<Position> pos) {
+         *           for (size_t i = 0; i < chunk.Size(); ++i) {
+         *               pos[i].x += vel[i].dx;
+         *           }
+         *       });
+         * @endcode
+         */
+        template <typename F> SystemId EachChunk(F&& func); // Implementation in system_builder_impl.h
+
+        /**
+         * Register a coroutine system that may span several frames
+         *
+         * func(AsyncSystemContext&) returns a drone::Task<void>. The task
+         * is started on the system's first run and resumed from later runs
+         * once its wait condition (ctx.NextTick(), ctx.WaitFor(counter)) is
+         * met, always from this system's executor. When it completes, the
+         * next run starts a new task. The query terms only declare access,
+         * the coroutine builds its own queries through ctx.GetWorld().
+         *
+         * @tparam F Callable returning drone::Task<void>
+         * @param func Coroutine factory
+         * @return SystemId for the registered system
+         */
+        template <typename F> SystemId Async(F&& func); // Implementation in system_builder_impl.h
+
         /**
          * Register an entity iteration callback with Commands access
          *
@@ -362,6 +545,92 @@ namespace queen
             return *this;
         }
 
+        /**
+         * Skip the system on ticks where resource T did not change
+         *
+         * A resource changes on InsertResource, when a system takes it as
+         * ResMut<T>, or through World::MarkResourceChanged<T>(). Adds read
+         * access to T so the check is ordered after the resource's writers.
+         * A system taking ResMut<T> itself would retrigger every tick.
+         */
+        template <typename T> SystemBuilder& RunIfResourceChanged()
+        {
+            m_descriptor->Access().template AddResourceRead<T>();
+            m_descriptor->AddResourceTrigger(TypeIdOf<T>());
+            return *this;
+        }
+
+        /**
+         * Run the system on one tick out of every n
+         *
+         * The phase is picked so that reduced-rate systems registered with
+         * compatible periods land on different ticks instead of all running
+         * on the same frame. Skipped ticks release dependents immediately.
+         *
+         * Example:
+         * @code
+         *   world.System<Read<Transform>, Write<AiState>>("AiPlanning")
+         *       .RunEvery(4)
+         *       .Each([](const Transform& t, AiState& ai) { ... });
+         * @endcode
+         */
+        SystemBuilder& RunEvery(uint32_t n)
+        {
+            hive::Assert(n > 0, "RunEvery needs a period of at least 1");
+            m_descriptor->SetRunPeriod(n, m_storage->AssignRunPhase(n));
+            return *this;
+        }
+
+        /**
+         * Only run the system on ticks where predicate(world) returns true
+         *
+         * The predicate is evaluated once the system's dependencies have
+         * completed, possibly on a worker thread, so it must only read
+         * state the system declares access to. Replaces a previous RunIf.
+         *
+         * Example:
+         * @code
+         *   world.System("Autosave")
+         *       .WithResource<Settings>()
+         *       .RunIf([](World& w) { return w.Resource<Settings>()->autosave; })
+         *       .Run([](World& w) { ... });
+         * @endcode
+         */
+        template <typename F> SystemBuilder& RunIf(F&& predicate)
+        {
+            using PredicateType = std::decay_t<F>;
+
+            void* conditionData = m_allocator->Allocate(sizeof(PredicateType), alignof(PredicateType));
+            new (conditionData) PredicateType{std::forward<F>(predicate)};
+
+            auto condition = [](World& world, void* data) -> bool {
+                return (*static_cast<PredicateType*>(data))(world);
+            };
+
+            auto destructor = [](void* data) {
+                static_cast<PredicateType*>(data)->~PredicateType();
+            };
+
+            m_descriptor->SetCondition(condition, conditionData, destructor);
+            return *this;
+        }
+
+        /**
+         * Register a coroutine system that may span several frames
+         *
+         * func(AsyncSystemContext&) returns a drone::Task<void>. The task
+         * is started on the system's first run and resumed from later runs
+         * once its wait condition (ctx.NextTick(), ctx.WaitFor(counter)) is
+         * met, always from this system's executor. When it completes, the
+         * next run starts a new task. Declare resource access with
+         * WithResource/WithResourceMut.
+         *
+         * @tparam F Callable returning drone::Task<void>
+         * @param func Coroutine factory
+         * @return SystemId for the registered system
+         */
+        template <typename F> SystemId Async(F&& func); // Implementation in system_builder_impl.h
+
         template <typename F> SystemId Run(F&& func)
         {
             using FuncType = std::decay_t<F>;
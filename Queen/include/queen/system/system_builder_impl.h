@@ -9,6 +9,157 @@
 
 namespace queen
 {
+    namespace detail
+    {
+        /**
+         * Executor state for query-driven systems
+         *
+         * Owns the user callback and a Query built once at registration. The
+         * query state is registered with the World so archetypes created later
+         * are matched incrementally, and the executor iterates the cached
+         * matches without taking the persistent allocator mutex. Each run
+         * first hands the system's last_run_tick to the query so Added/Changed
+         * filters skip what the system already saw. Systems registered with
+         * TimeSliced(n) fetch their rotating slice from the SystemStorage
+         * cursor before each run. The executor tallies the rows it visits so
+         * SystemStats never has to count the query after the run.
+         */
+        template <typename FuncType, comb::Allocator Allocator, typename... Terms> struct CachedQuerySystem
+        {
+            template <typename F>
+            CachedQuerySystem(World& world, Allocator& allocator, SystemStorage<Allocator>& storage, SystemId id,
+                              F&& func)
+                : m_world{&world}
+                , m_storage{&storage}
+                , m_id{id}
+                , m_fn{std::forward<F>(func)}
+                , m_query{allocator, world.GetComponentIndex(), &world.GetSparseStorages(),
+                          &world.GetEntityLocations()}
+            {
+                m_world->RegisterQueryState(&m_query.GetState());
+            }
+
+            ~CachedQuerySystem()
+            {
+                m_world->UnregisterQueryState(&m_query.GetState());
+            }
+
+            CachedQuerySystem(const CachedQuerySystem&) = delete;
+            CachedQuerySystem& operator=(const CachedQuerySystem&) = delete;
+
+            // Change filters compare against the tick of this system's previous run
+            void BeginRun()
+            {
+                m_query.SetLastRunTick(m_storage->GetSystem(m_id)->LastRunTick());
+            }
+
+            // Slice of this run for time-sliced systems, nullptr when every row is visited
+            const SystemSliceCursor* NextSlice()
+            {
+                SystemSliceCursor* cursor = m_storage->SliceCursor(m_id);
+                if (cursor != nullptr)
+                {
+                    cursor->Advance(m_query.EntityCount());
+                }
+                return cursor;
+            }
+
+            World* m_world;
+            SystemStorage<Allocator>* m_storage;
+            SystemId m_id;
+            FuncType m_fn;
+            Query<Allocator, Terms...> m_query;
+            size_t m_visited{0};
+        };
+
+        /**
+         * Executor state for coroutine systems
+         *
+         * Holds the coroutine factory, the task in flight and its context.
+         * A run either starts a new task, resumes the suspended one when its
+         * wait condition is met, or returns immediately.
+         */
+        template <typename FuncType> struct AsyncSystemState
+        {
+            template <typename F>
+            explicit AsyncSystemState(F&& func)
+                : m_fn{std::forward<F>(func)}
+            {
+            }
+
+            AsyncSystemState(const AsyncSystemState&) = delete;
+            AsyncSystemState& operator=(const AsyncSystemState&) = delete;
+
+            void Step(World& world)
+            {
+                if (m_running && !m_context.IsResumable())
+                {
+                    return;
+                }
+
+                m_context.BeginSection(world, world.CurrentTick(), world.GetJobSubmitter());
+                if (m_running)
+                {
+                    m_context.ResumePending();
+                }
+                else
+                {
+                    m_task = m_fn(m_context);
+                    m_running = true;
+                    // Same entry point as drone::SyncWait, the task runs until its first suspension
+                    auto awaiter = m_task.operator co_await();
+                    awaiter.m_handle.resume();
+                }
+                m_context.EndSection();
+
+                if (m_task.IsReady())
+                {
+                    m_task = drone::Task<void>{};
+                    m_context.Reset();
+                    m_running = false;
+                }
+            }
+
+            FuncType m_fn;
+            AsyncSystemContext m_context{};
+            drone::Task<void> m_task{};
+            bool m_running{false};
+        };
+
+        // SystemEntityCounterFn for CachedQuerySystem-based executors
+        template <typename StateType> size_t CountCachedQueryEntities(const void* data)
+        {
+            return static_cast<const StateType*>(data)->m_visited;
+        }
+
+        // EachWithEntity over the state's query, limited to this run's slice for time-sliced systems
+        template <typename StateType, typename Func> void EachCachedWithEntity(StateType& state, Func&& func)
+        {
+            state.BeginRun();
+            size_t visited = 0;
+            auto counted = [&visited, &func](Entity e, auto&&... components) {
+                ++visited;
+                func(e, std::forward<decltype(components)>(components)...);
+            };
+
+            if (const SystemSliceCursor* slice = state.NextSlice())
+            {
+                state.m_query.EachWithEntityInRows(slice->m_first, slice->m_count, counted);
+            }
+            else
+            {
+                state.m_query.EachWithEntity(counted);
+            }
+            state.m_visited = visited;
+        }
+
+        // SystemChangeProbeFn for CachedQuerySystem-based executors
+        template <typename StateType> bool CachedQueryChangedSince(const void* data, Tick since)
+        {
+            return static_cast<const StateType*>(data)->m_query.ChangedSince(since);
+        }
+    } // namespace detail
+
     // SystemBuilder<Allocator, Terms...> implementations
 
     template <comb::Allocator Allocator, typename... Terms>
@@ -17,21 +168,39 @@ namespace queen
     {
         using FuncType = std::decay_t<F>;
 
-        void* userData = m_allocator->Allocate(sizeof(FuncType), alignof(FuncType));
-        new (userData) FuncType{std::forward<F>(func)};
-
-        auto executor = [](World& world, void* data) {
-            FuncType* fn = static_cast<FuncType*>(data);
-            // Use locked version to protect Query lifetime (construction + destruction)
-            world.template QueryEachLocked<Terms...>(*fn);
+        using StateType = detail::CachedQuerySystem<FuncType, Allocator, Terms...>;
+
+        void* userData = m_allocator->Allocate(sizeof(StateType), alignof(StateType));
+        new (userData) StateType{*m_world, *m_allocator, *m_storage, m_descriptor->Id(), std::forward<F>(func)};
+
+        auto executor = [](World&, void* data) {
+            StateType* state = static_cast<StateType*>(data);
+            state->BeginRun();
+            size_t visited = 0;
+            auto counted = [&visited, state](auto&&... components) {
+                ++visited;
+                state->m_fn(std::forward<decltype(components)>(components)...);
+            };
+
+            if (const SystemSliceCursor* slice = state->NextSlice())
+            {
+                state->m_query.EachInRows(slice->m_first, slice->m_count, counted);
+            }
+            else
+            {
+                state->m_query.Each(counted);
+            }
+            state->m_visited = visited;
         };
 
         auto destructor = [](void* data) {
-            FuncType* fn = static_cast<FuncType*>(data);
-            fn->~FuncType();
+            StateType* state = static_cast<StateType*>(data);
+            state->~StateType();
         };
 
         m_descriptor->SetExecutor(executor, userData, destructor);
+        m_descriptor->SetEntityCounter(&detail::CountCachedQueryEntities<StateType>);
+        m_descriptor->SetChangeProbe(&detail::CachedQueryChangedSince<StateType>);
         return m_descriptor->Id();
     }
 
@@ -41,21 +210,98 @@ namespace queen
     {
         using FuncType = std::decay_t<F>;
 
-        void* userData = m_allocator->Allocate(sizeof(FuncType), alignof(FuncType));
-        new (userData) FuncType{std::forward<F>(func)};
+        using StateType = detail::CachedQuerySystem<FuncType, Allocator, Terms...>;
+
+        void* userData = m_allocator->Allocate(sizeof(StateType), alignof(StateType));
+        new (userData) StateType{*m_world, *m_allocator, *m_storage, m_descriptor->Id(), std::forward<F>(func)};
+
+        auto executor = [](World&, void* data) {
+            StateType* state = static_cast<StateType*>(data);
+            detail::EachCachedWithEntity(*state, state->m_fn);
+        };
+
+        auto destructor = [](void* data) {
+            StateType* state = static_cast<StateType*>(data);
+            state->~StateType();
+        };
+
+        m_descriptor->SetExecutor(executor, userData, destructor);
+        m_descriptor->SetEntityCounter(&detail::CountCachedQueryEntities<StateType>);
+        m_descriptor->SetChangeProbe(&detail::CachedQueryChangedSince<StateType>);
+        return m_descriptor->Id();
+    }
+
+    template <comb::Allocator Allocator, typename... Terms>
+    template <typename F>
+    SystemId SystemBuilder<Allocator, Terms...>::ParEach(F&& func, size_t minBatchSize)
+    {
+        using FuncType = std::decay_t<F>;
+
+        struct ParState : detail::CachedQuerySystem<FuncType, Allocator, Terms...>
+        {
+            using detail::CachedQuerySystem<FuncType, Allocator, Terms...>::CachedQuerySystem;
+            size_t m_minBatchSize{0};
+        };
+        using StateType = ParState;
+
+        void* userData = m_allocator->Allocate(sizeof(StateType), alignof(StateType));
+        StateType* created = new (userData)
+            StateType{*m_world, *m_allocator, *m_storage, m_descriptor->Id(), std::forward<F>(func)};
+        created->m_minBatchSize = minBatchSize;
 
         auto executor = [](World& world, void* data) {
-            FuncType* fn = static_cast<FuncType*>(data);
-            // Use locked version to protect Query lifetime (construction + destruction)
-            world.template QueryEachWithEntityLocked<Terms...>(*fn);
+            StateType* state = static_cast<StateType*>(data);
+            hive::Assert(state->m_storage->SliceCursor(state->m_id) == nullptr,
+                         "TimeSliced is not supported by ParEach");
+            state->BeginRun();
+            // Ranges run concurrently, so report the matched rows instead of a shared per-row tally
+            state->m_visited = state->m_query.EntityCount();
+            state->m_query.ParEach(world.GetJobSubmitter(), state->m_fn, state->m_minBatchSize);
         };
 
         auto destructor = [](void* data) {
-            FuncType* fn = static_cast<FuncType*>(data);
-            fn->~FuncType();
+            StateType* state = static_cast<StateType*>(data);
+            state->~StateType();
         };
 
         m_descriptor->SetExecutor(executor, userData, destructor);
+        m_descriptor->SetEntityCounter(&detail::CountCachedQueryEntities<StateType>);
+        m_descriptor->SetChangeProbe(&detail::CachedQueryChangedSince<StateType>);
+        return m_descriptor->Id();
+    }
+
+    template <comb::Allocator Allocator, typename... Terms>
+    template <typename F>
+    SystemId SystemBuilder<Allocator, Terms...>::EachChunk(F&& func)
+    {
+        using FuncType = std::decay_t<F>;
+
+        using StateType = detail::CachedQuerySystem<FuncType, Allocator, Terms...>;
+
+        void* userData = m_allocator->Allocate(sizeof(StateType), alignof(StateType));
+        new (userData) StateType{*m_world, *m_allocator, *m_storage, m_descriptor->Id(), std::forward<F>(func)};
+
+        auto executor = [](World&, void* data) {
+            StateType* state = static_cast<StateType*>(data);
+            hive::Assert(state->m_storage->SliceCursor(state->m_id) == nullptr,
+                         "TimeSliced is not supported by EachChunk");
+            state->BeginRun();
+            size_t visited = 0;
+            state->m_query.EachChunk([&visited, state](const auto& chunk, auto... spans) {
+                visited += chunk.Size();
+                state->m_fn(chunk, spans...);
+            });
+            state->m_visited = visited;
+        };
+
+        auto destructor = [](void* data) {
+            StateType* state = static_cast<StateType*>(data);
+            state->~StateType();
+        };
+
+        m_descriptor->SetExecutor(executor, userData, destructor);
+        m_descriptor->SetEntityCounter(&detail::CountCachedQueryEntities<StateType>);
+        m_descriptor->SetChangeProbe(&detail::CachedQueryChangedSince<StateType>);
         return m_descriptor->Id();
     }
 
@@ -65,27 +311,29 @@ namespace queen
     {
         using FuncType = std::decay_t<F>;
 
-        void* userData = m_allocator->Allocate(sizeof(FuncType), alignof(FuncType));
-        new (userData) FuncType{std::forward<F>(func)};
+        using StateType = detail::CachedQuerySystem<FuncType, Allocator, Terms...>;
+
+        void* userData = m_allocator->Allocate(sizeof(StateType), alignof(StateType));
+        new (userData) StateType{*m_world, *m_allocator, *m_storage, m_descriptor->Id(), std::forward<F>(func)};
 
         auto executor = [](World& world, void* data) {
-            FuncType* fn = static_cast<FuncType*>(data);
+            StateType* state = static_cast<StateType*>(data);
+            FuncType* fn = &state->m_fn;
             auto& commands = world.GetCommands();
 
-            // Use locked version to protect Query lifetime (construction + destruction)
-            world.template QueryEach<Terms...>([fn, &commands](auto& query) {
-                query.EachWithEntity([fn, &commands](Entity e, auto&&... components) {
-                    (*fn)(e, std::forward<decltype(components)>(components)..., commands);
-                });
+            detail::EachCachedWithEntity(*state, [fn, &commands](Entity e, auto&&... components) {
+                (*fn)(e, std::forward<decltype(components)>(components)..., commands);
             });
         };
 
         auto destructor = [](void* data) {
-            FuncType* fn = static_cast<FuncType*>(data);
-            fn->~FuncType();
+            StateType* state = static_cast<StateType*>(data);
+            state->~StateType();
         };
 
         m_descriptor->SetExecutor(executor, userData, destructor);
+        m_descriptor->SetEntityCounter(&detail::CountCachedQueryEntities<StateType>);
+        m_descriptor->SetChangeProbe(&detail::CachedQueryChangedSince<StateType>);
         return m_descriptor->Id();
     }
 
@@ -97,29 +345,31 @@ namespace queen
 
         m_descriptor->Access().template AddResourceRead<R>();
 
-        void* userData = m_allocator->Allocate(sizeof(FuncType), alignof(FuncType));
-        new (userData) FuncType{std::forward<F>(func)};
+        using StateType = detail::CachedQuerySystem<FuncType, Allocator, Terms...>;
+
+        void* userData = m_allocator->Allocate(sizeof(StateType), alignof(StateType));
+        new (userData) StateType{*m_world, *m_allocator, *m_storage, m_descriptor->Id(), std::forward<F>(func)};
 
         auto executor = [](World& world, void* data) {
-            FuncType* fn = static_cast<FuncType*>(data);
+            StateType* state = static_cast<StateType*>(data);
+            FuncType* fn = &state->m_fn;
             R* resPtr = world.Resource<R>();
             hive::Assert(resPtr != nullptr, "Resource not found for Res<T>");
             Res<R> res{resPtr};
 
-            // Use locked version to protect Query lifetime (construction + destruction)
-            world.template QueryEach<Terms...>([fn, res](auto& query) {
-                query.EachWithEntity([fn, res](Entity e, auto&&... components) {
-                    (*fn)(e, std::forward<decltype(components)>(components)..., res);
-                });
+            detail::EachCachedWithEntity(*state, [fn, res](Entity e, auto&&... components) {
+                (*fn)(e, std::forward<decltype(components)>(components)..., res);
             });
         };
 
         auto destructor = [](void* data) {
-            FuncType* fn = static_cast<FuncType*>(data);
-            fn->~FuncType();
+            StateType* state = static_cast<StateType*>(data);
+            state->~StateType();
         };
 
         m_descriptor->SetExecutor(executor, userData, destructor);
+        m_descriptor->SetEntityCounter(&detail::CountCachedQueryEntities<StateType>);
+        m_descriptor->SetChangeProbe(&detail::CachedQueryChangedSince<StateType>);
         return m_descriptor->Id();
     }
 
@@ -131,26 +381,52 @@ namespace queen
 
         m_descriptor->Access().template AddResourceWrite<R>();
 
-        void* userData = m_allocator->Allocate(sizeof(FuncType), alignof(FuncType));
-        new (userData) FuncType{std::forward<F>(func)};
+        using StateType = detail::CachedQuerySystem<FuncType, Allocator, Terms...>;
+
+        void* userData = m_allocator->Allocate(sizeof(StateType), alignof(StateType));
+        new (userData) StateType{*m_world, *m_allocator, *m_storage, m_descriptor->Id(), std::forward<F>(func)};
 
         auto executor = [](World& world, void* data) {
-            FuncType* fn = static_cast<FuncType*>(data);
+            StateType* state = static_cast<StateType*>(data);
+            FuncType* fn = &state->m_fn;
             R* resPtr = world.Resource<R>();
             hive::Assert(resPtr != nullptr, "Resource not found for ResMut<T>");
             ResMut<R> res{resPtr};
+            world.MarkResourceChanged<R>();
 
-            // Use locked version to protect Query lifetime (construction + destruction)
-            world.template QueryEach<Terms...>([fn, res](auto& query) {
-                query.EachWithEntity([fn, res](Entity e, auto&&... components) {
-                    (*fn)(e, std::forward<decltype(components)>(components)..., res);
-                });
+            detail::EachCachedWithEntity(*state, [fn, res](Entity e, auto&&... components) {
+                (*fn)(e, std::forward<decltype(components)>(components)..., res);
             });
         };
 
         auto destructor = [](void* data) {
-            FuncType* fn = static_cast<FuncType*>(data);
-            fn->~FuncType();
+            StateType* state = static_cast<StateType*>(data);
+            state->~StateType();
+        };
+
+        m_descriptor->SetExecutor(executor, userData, destructor);
+        m_descriptor->SetEntityCounter(&detail::CountCachedQueryEntities<StateType>);
+        m_descriptor->SetChangeProbe(&detail::CachedQueryChangedSince<StateType>);
+        return m_descriptor->Id();
+    }
+
+    template <comb::Allocator Allocator, typename... Terms>
+    template <typename F>
+    SystemId SystemBuilder<Allocator, Terms...>::Async(F&& func)
+    {
+        using FuncType = std::decay_t<F>;
+        using StateType = detail::AsyncSystemState<FuncType>;
+
+        void* userData = m_allocator->Allocate(sizeof(StateType), alignof(StateType));
+        new (userData) StateType{std::forward<F>(func)};
+
+        auto executor = [](World& world, void* data) {
+            static_cast<StateType*>(data)->Step(world);
+        };
+
+        auto destructor = [](void* data) {
+            StateType* state = static_cast<StateType*>(data);
+            state->~StateType();
         };
 
         m_descriptor->SetExecutor(executor, userData, destructor);
@@ -203,6 +479,7 @@ namespace queen
             R* resPtr = world.Resource<R>();
             hive::Assert(resPtr != nullptr, "Resource not found for ResMut<T>");
             ResMut<R> res{resPtr};
+            world.MarkResourceChanged<R>();
             (*fn)(res);
         };
 
@@ -214,4 +491,27 @@ namespace queen
         m_descriptor->SetExecutor(executor, userData, destructor);
         return m_descriptor->Id();
     }
+
+    template <comb::Allocator Allocator>
+    template <typename F>
+    SystemId SystemBuilder<Allocator>::Async(F&& func)
+    {
+        using FuncType = std::decay_t<F>;
+        using StateType = detail::AsyncSystemState<FuncType>;
+
+        void* userData = m_allocator->Allocate(sizeof(StateType), alignof(StateType));
+        new (userData) StateType{std::forward<F>(func)};
+
+        auto executor = [](World& world, void* data) {
+            static_cast<StateType*>(data)->Step(world);
+        };
+
+        auto destructor = [](void* data) {
+            StateType* state = static_cast<StateType*>(data);
+            state->~StateType();
+        };
+
+        m_descriptor->SetExecutor(executor, userData, destructor);
+        return m_descriptor->Id();
+    }
 } // namespace queen
@@ -0,0 +1,47 @@
+#pragma once
+
+/**
+ * SystemDescriptor method implementations
+ *
+ * This file contains implementations of SystemDescriptor methods that access World members.
+ * It must be included AFTER the World class is fully defined.
+ */
+
+namespace queen
+{
+    template <comb::Allocator Allocator> bool SystemDescriptor<Allocator>::ShouldRun(World& world)
+    {
+        if (m_executorFn == nullptr || !m_enabled)
+        {
+            return false;
+        }
+
+        if (!HasRunCriteria())
+        {
+            return true;
+        }
+
+        bool run = m_runPeriod <= 1 || (world.CurrentTick().m_value + m_runPhase) % m_runPeriod == 0;
+
+        const bool probeChanges = m_runIfChanged && m_changeProbeFn != nullptr;
+        if (run && (probeChanges || m_resourceTriggerCount > 0))
+        {
+            run = probeChanges && m_changeProbeFn(m_userData, m_lastRunTick);
+            for (uint8_t i = 0; i < m_resourceTriggerCount && !run; ++i)
+            {
+                run = world.ResourceChangeTick(m_resourceTriggers[i]).IsAtLeast(m_lastRunTick);
+            }
+        }
+
+        if (run && m_conditionFn != nullptr)
+        {
+            run = m_conditionFn(world, m_conditionData);
+        }
+
+        if (!run)
+        {
+            m_stats.RecordSkip();
+        }
+        return run;
+    }
+} // namespace queen
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace queen
+{
+    /**
+     * Rotating row cursor of a time-sliced system
+     *
+     * A system registered with TimeSliced(n) processes about 1/n of its
+     * matched rows per run. The cursor is a row number across the
+     * system's matched archetypes (see Query::EachInRows) and moves past
+     * the processed slice after every run, so each row is visited once
+     * every n runs while the match set is stable.
+     *
+     * Memory layout:
+     * ┌─────────────────────────────────────────────────────────────────┐
+     * │ slices_: uint32_t (n, 1 = not sliced)                           │
+     * │ cursor_: size_t (first row of the next slice)                   │
+     * │ first_, count_: size_t (slice of the current run)               │
+     * └─────────────────────────────────────────────────────────────────┘
+     *
+     * Performance characteristics:
+     * - Advance: O(1)
+     *
+     * Limitations:
+     * - Rows shifted by removals in an earlier archetype may be visited
+     *   twice or skipped for one rotation
+     */
+    struct SystemSliceCursor
+    {
+        uint32_t m_slices{1};
+        size_t m_cursor{0};
+        size_t m_first{0};
+        size_t m_count{0};
+
+        [[nodiscard]] bool IsSliced() const noexcept
+        {
+            return m_slices > 1;
+        }
+
+        /**
+         * Pick this run's slice of totalRows and move the cursor past it
+         *
+         * The last slice stops at the end of the rows, so the cursor comes
+         * back to row 0 after n runs.
+         */
+        void Advance(size_t totalRows) noexcept
+        {
+            if (totalRows == 0)
+            {
+                m_cursor = 0;
+                m_first = 0;
+                m_count = 0;
+                return;
+            }
+
+            const size_t sliceRows = (totalRows + m_slices - 1) / m_slices;
+            m_first = m_cursor % totalRows;
+            m_count = sliceRows < totalRows - m_first ? sliceRows : totalRows - m_first;
+            m_cursor = (m_first + m_count) % totalRows;
+        }
+    };
+} // namespace queen
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace queen
+{
+    /**
+     * Always-on execution counters of one system
+     *
+     * Filled by Scheduler and ParallelScheduler after every run of the
+     * system, independent of the profiler build. Queue wait is the time
+     * between the system becoming ready (all dependencies complete) and
+     * starting to run, i.e. time lost to a busy thread pool.
+     *
+     * Memory layout:
+     * ┌─────────────────────────────────────────────────────────────────┐
+     * │ last/max/total_nanos_: int64_t (execution time)                 │
+     * │ last/max/total_wait_nanos_: int64_t (ready → start)             │
+     * │ invocations_: uint64_t                                          │
+     * │ skips_: uint64_t (ticks skipped by run criteria)                │
+     * │ last/total_entities_: uint64_t (entities visited per run)       │
+     * │ last_worker_: uint32_t (kMainThread outside the job system)     │
+     * └─────────────────────────────────────────────────────────────────┘
+     *
+     * Performance characteristics:
+     * - Record: O(1), no atomics (a system never runs twice concurrently)
+     *
+     * Limitations:
+     * - Entity count is the number of entities the last run visited
+     *   (after change filters and time slicing), ParEach systems report
+     *   the rows their query matched
+     * - Read after the scheduler returns, values are torn while it runs
+     */
+    struct SystemStats
+    {
+        static constexpr uint32_t kMainThread = UINT32_MAX;
+
+        int64_t m_lastNanos{0};
+        int64_t m_maxNanos{0};
+        int64_t m_totalNanos{0};
+        int64_t m_lastWaitNanos{0};
+        int64_t m_maxWaitNanos{0};
+        int64_t m_totalWaitNanos{0};
+        uint64_t m_invocations{0};
+        uint64_t m_skips{0};
+        uint64_t m_lastEntities{0};
+        uint64_t m_totalEntities{0};
+        uint32_t m_lastWorker{kMainThread};
+
+        void Record(int64_t durationNanos, int64_t waitNanos, size_t entities, uint32_t worker) noexcept
+        {
+            m_lastNanos = durationNanos;
+            m_maxNanos = durationNanos > m_maxNanos ? durationNanos : m_maxNanos;
+            m_totalNanos += durationNanos;
+            m_lastWaitNanos = waitNanos;
+            m_maxWaitNanos = waitNanos > m_maxWaitNanos ? waitNanos : m_maxWaitNanos;
+            m_totalWaitNanos += waitNanos;
+            m_lastEntities = entities;
+            m_totalEntities += entities;
+            m_lastWorker = worker;
+            ++m_invocations;
+        }
+
+        void RecordSkip() noexcept
+        {
+            ++m_skips;
+        }
+
+        [[nodiscard]] int64_t AverageNanos() const noexcept
+        {
+            return m_invocations > 0 ? m_totalNanos / static_cast<int64_t>(m_invocations) : 0;
+        }
+
+        [[nodiscard]] int64_t AverageWaitNanos() const noexcept
+        {
+            return m_invocations > 0 ? m_totalWaitNanos / static_cast<int64_t>(m_invocations) : 0;
+        }
+
+        void Reset() noexcept
+        {
+            *this = SystemStats{};
+        }
+    };
+} // namespace queen
@@ -1,11 +1,21 @@
 #pragma once
 
+#include <hive/core/clock.h>
+
 #include <comb/allocator_concepts.h>
 
+#include <wax/containers/string.h>
 #include <wax/containers/vector.h>
 
+#include <drone/worker_context.h>
+
 #include <queen/system/system.h>
 #include <queen/system/system_builder.h>
+#include <queen/system/system_slice.h>
+#include <queen/system/system_timeline.h>
+
+#include <cstdio>
+#include <numeric>
 
 namespace queen
 {
@@ -21,6 +31,8 @@ namespace queen
      * Memory layout:
      * ┌─────────────────────────────────────────────────────────────────┐
      * │ systems_: Vector<SystemDescriptor>                              │
+     * │ timeline_: SystemTimeline (last frames' runs, for trace export) │
+     * │ slice_cursors_: Vector<SystemSliceCursor> (by system index)     │
      * └─────────────────────────────────────────────────────────────────┘
      *
      * Performance characteristics:
@@ -29,6 +41,8 @@ namespace queen
      * - GetSystem(name): O(n) linear search
      * - RunSystem: O(1) + system execution time
      * - RunAll: O(n) systems
+     * - RecordRun: O(1), query systems tally their rows while running
+     * - AssignRunPhase: O(n * period)
      *
      * Limitations:
      * - Systems are stored in registration order
@@ -51,6 +65,8 @@ namespace queen
         explicit SystemStorage(Allocator& allocator)
             : m_allocator{&allocator}
             , m_systems{allocator}
+            , m_timeline{allocator}
+            , m_sliceCursors{allocator}
         {
         }
 
@@ -269,10 +285,242 @@ namespace queen
         void Clear()
         {
             m_systems.Clear();
+            m_timeline.Clear();
+            m_sliceCursors.Clear();
+        }
+
+        /**
+         * Process about 1/slices of the system's matched rows per run
+         *
+         * The cursor survives archetype creation and is only reset by
+         * Clear(). A slice count of 1 turns slicing off.
+         */
+        void SetTimeSliced(SystemId id, uint32_t slices)
+        {
+            hive::Assert(id.IsValid() && id.Index() < m_systems.Size(), "SetTimeSliced(): unknown system");
+            hive::Assert(slices > 0, "TimeSliced needs at least one slice");
+            if (m_sliceCursors.Size() <= id.Index())
+            {
+                m_sliceCursors.Resize(id.Index() + 1, SystemSliceCursor{});
+            }
+            m_sliceCursors[id.Index()].m_slices = slices > 0 ? slices : 1;
+        }
+
+        /**
+         * Cursor of a time-sliced system, nullptr if the system is not sliced
+         */
+        [[nodiscard]] SystemSliceCursor* SliceCursor(SystemId id) noexcept
+        {
+            if (!id.IsValid() || id.Index() >= m_sliceCursors.Size() || !m_sliceCursors[id.Index()].IsSliced())
+            {
+                return nullptr;
+            }
+            return &m_sliceCursors[id.Index()];
+        }
+
+        [[nodiscard]] const SystemSliceCursor* SliceCursor(SystemId id) const noexcept
+        {
+            return const_cast<SystemStorage*>(this)->SliceCursor(id);
+        }
+
+        /**
+         * Pick the phase of a new RunEvery(period) system
+         *
+         * Chooses the phase whose ticks overlap least with the reduced-rate
+         * systems already registered, so that systems sharing a period run
+         * on different ticks instead of piling onto the same one. A system
+         * with period m and phase q runs on a share gcd(period, m) / m of
+         * the candidate's ticks when the phases agree modulo the gcd.
+         */
+        [[nodiscard]] uint32_t AssignRunPhase(uint32_t period) const
+        {
+            if (period <= 1)
+            {
+                return 0;
+            }
+
+            uint32_t bestPhase = 0;
+            double bestLoad = 0.0;
+            for (uint32_t phase = 0; phase < period; ++phase)
+            {
+                double load = 0.0;
+                for (size_t i = 0; i < m_systems.Size(); ++i)
+                {
+                    const uint32_t other = m_systems[i].RunPeriod();
+                    if (other <= 1)
+                    {
+                        continue;
+                    }
+                    const uint32_t divisor = std::gcd(period, other);
+                    if ((phase + divisor - m_systems[i].RunPhase() % divisor) % divisor == 0)
+                    {
+                        load += static_cast<double>(divisor) / static_cast<double>(other);
+                    }
+                }
+
+                if (phase == 0 || load < bestLoad)
+                {
+                    bestPhase = phase;
+                    bestLoad = load;
+                }
+            }
+            return bestPhase;
+        }
+
+        /**
+         * Record one scheduled run of a system
+         *
+         * Called by the schedulers on the thread that ran the system.
+         * Updates the descriptor's SystemStats and the current timeline
+         * frame.
+         *
+         * @param index System index in storage
+         * @param ready When the system's dependencies were complete
+         * @param start When the system started executing
+         * @param end When the system finished executing
+         */
+        void RecordRun(size_t index, hive::Clock::TimePoint ready, hive::Clock::TimePoint start,
+                       hive::Clock::TimePoint end)
+        {
+            SystemDescriptor<Allocator>& system = m_systems[index];
+
+            const int64_t duration = hive::Clock::NanosBetween(start, end);
+            const int64_t wait = hive::Clock::NanosBetween(ready, start);
+            const size_t entities = system.CountEntities();
+            const size_t workerIndex = drone::WorkerContext::CurrentWorkerIndex();
+            const uint32_t worker = workerIndex == drone::WorkerContext::kMainThread
+                                        ? SystemStats::kMainThread
+                                        : static_cast<uint32_t>(workerIndex);
+
+            system.Stats().Record(duration, wait, entities, worker);
+
+            TimelineEvent event{};
+            event.m_startNanos = m_timeline.NanosSinceOrigin(start);
+            event.m_durationNanos = duration;
+            event.m_waitNanos = wait;
+            event.m_entities = entities;
+            event.m_worker = worker;
+            m_timeline.Record(index, event);
+        }
+
+        /**
+         * Reset every system's SystemStats
+         */
+        void ResetStats() noexcept
+        {
+            for (size_t i = 0; i < m_systems.Size(); ++i)
+            {
+                m_systems[i].Stats().Reset();
+            }
+        }
+
+        [[nodiscard]] SystemTimeline<Allocator>& Timeline() noexcept
+        {
+            return m_timeline;
+        }
+
+        [[nodiscard]] const SystemTimeline<Allocator>& Timeline() const noexcept
+        {
+            return m_timeline;
+        }
+
+        /**
+         * Append the recorded frames to out as a Chrome trace JSON document
+         *
+         * One complete ("X") event per system run, oldest frame first.
+         * Threads map to tid 0 for the main thread and worker index + 1
+         * for job system workers. Queue wait, entity count and world tick
+         * are attached as args. Load the result in chrome://tracing or
+         * https://ui.perfetto.dev.
+         *
+         * @param out Destination string
+         * @param maxFrames Most recent frames to export
+         */
+        void WriteChromeTrace(wax::String& out, size_t maxFrames = SIZE_MAX) const
+        {
+            char number[64];
+            const auto appendMicros = [&out, &number](int64_t nanos) {
+                const int count = std::snprintf(number, sizeof(number), "%.3f", static_cast<double>(nanos) / 1000.0);
+                out.Append(number, static_cast<size_t>(count));
+            };
+            const auto appendUint = [&out, &number](uint64_t value) {
+                const int count =
+                    std::snprintf(number, sizeof(number), "%llu", static_cast<unsigned long long>(value));
+                out.Append(number, static_cast<size_t>(count));
+            };
+
+            out.Append("{\"traceEvents\":[");
+
+            bool first = true;
+            const size_t frameCount = m_timeline.FrameCount() < maxFrames ? m_timeline.FrameCount() : maxFrames;
+            const size_t systemCount =
+                m_timeline.SystemCount() < m_systems.Size() ? m_timeline.SystemCount() : m_systems.Size();
+
+            for (size_t age = frameCount; age > 0; --age)
+            {
+                const TimelineEvent* frame = m_timeline.Frame(age - 1);
+                const Tick tick = m_timeline.FrameTick(age - 1);
+
+                for (size_t i = 0; i < systemCount; ++i)
+                {
+                    const TimelineEvent& event = frame[i];
+                    if (!event.m_ran)
+                    {
+                        continue;
+                    }
+
+                    if (!first)
+                    {
+                        out.Append(',');
+                    }
+                    first = false;
+
+                    out.Append("{\"name\":\"");
+                    AppendEscaped(out, m_systems[i].Name());
+                    out.Append("\",\"cat\":\"system\",\"ph\":\"X\",\"ts\":");
+                    appendMicros(event.m_startNanos);
+                    out.Append(",\"dur\":");
+                    appendMicros(event.m_durationNanos);
+                    out.Append(",\"pid\":1,\"tid\":");
+                    appendUint(event.m_worker == SystemStats::kMainThread ? 0 : uint64_t{event.m_worker} + 1);
+                    out.Append(",\"args\":{\"tick\":");
+                    appendUint(tick.m_value);
+                    out.Append(",\"wait_us\":");
+                    appendMicros(event.m_waitNanos);
+                    out.Append(",\"entities\":");
+                    appendUint(event.m_entities);
+                    out.Append("}}");
+                }
+            }
+
+            out.Append("],\"displayTimeUnit\":\"ms\"}");
         }
 
     private:
+        static void AppendEscaped(wax::String& out, const char* str)
+        {
+            for (; *str != '\0'; ++str)
+            {
+                const char c = *str;
+                if (c == '"' || c == '\\')
+                {
+                    out.Append('\\');
+                    out.Append(c);
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    out.Append(' ');
+                }
+                else
+                {
+                    out.Append(c);
+                }
+            }
+        }
+
         Allocator* m_allocator;
         wax::Vector<SystemDescriptor<Allocator>> m_systems;
+        SystemTimeline<Allocator> m_timeline;
+        wax::Vector<SystemSliceCursor> m_sliceCursors;
     };
 } // namespace queen
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <hive/core/clock.h>
+
+#include <comb/allocator_concepts.h>
+
+#include <wax/containers/vector.h>
+
+#include <queen/core/tick.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace queen
+{
+    /**
+     * One system run recorded in the SystemTimeline
+     */
+    struct TimelineEvent
+    {
+        int64_t m_startNanos{0}; // Since the timeline origin
+        int64_t m_durationNanos{0};
+        int64_t m_waitNanos{0};
+        uint64_t m_entities{0};
+        uint32_t m_worker{0};
+        bool m_ran{false};
+    };
+
+    /**
+     * Ring buffer of the last frames' system runs
+     *
+     * Each frame owns one TimelineEvent slot per system, addressed by the
+     * system's index in SystemStorage. Every system runs at most once per
+     * frame, so workers record into distinct slots without locking.
+     * SystemStorage::WriteChromeTrace() turns the buffer into a timeline
+     * viewable in chrome://tracing or Perfetto.
+     *
+     * Memory layout:
+     * ┌─────────────────────────────────────────────────────────────────┐
+     * │ events_: [frame0: sys0..sysN][frame1: sys0..sysN]...            │
+     * │ frame_ticks_: [tick0, tick1, ...] world tick per frame slot     │
+     * │ head_: slot of the frame being recorded                         │
+     * └─────────────────────────────────────────────────────────────────┘
+     *
+     * Performance characteristics:
+     * - BeginFrame: O(N) to clear the slot, O(F * N) when N changes
+     * - Record: O(1)
+     * - Memory: O(F * N) with F frames and N systems
+     *
+     * Limitations:
+     * - Changing the system count discards recorded history
+     * - A frame capacity of 0 disables recording
+     */
+    template <comb::Allocator Allocator> class SystemTimeline
+    {
+    public:
+        static constexpr size_t kDefaultFrameCapacity = 8;
+
+        explicit SystemTimeline(Allocator& allocator, size_t frameCapacity = kDefaultFrameCapacity)
+            : m_events{allocator}
+            , m_frameTicks{allocator}
+            , m_origin{hive::Clock::Now()}
+            , m_frameCapacity{frameCapacity}
+            , m_systemCount{0}
+            , m_head{0}
+            , m_frameCount{0}
+        {
+        }
+
+        /**
+         * Set how many frames are kept, discards recorded frames
+         */
+        void SetFrameCapacity(size_t frames)
+        {
+            m_frameCapacity = frames;
+            Clear();
+        }
+
+        [[nodiscard]] size_t FrameCapacity() const noexcept
+        {
+            return m_frameCapacity;
+        }
+
+        [[nodiscard]] bool IsEnabled() const noexcept
+        {
+            return m_frameCapacity > 0;
+        }
+
+        /**
+         * Start recording a frame, evicting the oldest one when full
+         */
+        void BeginFrame(size_t systemCount, Tick tick)
+        {
+            if (m_frameCapacity == 0)
+            {
+                return;
+            }
+
+            if (systemCount != m_systemCount || m_frameTicks.Size() != m_frameCapacity)
+            {
+                m_systemCount = systemCount;
+                m_events.Clear();
+                m_events.Resize(m_frameCapacity * systemCount, TimelineEvent{});
+                m_frameTicks.Clear();
+                m_frameTicks.Resize(m_frameCapacity, Tick{0});
+                m_frameCount = 0;
+            }
+
+            m_head = m_frameCount == 0 ? 0 : (m_head + 1) % m_frameCapacity;
+            if (m_frameCount < m_frameCapacity)
+            {
+                ++m_frameCount;
+            }
+
+            m_frameTicks[m_head] = tick;
+            TimelineEvent* frame = m_events.Data() + m_head * m_systemCount;
+            for (size_t i = 0; i < m_systemCount; ++i)
+            {
+                frame[i] = TimelineEvent{};
+            }
+        }
+
+        /**
+         * Record a system run into the current frame
+         */
+        void Record(size_t systemIndex, const TimelineEvent& event) noexcept
+        {
+            if (m_frameCount == 0 || systemIndex >= m_systemCount)
+            {
+                return;
+            }
+
+            TimelineEvent& slot = m_events[m_head * m_systemCount + systemIndex];
+            slot = event;
+            slot.m_ran = true;
+        }
+
+        [[nodiscard]] int64_t NanosSinceOrigin(hive::Clock::TimePoint time) const noexcept
+        {
+            return hive::Clock::NanosBetween(m_origin, time);
+        }
+
+        /**
+         * Number of frames currently held (at most FrameCapacity())
+         */
+        [[nodiscard]] size_t FrameCount() const noexcept
+        {
+            return m_frameCount;
+        }
+
+        [[nodiscard]] size_t SystemCount() const noexcept
+        {
+            return m_systemCount;
+        }
+
+        /**
+         * Events of a recorded frame, age 0 is the most recent
+         *
+         * @return SystemCount() events indexed by system, nullptr if age >= FrameCount()
+         */
+        [[nodiscard]] const TimelineEvent* Frame(size_t age) const noexcept
+        {
+            if (age >= m_frameCount)
+            {
+                return nullptr;
+            }
+            return m_events.Data() + SlotOf(age) * m_systemCount;
+        }
+
+        [[nodiscard]] Tick FrameTick(size_t age) const noexcept
+        {
+            return age < m_frameCount ? m_frameTicks[SlotOf(age)] : Tick{0};
+        }
+
+        void Clear()
+        {
+            m_events.Clear();
+            m_frameTicks.Clear();
+            m_systemCount = 0;
+            m_head = 0;
+            m_frameCount = 0;
+        }
+
+    private:
+        [[nodiscard]] size_t SlotOf(size_t age) const noexcept
+        {
+            return (m_head + m_frameCapacity - age) % m_frameCapacity;
+        }
+
+        wax::Vector<TimelineEvent> m_events;
+        wax::Vector<Tick> m_frameTicks;
+        hive::Clock::TimePoint m_origin;
+        size_t m_frameCapacity;
+        size_t m_systemCount;
+        size_t m_head;
+        size_t m_frameCount;
+    };
+} // namespace queen
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <comb/allocator_concepts.h>
+
+#include <wax/containers/vector.h>
+
+#include <queen/core/entity.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace queen
+{
+    /**
+     * Staging entity to merged entity mapping filled by World::MergeFrom
+     *
+     * Staging entities are dense indices of the staging world, so the map
+     * is a flat array indexed by entity index. A slot keeps the staging
+     * handle too, so a stale handle with an older generation misses.
+     *
+     * World::MergeFrom remaps Parent and Children itself. Components with
+     * other Entity fields can be remapped through Find(), e.g. with the
+     * reflection helpers of WorldDeserializer.
+     *
+     * Memory layout:
+     * ┌──────────────────────────────────────────────────────────────┐
+     * │ slots_: wax::Vector<Slot> (16 bytes each)                    │
+     * │   [staging index] → { staging entity, merged entity }        │
+     * │ count_: size_t (mapped entities)                             │
+     * └──────────────────────────────────────────────────────────────┘
+     *
+     * Performance characteristics:
+     * - Find: O(1)
+     * - Reset: O(staging indices)
+     *
+     * Example:
+     * @code
+     *   MergeEntityMap map;
+     *   world.MergeFrom(staging, &map);
+     *   Entity door = map.Map(stagingDoor);
+     * @endcode
+     */
+    class MergeEntityMap
+    {
+    public:
+        MergeEntityMap() = default;
+
+        template <comb::Allocator Allocator>
+        explicit MergeEntityMap(Allocator& allocator)
+            : m_slots{allocator}
+        {
+        }
+
+        /**
+         * Drop every mapping and make room for staging indices [0, indexCount)
+         */
+        void Reset(size_t indexCount)
+        {
+            m_slots.Clear();
+            m_slots.Resize(indexCount, Slot{});
+            m_count = 0;
+        }
+
+        void Set(Entity staging, Entity merged)
+        {
+            Slot& slot = m_slots[staging.Index()];
+            if (slot.m_staging.IsNull())
+            {
+                ++m_count;
+            }
+            slot = Slot{staging, merged};
+        }
+
+        [[nodiscard]] const Entity* Find(Entity staging) const noexcept
+        {
+            if (staging.IsNull() || staging.Index() >= m_slots.Size())
+            {
+                return nullptr;
+            }
+
+            const Slot& slot = m_slots[staging.Index()];
+            return slot.m_staging == staging ? &slot.m_merged : nullptr;
+        }
+
+        // Serialized id form, matches the maps of detail::RemapMappedFields
+        [[nodiscard]] const Entity* Find(uint64_t stagingId) const noexcept
+        {
+            return Find(Entity::FromU64(stagingId));
+        }
+
+        /**
+         * Merged entity of staging, null when it was not merged
+         */
+        [[nodiscard]] Entity Map(Entity staging) const noexcept
+        {
+            const Entity* merged = Find(staging);
+            return merged != nullptr ? *merged : Entity{};
+        }
+
+        [[nodiscard]] size_t Count() const noexcept
+        {
+            return m_count;
+        }
+
+    private:
+        struct Slot
+        {
+            Entity m_staging{};
+            Entity m_merged{};
+        };
+
+        wax::Vector<Slot> m_slots{};
+        size_t m_count{0};
+    };
+} // namespace queen
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <comb/allocator_concepts.h>
+
+#include <wax/containers/vector.h>
+
+#include <queen/core/entity.h>
+#include <queen/core/tick.h>
+#include <queen/core/type_id.h>
+
+#include <cstddef>
+
+namespace queen
+{
+    /**
+     * One structural removal recorded by the World
+     *
+     * - m_typeId == kInvalidTypeId: the entity was despawned
+     * - m_entity null: every entity was cleared (World::ClearEntities)
+     */
+    struct RemovalRecord
+    {
+        Entity m_entity{};
+        TypeId m_typeId{kInvalidTypeId};
+        Tick m_tick{0};
+
+        [[nodiscard]] bool IsDespawn() const noexcept
+        {
+            return m_typeId == kInvalidTypeId && !m_entity.IsNull();
+        }
+
+        [[nodiscard]] bool IsClear() const noexcept
+        {
+            return m_entity.IsNull();
+        }
+    };
+
+    /**
+     * Opt-in journal of despawns and component removals
+     *
+     * Component ticks tell what was added or changed since a tick, but a
+     * removed component or despawned entity leaves nothing behind to
+     * compare against. When enabled, the World appends a record for every
+     * removal so delta serialization (WorldSerializer::SerializeDelta) can
+     * replay them. Records are appended in tick order, so the records
+     * since a tick are a suffix found by binary search.
+     *
+     * Memory layout:
+     * ┌──────────────────────────────────────────────────────────────┐
+     * │ records_: wax::Vector<RemovalRecord> (24 bytes each)         │
+     * │ enabled_: bool                                               │
+     * └──────────────────────────────────────────────────────────────┘
+     *
+     * Performance characteristics:
+     * - Record: O(1) amortized, a single branch when disabled
+     * - FirstSince: O(log n)
+     * - TrimBefore: O(n)
+     *
+     * Limitations:
+     * - Grows until trimmed, callers that consume deltas should call
+     *   World::TrimRemovals() with the oldest tick they still need
+     *
+     * Example:
+     * @code
+     *   world.TrackRemovals(true);
+     *   world.Despawn(enemy);
+     *   const auto& records = world.GetRemovalLog().Records();
+     * @endcode
+     */
+    class RemovalLog
+    {
+    public:
+        template <comb::Allocator Allocator>
+        explicit RemovalLog(Allocator& allocator)
+            : m_records{allocator}
+        {
+        }
+
+        void SetEnabled(bool enabled) noexcept
+        {
+            m_enabled = enabled;
+        }
+
+        [[nodiscard]] bool IsEnabled() const noexcept
+        {
+            return m_enabled;
+        }
+
+        void RecordDespawn(Entity entity, Tick tick)
+        {
+            if (m_enabled)
+            {
+                m_records.PushBack(RemovalRecord{entity, kInvalidTypeId, tick});
+            }
+        }
+
+        void RecordRemove(Entity entity, TypeId typeId, Tick tick)
+        {
+            if (m_enabled)
+            {
+                m_records.PushBack(RemovalRecord{entity, typeId, tick});
+            }
+        }
+
+        // A clear supersedes every earlier record
+        void RecordClear(Tick tick)
+        {
+            if (m_enabled)
+            {
+                m_records.Clear();
+                m_records.PushBack(RemovalRecord{Entity{}, kInvalidTypeId, tick});
+            }
+        }
+
+        /**
+         * Index of the first record at tick since or later
+         */
+        [[nodiscard]] size_t FirstSince(Tick since) const noexcept
+        {
+            size_t lo = 0;
+            size_t hi = m_records.Size();
+            while (lo < hi)
+            {
+                const size_t mid = lo + (hi - lo) / 2;
+                if (m_records[mid].m_tick.IsAtLeast(since))
+                {
+                    hi = mid;
+                }
+                else
+                {
+                    lo = mid + 1;
+                }
+            }
+            return lo;
+        }
+
+        /**
+         * Drop the records older than tick
+         */
+        void TrimBefore(Tick tick)
+        {
+            const size_t first = FirstSince(tick);
+            if (first == 0)
+            {
+                return;
+            }
+
+            for (size_t i = first; i < m_records.Size(); ++i)
+            {
+                m_records[i - first] = m_records[i];
+            }
+            m_records.Resize(m_records.Size() - first);
+        }
+
+        void Clear() noexcept
+        {
+            m_records.Clear();
+        }
+
+        [[nodiscard]] size_t Count() const noexcept
+        {
+            return m_records.Size();
+        }
+
+        [[nodiscard]] const wax::Vector<RemovalRecord>& Records() const noexcept
+        {
+            return m_records;
+        }
+
+    private:
+        wax::Vector<RemovalRecord> m_records;
+        bool m_enabled{false};
+    };
+} // namespace queen
@@ -19,20 +19,30 @@
 #include <queen/hierarchy/hierarchy.h>
 #include <queen/observer/observers.h>
 #include <queen/query/query.h>
+#include <queen/query/query_state.h>
 #include <queen/scheduler/parallel_scheduler.h>
 #include <queen/scheduler/scheduler.h>
 #include <queen/storage/archetype.h>
 #include <queen/storage/archetype_graph.h>
 #include <queen/storage/component_index.h>
+#include <queen/storage/sparse_storage.h>
 #include <queen/system/system_storage.h>
+#include <queen/world/merge_entity_map.h>
+#include <queen/world/removal_log.h>
 #include <queen/world/world_allocators.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstring>
 #include <mutex>
+#include <new>
+#include <tuple>
+#include <type_traits>
 
 namespace queen
 {
     class EntityBuilder;
+    class WorldSnapshot;
 
     template <comb::Allocator Allocator> class CommandBuffer;
 
@@ -40,6 +50,58 @@ namespace queen
     using ComponentAllocator = comb::BuddyAllocator;
     using FrameAllocator = comb::LinearAllocator;
 
+    /**
+     * One component of a type-erased World::SpawnBatchRaw call
+     *
+     * m_source == nullptr default-constructs the component. Otherwise
+     * entity i copies from m_source + i * m_stride, so a stride of 0 copies
+     * one prototype into every entity (prefabs) and a stride of
+     * m_meta.m_size reads a packed array (deserializers).
+     */
+    struct SpawnBatchComponent
+    {
+        ComponentMeta m_meta{};
+        const void* m_source{nullptr};
+        size_t m_stride{0};
+    };
+
+    /**
+     * Tuning of World::Compact
+     *
+     * A table is shrunk when its rows fill less than m_maxOccupancy of its
+     * capacity. It keeps room for max(rows, m_minCapacity) rows, so tables
+     * that refill every few frames can keep a floor and avoid regrowing.
+     */
+    struct CompactPolicy
+    {
+        float m_maxOccupancy{0.25f};
+        size_t m_minCapacity{0};
+        bool m_retireEmpty{true};
+    };
+
+    /**
+     * Result of World::Compact
+     *
+     * m_bytesReclaimed is the drop in the component allocator's used
+     * memory, buddy block rounding included.
+     */
+    struct CompactStats
+    {
+        size_t m_bytesReclaimed{0};
+        size_t m_columnsShrunk{0};
+        size_t m_archetypesRetired{0};
+    };
+
+    /**
+     * Result of World::MergeFrom
+     */
+    struct MergeStats
+    {
+        size_t m_entitiesMerged{0};
+        size_t m_archetypesMerged{0};
+        size_t m_sparseComponentsMerged{0};
+    };
+
     /**
      * Central ECS world containing all entities, components, and resources
      *
@@ -66,6 +128,7 @@ namespace queen
      * │ - entity_allocator_: Entity ID allocation and recycling        │
      * │ - entity_locations_: Entity -> (Archetype, Row) mapping        │
      * │ - Table column data                                            │
+     * │ - sparse_storages_: Sparse sets for StorageType::SPARSE types  │
      * ├────────────────────────────────────────────────────────────────┤
      * │ Frame (LinearAllocator) - Reset each Update()                  │
      * │ - commands_: Deferred command buffers                          │
@@ -78,10 +141,12 @@ namespace queen
      *
      * Performance characteristics:
      * - Spawn: O(1) amortized (archetype lookup cached)
-     * - Despawn: O(n) where n = components (moves data)
+     * - Despawn: O(n + s) where n = components (moves data) and
+     *   s = sparse storages (each one is asked to drop the entity)
      * - Get<T>: O(1) (location lookup + column access)
      * - Add<T>: O(n) (archetype transition, data move)
      * - Remove<T>: O(n) (archetype transition, data move)
+     * - Add<T>/Remove<T> on sparse components: O(1), no archetype change
      * - IsAlive: O(1)
      * - Resource<T>: O(1) (hash map lookup)
      * - InsertResource<T>: O(1) amortized (hash map insert)
@@ -140,15 +205,19 @@ namespace queen
                            config.m_threadFrameSize, config.m_threadCount}
             , m_entityAllocator{m_allocators.Components()}
             , m_entityLocations{m_allocators.Components()}
-            , m_archetypeGraph{m_allocators.Components()}
+            , m_archetypeGraph{m_allocators.Components(), config.m_tableChunkBytes}
             , m_componentIndex{m_allocators.Persistent()}
+            , m_sparseStorages{m_allocators.Components()}
+            , m_queryStates{m_allocators.Persistent()}
             , m_resources{m_allocators.Persistent()}
             , m_resourceMetas{m_allocators.Persistent()}
+            , m_resourceTicks{m_allocators.Persistent()}
             , m_systems{m_allocators.Persistent()}
             , m_scheduler{m_allocators.Persistent()}
             , m_commands{m_allocators.Persistent()}
             , m_events{m_allocators.Persistent()}
             , m_observers{m_allocators.Persistent()}
+            , m_removalLog{m_allocators.Persistent()}
         {
             m_componentIndex.RegisterArchetype(m_archetypeGraph.GetEmptyArchetype());
         }
@@ -192,6 +261,39 @@ namespace queen
 
         template <typename... Components> [[nodiscard]] Entity Spawn(Components&&... components);
 
+        /**
+         * Spawn count entities with the same component set in one operation
+         *
+         * The archetype is resolved once, the table and location map are
+         * reserved once, entities are allocated in bulk and components are
+         * default-constructed in place. init(i, components&...) is then
+         * called for each new entity to fill in its values.
+         *
+         * Limitations:
+         * - Components must be default-constructible and not sparse
+         *   (add sparse components afterwards with Add)
+         *
+         * @param outEntities Optional array of at least count entities receiving the new handles
+         *
+         * Example:
+         * @code
+         *   world.SpawnBatch<Position, Velocity>(10000, [](size_t i, Position& p, Velocity& v) {
+         *       p.x = static_cast<float>(i);
+         *       v.dx = 1.0f;
+         *   });
+         * @endcode
+         */
+        template <typename... Components, typename Init>
+        void SpawnBatch(size_t count, Init&& init, Entity* outEntities = nullptr);
+
+        /**
+         * Type-erased SpawnBatch for deserializers and prefabs
+         *
+         * Sparse components are supported and inserted per entity.
+         */
+        void SpawnBatchRaw(size_t count, const SpawnBatchComponent* components, size_t componentCount,
+                           Entity* outEntities = nullptr);
+
         [[nodiscard]] Entity CloneEntity(Entity source)
         {
             if (!IsAlive(source))
@@ -232,6 +334,16 @@ namespace queen
                 metas[i].m_copy(dst, src);
             }
 
+            for (size_t i = 0; i < m_sparseStorages.StorageCount(); ++i)
+            {
+                SparseStorage<ComponentAllocator>* storage = m_sparseStorages.GetStorage(i);
+                const void* src = storage->Get(source);
+                if (src != nullptr && storage->GetMeta().m_copy != nullptr)
+                {
+                    storage->InsertCopy(clone, src, m_currentTick);
+                }
+            }
+
             if (Has<Parent>(clone))
                 Remove<Parent>(clone);
             if (Has<Children>(clone))
@@ -283,8 +395,10 @@ namespace queen
                 }
             }
 
+            m_sparseStorages.RemoveEntity(entity);
             m_entityLocations.Remove(entity);
             m_entityAllocator.Deallocate(entity);
+            m_removalLog.RecordDespawn(entity, m_currentTick);
         }
 
         [[nodiscard]] bool IsAlive(Entity entity) const noexcept
@@ -299,6 +413,12 @@ namespace queen
                 return nullptr;
             }
 
+            if constexpr (detail::DeduceStorage<T>() == StorageType::SPARSE)
+            {
+                SparseStorage<ComponentAllocator>* storage = m_sparseStorages.Find(TypeIdOf<T>());
+                return storage != nullptr ? static_cast<T*>(storage->Get(entity)) : nullptr;
+            }
+
             EntityRecord* record = m_entityLocations.Get(entity);
             if (record == nullptr || record->m_archetype == nullptr)
             {
@@ -315,6 +435,12 @@ namespace queen
                 return nullptr;
             }
 
+            if constexpr (detail::DeduceStorage<T>() == StorageType::SPARSE)
+            {
+                const SparseStorage<ComponentAllocator>* storage = m_sparseStorages.Find(TypeIdOf<T>());
+                return storage != nullptr ? static_cast<const T*>(storage->Get(entity)) : nullptr;
+            }
+
             const EntityRecord* record = m_entityLocations.Get(entity);
             if (record == nullptr || record->m_archetype == nullptr)
             {
@@ -331,6 +457,12 @@ namespace queen
                 return false;
             }
 
+            if constexpr (detail::DeduceStorage<T>() == StorageType::SPARSE)
+            {
+                const SparseStorage<ComponentAllocator>* storage = m_sparseStorages.Find(TypeIdOf<T>());
+                return storage != nullptr && storage->Contains(entity);
+            }
+
             const EntityRecord* record = m_entityLocations.Get(entity);
             if (record == nullptr || record->m_archetype == nullptr)
             {
@@ -353,7 +485,13 @@ namespace queen
                 return false;
             }
 
-            return record->m_archetype->HasComponent(typeId);
+            if (record->m_archetype->HasComponent(typeId))
+            {
+                return true;
+            }
+
+            const SparseStorage<ComponentAllocator>* storage = m_sparseStorages.Find(typeId);
+            return storage != nullptr && storage->Contains(entity);
         }
 
         template <typename T> void Add(Entity entity, T&& component)
@@ -364,6 +502,12 @@ namespace queen
                 return;
             }
 
+            if constexpr (detail::DeduceStorage<std::remove_cvref_t<T>>() == StorageType::SPARSE)
+            {
+                AddSparse<std::remove_cvref_t<T>>(entity, std::forward<T>(component));
+                return;
+            }
+
             EntityRecord* record = m_entityLocations.Get(entity);
             if (record == nullptr || record->m_archetype == nullptr)
             {
@@ -375,6 +519,7 @@ namespace queen
             if (oldArch->template HasComponent<T>())
             {
                 oldArch->template SetComponent<T>(record->m_row, std::forward<T>(component));
+                oldArch->template GetColumn<std::remove_cvref_t<T>>()->MarkChanged(record->m_row, m_currentTick);
                 const T* comp = oldArch->template GetComponent<T>(record->m_row);
                 m_observers.template Trigger<OnSet<T>>(*this, entity, comp);
                 return;
@@ -403,6 +548,22 @@ namespace queen
                 return;
             }
 
+            if constexpr (detail::DeduceStorage<T>() == StorageType::SPARSE)
+            {
+                SparseStorage<ComponentAllocator>* storage = m_sparseStorages.Find(TypeIdOf<T>());
+                const T* comp = storage != nullptr ? static_cast<const T*>(storage->Get(entity)) : nullptr;
+                if (comp == nullptr)
+                {
+                    return;
+                }
+
+                // Trigger OnRemove observers BEFORE removing (so they can access the data)
+                m_observers.template Trigger<OnRemove<T>>(*this, entity, comp);
+                storage->Remove(entity);
+                m_removalLog.RecordRemove(entity, TypeIdOf<T>(), m_currentTick);
+                return;
+            }
+
             EntityRecord* record = m_entityLocations.Get(entity);
             if (record == nullptr || record->m_archetype == nullptr)
             {
@@ -428,6 +589,7 @@ namespace queen
             }
 
             MoveEntity(entity, *record, oldArch, newArch);
+            m_removalLog.RecordRemove(entity, TypeIdOf<T>(), m_currentTick);
         }
 
         template <typename T> void Set(Entity entity, T&& component)
@@ -462,6 +624,158 @@ namespace queen
             }
         }
 
+        /**
+         * Give unused table memory back to the component allocator
+         *
+         * Meant for level unloads and other mass despawns: column storage
+         * only ever grows, so without compaction a world keeps its peak
+         * footprint forever. Tables below policy.m_maxOccupancy are shrunk
+         * (see Table::ShrinkToFit). With policy.m_retireEmpty, archetypes
+         * left without entities are also removed from the component index
+         * and from every registered QueryState, so queries and systems stop
+         * visiting them, and observer filter caches are reset. Retired
+         * archetypes stay in the archetype graph, whose edges point at them,
+         * and are registered again by the first entity that moves in.
+         *
+         * Must not be called while systems or queries are running, e.g.
+         * between two World::Update calls.
+         *
+         * @code
+         *   UnloadLevel(world);
+         *   CompactStats stats = world.Compact();
+         *   LogInfo("reclaimed {} bytes", stats.m_bytesReclaimed);
+         * @endcode
+         */
+        CompactStats Compact(const CompactPolicy& policy = CompactPolicy{})
+        {
+            HIVE_PROFILE_SCOPE_N("World::Compact");
+            CompactStats stats{};
+            const size_t usedBefore = m_allocators.Components().GetUsedMemory();
+
+            const auto& archetypes = m_archetypeGraph.GetArchetypes();
+            for (size_t i = 0; i < archetypes.Size(); ++i)
+            {
+                Archetype<ComponentAllocator>* archetype = archetypes[i];
+                Table<ComponentAllocator>& table = archetype->GetTable();
+                const size_t rows = table.RowCount();
+                const size_t capacity = table.Capacity();
+                const double maxRows = static_cast<double>(policy.m_maxOccupancy) * static_cast<double>(capacity);
+
+                if (capacity > policy.m_minCapacity && static_cast<double>(rows) < maxRows)
+                {
+                    stats.m_columnsShrunk += table.ShrinkToFit(policy.m_minCapacity);
+                }
+
+                if (rows == 0 && policy.m_retireEmpty && archetype->ComponentCount() > 0 &&
+                    m_componentIndex.UnregisterArchetype(archetype))
+                {
+                    for (size_t q = 0; q < m_queryStates.Size(); ++q)
+                    {
+                        m_queryStates[q]->RemoveArchetype(archetype);
+                    }
+                    ++stats.m_archetypesRetired;
+                }
+            }
+
+            if (stats.m_archetypesRetired > 0)
+            {
+                m_observers.ClearFilterCaches();
+            }
+
+            const size_t usedAfter = m_allocators.Components().GetUsedMemory();
+            stats.m_bytesReclaimed = usedBefore > usedAfter ? usedBefore - usedAfter : 0;
+            return stats;
+        }
+
+        /**
+         * Drop every entity and component, keeping the rest of the World
+         *
+         * Level reload path: tables are emptied in bulk, running
+         * destructors only for component types that have one, and the
+         * entity allocator and location map are reset in place. Systems,
+         * resources, observers, events and the archetype graph survive, so
+         * the next level respawns into the tables and capacity of the
+         * previous one. With releaseMemory the emptied tables are compacted
+         * as well (see Compact).
+         *
+         * No observer fires and no hierarchy fixup runs. Handles to the
+         * dropped entities stay dead, and pending commands and deferred
+         * observer triggers are discarded since they target those entities,
+         * and observer filter caches are reset.
+         * Must not be called while systems or queries are running.
+         *
+         * Performance: O(archetypes + columns + entity indices), plus one
+         * destructor call per non-trivial component.
+         */
+        void ClearEntities(bool releaseMemory = false)
+        {
+            HIVE_PROFILE_SCOPE_N("World::ClearEntities");
+
+            const auto& archetypes = m_archetypeGraph.GetArchetypes();
+            for (size_t i = 0; i < archetypes.Size(); ++i)
+            {
+                archetypes[i]->GetTable().Clear();
+            }
+
+            m_sparseStorages.Clear();
+            m_entityLocations.Clear();
+            m_entityAllocator.ReleaseAll();
+            m_commands.ClearAll();
+            m_observers.DiscardPending();
+            m_observers.ClearFilterCaches();
+            m_removalLog.RecordClear(m_currentTick);
+
+            if (releaseMemory)
+            {
+                (void)Compact(CompactPolicy{1.0f, 0, true});
+            }
+        }
+
+        /**
+         * Move every entity of a staging world into this one
+         *
+         * Streaming path: a loader job builds cells or levels in a separate
+         * World on a worker thread, then the main thread merges it between
+         * two Update calls. Each staging table is appended to the matching
+         * table here with one bulk row reservation, and its columns are
+         * relocated a chunk run at a time (memcpy for trivially relocatable
+         * components, the move constructor otherwise). Sparse components
+         * are moved per entity.
+         *
+         * Merged entities get new handles, recorded in outMap when given.
+         * Parent and Children are remapped in bulk, Children lists are
+         * rebuilt with this world's allocator. Components are marked added
+         * at the current tick, then OnAdd observers run column by column,
+         * only for the component types that have some. The staging world
+         * is left empty (see ClearEntities) and keeps its archetypes and
+         * table capacity for the next load.
+         *
+         * Limitations:
+         * - Entity fields of other components still hold staging handles,
+         *   remap them through outMap
+         * - Components must not own memory from the staging world's
+         *   allocators, Children excepted
+         * - Pending commands and deferred observer triggers of the staging
+         *   world are discarded
+         * - Neither world may be running systems or queries
+         *
+         * Performance: O(archetypes + columns) bulk operations, plus
+         * O(entities) bytes copied, one move per non-relocatable component
+         * and one call per observer-watched component.
+         *
+         * Example:
+         * @code
+         *   // Worker job
+         *   LoadCell(staging, cellFile);
+         *
+         *   // Main thread, once the job is done
+         *   MergeEntityMap map;
+         *   world.MergeFrom(staging, &map);
+         *   world.FlushObservers();
+         * @endcode
+         */
+        MergeStats MergeFrom(World& staging, MergeEntityMap* outMap = nullptr);
+
         /**
          * Get raw component data for an entity by TypeId
          *
@@ -476,14 +790,88 @@ namespace queen
             if (record == nullptr || record->m_archetype == nullptr)
                 return nullptr;
 
-            return record->m_archetype->GetComponentRaw(record->m_row, typeId);
+            if (void* data = record->m_archetype->GetComponentRaw(record->m_row, typeId))
+            {
+                return data;
+            }
+
+            SparseStorage<ComponentAllocator>* storage = m_sparseStorages.Find(typeId);
+            return storage != nullptr ? storage->Get(entity) : nullptr;
+        }
+
+        /**
+         * Add or overwrite a component from type-erased data
+         *
+         * Copies data with meta's copy constructor and marks the component
+         * changed. Used by serializers and tools, no observer fires.
+         */
+        void SetComponentRaw(Entity entity, const ComponentMeta& meta, const void* data)
+        {
+            if (!IsAlive(entity))
+                return;
+
+            if (meta.m_storage == StorageType::SPARSE)
+            {
+                SetSparseRaw(entity, meta, data);
+                return;
+            }
+
+            EntityRecord* record = m_entityLocations.Get(entity);
+            if (record == nullptr || record->m_archetype == nullptr)
+                return;
+
+            Archetype<ComponentAllocator>* oldArch = record->m_archetype;
+            if (!oldArch->HasComponent(meta.m_typeId))
+            {
+                Archetype<ComponentAllocator>* newArch = m_archetypeGraph.GetOrCreateAddTarget(*oldArch, meta);
+                RegisterNewArchetype(newArch);
+                MoveEntity(entity, *record, oldArch, newArch);
+            }
+
+            Table<ComponentAllocator>& table = record->m_archetype->GetTable();
+            table.SetComponent(record->m_row, meta.m_typeId, data);
+            table.GetColumnByTypeId(meta.m_typeId)->MarkChanged(record->m_row, m_currentTick);
+        }
+
+        /**
+         * Remove a component by TypeId, dense or sparse
+         *
+         * No observer fires.
+         *
+         * @return true if the entity had the component
+         */
+        bool RemoveComponentRaw(Entity entity, TypeId typeId)
+        {
+            if (!IsAlive(entity))
+                return false;
+
+            if (SparseStorage<ComponentAllocator>* storage = m_sparseStorages.Find(typeId))
+            {
+                if (storage->Remove(entity))
+                {
+                    m_removalLog.RecordRemove(entity, typeId, m_currentTick);
+                    return true;
+                }
+            }
+
+            EntityRecord* record = m_entityLocations.Get(entity);
+            if (record == nullptr || record->m_archetype == nullptr || !record->m_archetype->HasComponent(typeId))
+                return false;
+
+            Archetype<ComponentAllocator>* oldArch = record->m_archetype;
+            Archetype<ComponentAllocator>* newArch = m_archetypeGraph.GetOrCreateRemoveTarget(*oldArch, typeId);
+            RegisterNewArchetype(newArch);
+            MoveEntity(entity, *record, oldArch, newArch);
+            m_removalLog.RecordRemove(entity, typeId, m_currentTick);
+            return true;
         }
 
         /**
          * Iterate all component TypeIds on an entity
          *
-         * Callback receives each TypeId in the entity's archetype.
-         * Useful for generic inspection (editor, serialization).
+         * Callback receives each TypeId in the entity's archetype, followed
+         * by its sparse components. Useful for generic inspection (editor,
+         * serialization).
          */
         template <typename F> void ForEachComponentType(Entity entity, F&& callback) const
         {
@@ -495,6 +883,12 @@ namespace queen
             const auto& types = record->m_archetype->GetComponentTypes();
             for (size_t i = 0; i < types.Size(); ++i)
                 callback(types[i]);
+            for (size_t i = 0; i < m_sparseStorages.StorageCount(); ++i)
+            {
+                const SparseStorage<ComponentAllocator>* storage = m_sparseStorages.GetStorage(i);
+                if (storage->Contains(entity))
+                    callback(storage->GetTypeId());
+            }
         }
 
         // Resources (global singletons)
@@ -509,6 +903,7 @@ namespace queen
             {
                 auto* typed = static_cast<DecayedT*>(*existing);
                 *typed = std::forward<T>(resource);
+                MarkResourceChanged(typeId);
                 return;
             }
 
@@ -519,6 +914,7 @@ namespace queen
 
             m_resources.Insert(typeId, data);
             m_resourceMetas.PushBack(ComponentMeta::Of<DecayedT>());
+            m_resourceTicks.Insert(typeId, m_currentTick);
         }
 
         template <typename T> [[nodiscard]] T* Resource() noexcept
@@ -585,6 +981,42 @@ namespace queen
 
             m_allocators.Persistent().Deallocate(data);
             m_resources.Remove(typeId);
+            m_resourceTicks.Remove(typeId);
+        }
+
+        /**
+         * Flag resource T as changed at the current tick
+         *
+         * Drives RunIfResourceChanged systems. InsertResource and systems
+         * taking ResMut<T> mark the resource, writes through Resource<T>()
+         * must be flagged by the caller.
+         */
+        template <typename T> void MarkResourceChanged() noexcept
+        {
+            MarkResourceChanged(TypeIdOf<T>());
+        }
+
+        void MarkResourceChanged(TypeId typeId) noexcept
+        {
+            Tick* tick = m_resourceTicks.Find(typeId);
+            if (tick != nullptr)
+            {
+                *tick = m_currentTick;
+            }
+        }
+
+        /**
+         * Tick of the last insert or change of resource T, Tick{0} if absent
+         */
+        template <typename T> [[nodiscard]] Tick ResourceChangeTick() const noexcept
+        {
+            return ResourceChangeTick(TypeIdOf<T>());
+        }
+
+        [[nodiscard]] Tick ResourceChangeTick(TypeId typeId) const noexcept
+        {
+            const Tick* tick = m_resourceTicks.Find(typeId);
+            return tick != nullptr ? *tick : Tick{0};
         }
 
         [[nodiscard]] size_t ResourceCount() const noexcept
@@ -646,6 +1078,22 @@ namespace queen
             return m_componentIndex;
         }
 
+        [[nodiscard]] SparseStorageRegistry<ComponentAllocator>& GetSparseStorages() noexcept
+        {
+            return m_sparseStorages;
+        }
+
+        [[nodiscard]] const SparseStorageRegistry<ComponentAllocator>& GetSparseStorages() const noexcept
+        {
+            return m_sparseStorages;
+        }
+
+        [[nodiscard]] const EntityLocationMap<ComponentAllocator, Archetype<ComponentAllocator>>&
+        GetEntityLocations() const noexcept
+        {
+            return m_entityLocations;
+        }
+
         // Queries
 
         /**
@@ -665,7 +1113,8 @@ namespace queen
         template <typename... Terms> [[nodiscard]] queen::Query<PersistentAllocator, Terms...> Query()
         {
             std::lock_guard<HIVE_PROFILE_LOCKABLE_BASE(std::mutex)> lock{m_allocators.PersistentMutex()};
-            return queen::Query<PersistentAllocator, Terms...>{m_allocators.Persistent(), m_componentIndex};
+            return queen::Query<PersistentAllocator, Terms...>{m_allocators.Persistent(), m_componentIndex,
+                                                               &m_sparseStorages, &m_entityLocations};
         }
 
         /**
@@ -679,7 +1128,8 @@ namespace queen
         template <typename... Terms, typename Callback> void QueryEach(Callback&& callback)
         {
             std::lock_guard<HIVE_PROFILE_LOCKABLE_BASE(std::mutex)> lock{m_allocators.PersistentMutex()};
-            queen::Query<PersistentAllocator, Terms...> query{m_allocators.Persistent(), m_componentIndex};
+            queen::Query<PersistentAllocator, Terms...> query{m_allocators.Persistent(), m_componentIndex,
+                                                              &m_sparseStorages, &m_entityLocations};
             callback(query);
             // Query destructor runs here while still holding the lock
         }
@@ -692,7 +1142,8 @@ namespace queen
         template <typename... Terms, typename F> void QueryEachLocked(F&& func)
         {
             std::lock_guard<HIVE_PROFILE_LOCKABLE_BASE(std::mutex)> lock{m_allocators.PersistentMutex()};
-            queen::Query<PersistentAllocator, Terms...> query{m_allocators.Persistent(), m_componentIndex};
+            queen::Query<PersistentAllocator, Terms...> query{m_allocators.Persistent(), m_componentIndex,
+                                                              &m_sparseStorages, &m_entityLocations};
             query.Each(std::forward<F>(func));
         }
 
@@ -704,10 +1155,42 @@ namespace queen
         template <typename... Terms, typename F> void QueryEachWithEntityLocked(F&& func)
         {
             std::lock_guard<HIVE_PROFILE_LOCKABLE_BASE(std::mutex)> lock{m_allocators.PersistentMutex()};
-            queen::Query<PersistentAllocator, Terms...> query{m_allocators.Persistent(), m_componentIndex};
+            queen::Query<PersistentAllocator, Terms...> query{m_allocators.Persistent(), m_componentIndex,
+                                                              &m_sparseStorages, &m_entityLocations};
             query.EachWithEntity(std::forward<F>(func));
         }
 
+        /**
+         * Register a long-lived query state for incremental archetype matching
+         *
+         * Every archetype created after registration is offered to the state,
+         * so a persistent Query stays current without being rebuilt. Used by
+         * system executors, which own their Query for the system's lifetime.
+         * The state must be unregistered before it is destroyed.
+         */
+        void RegisterQueryState(QueryState<PersistentAllocator>* state)
+        {
+            m_queryStates.PushBack(state);
+        }
+
+        void UnregisterQueryState(QueryState<PersistentAllocator>* state)
+        {
+            for (size_t i = 0; i < m_queryStates.Size(); ++i)
+            {
+                if (m_queryStates[i] == state)
+                {
+                    m_queryStates[i] = m_queryStates.Back();
+                    m_queryStates.PopBack();
+                    return;
+                }
+            }
+        }
+
+        [[nodiscard]] size_t QueryStateCount() const noexcept
+        {
+            return m_queryStates.Size();
+        }
+
         // Systems
 
         /**
@@ -791,6 +1274,7 @@ namespace queen
             IncrementTick();
             m_events.SwapBuffers();
             m_scheduler.RunAll(*this, m_systems);
+            m_observers.FlushDeferred(*this);
             m_allocators.ResetFrame();
             HIVE_PROFILE_PLOT("World::EntityCount", static_cast<int64_t>(EntityCount()));
             HIVE_PROFILE_PLOT("World::ArchetypeCount", static_cast<int64_t>(ArchetypeCount()));
@@ -816,7 +1300,10 @@ namespace queen
                 m_parallelScheduler = new (mem) ParallelScheduler<PersistentAllocator>{m_allocators.Persistent(), jobs};
             }
 
+            m_events.BeginParallelWrites(jobs.WorkerCount());
             m_parallelScheduler->RunAll(*this, m_systems);
+            m_events.EndParallelWrites();
+            m_observers.FlushDeferred(*this);
             m_allocators.ResetFrame();
             m_allocators.ResetThreadFrames();
             HIVE_PROFILE_PLOT("World::EntityCount", static_cast<int64_t>(EntityCount()));
@@ -844,6 +1331,8 @@ namespace queen
          * Systems with conflicting data access are serialized.
          * Creates the parallel scheduler on first call.
          * Thread allocators are reset after each system batch.
+         * Events sent by systems are staged per worker and merged into
+         * their queues in worker order once all systems have run.
          *
          * @param jobs Drone job submitter for parallel execution
          */
@@ -868,6 +1357,17 @@ namespace queen
             return m_parallelScheduler;
         }
 
+        /**
+         * Job submitter used by the parallel scheduler
+         *
+         * Invalid until UpdateParallel/AdvanceParallel has run once. ParEach
+         * systems fall back to sequential iteration in that case.
+         */
+        [[nodiscard]] drone::JobSubmitter GetJobSubmitter() const noexcept
+        {
+            return m_parallelScheduler != nullptr ? m_parallelScheduler->Jobs() : drone::JobSubmitter{};
+        }
+
         [[nodiscard]] const ParallelScheduler<PersistentAllocator>* GetParallelScheduler() const noexcept
         {
             return m_parallelScheduler;
@@ -1002,6 +1502,18 @@ namespace queen
             return m_observers.ObserverCount();
         }
 
+        /**
+         * Dispatch the triggers queued for deferred (EachBatch) observers
+         *
+         * Update() does this after its systems ran. Call it to see the
+         * effects of bulk changes made outside Update, e.g. after a load.
+         */
+        void FlushObservers()
+        {
+            HIVE_PROFILE_SCOPE_N("World::FlushObservers");
+            m_observers.FlushDeferred(*this);
+        }
+
         // Hierarchy
 
         /**
@@ -1331,8 +1843,35 @@ namespace queen
             ++m_currentTick;
         }
 
+        /**
+         * Record despawns and component removals in the removal log
+         *
+         * Off by default. Component ticks only describe what still exists,
+         * so delta serialization needs the log to report what disappeared
+         * since a tick (see RemovalLog).
+         */
+        void TrackRemovals(bool enabled) noexcept
+        {
+            m_removalLog.SetEnabled(enabled);
+        }
+
+        [[nodiscard]] const RemovalLog& GetRemovalLog() const noexcept
+        {
+            return m_removalLog;
+        }
+
+        /**
+         * Drop removal records older than tick, once no consumer needs them
+         */
+        void TrimRemovals(Tick before)
+        {
+            m_removalLog.TrimBefore(before);
+        }
+
     private:
         friend class EntityBuilder;
+        friend class WorldSnapshot;
+        friend class WorldDeserializer;
 
         template <comb::Allocator OtherAlloc> friend class CommandBuffer;
 
@@ -1347,13 +1886,134 @@ namespace queen
             m_entityLocations.Set(entity, EntityRecord{archetype, row});
         }
 
-        void RegisterNewArchetype(Archetype<ComponentAllocator>* archetype)
+        // Allocate count entities straight into unconstructed rows, record their locations and copy
+        // them to outEntities when it is not null
+        uint32_t ReserveBatchRows(Archetype<ComponentAllocator>* archetype, Entity* outEntities, size_t count)
         {
-            if (archetype->ComponentCount() > 0)
+            Table<ComponentAllocator>& table = archetype->GetTable();
+            const auto firstRow = static_cast<uint32_t>(table.RowCount());
+            Entity* entities = table.AppendRowsUninitialized(count, m_currentTick);
+            m_entityAllocator.AllocateBatch(entities, count);
+
+            m_entityLocations.Reserve(m_entityAllocator.TotalAllocated());
+            for (size_t i = 0; i < count; ++i)
             {
-                bool alreadyRegistered = false;
-                const auto* list = m_componentIndex.GetArchetypesWith(archetype->GetComponentTypes()[0]);
-                if (list != nullptr)
+                m_entityLocations.Set(entities[i], EntityRecord{archetype, firstRow + static_cast<uint32_t>(i)});
+            }
+
+            if (outEntities != nullptr)
+            {
+                std::copy_n(entities, count, outEntities);
+            }
+            return firstRow;
+        }
+
+        // Staging table appended by MergeFrom, entities at merged[m_first, m_first + m_count)
+        struct MergedRange
+        {
+            Archetype<ComponentAllocator>* m_source;
+            Archetype<ComponentAllocator>* m_target;
+            uint32_t m_firstRow;
+            size_t m_first;
+            size_t m_count;
+        };
+
+        // Move source rows [0, count) into uninitialized target rows [firstRow, firstRow + count)
+        static void RelocateRows(Column<ComponentAllocator>& source, Column<ComponentAllocator>& target,
+                                 size_t firstRow, size_t count)
+        {
+            const ComponentMeta& meta = source.GetMeta();
+            for (size_t i = 0; i < count;)
+            {
+                const size_t end = std::min({count, source.ChunkEnd(i), target.ChunkEnd(firstRow + i) - firstRow});
+                auto* dst = static_cast<std::byte*>(target.GetRaw(firstRow + i));
+                auto* src = static_cast<std::byte*>(source.GetRaw(i));
+                if (meta.m_triviallyRelocatable)
+                {
+                    std::memcpy(dst, src, (end - i) * meta.m_size);
+                }
+                else
+                {
+                    for (size_t r = 0; r < end - i; ++r)
+                    {
+                        meta.MoveConstruct(dst + r * meta.m_size, src + r * meta.m_size);
+                    }
+                }
+                i = end;
+            }
+        }
+
+        // Construct a type-erased component in place, copying from src when given
+        static void ConstructRaw(const ComponentMeta& meta, void* dst, const void* src)
+        {
+            if (src != nullptr)
+            {
+                if (meta.m_copy != nullptr)
+                {
+                    meta.m_copy(dst, src);
+                }
+                else
+                {
+                    std::memcpy(dst, src, meta.m_size);
+                }
+            }
+            else if (meta.m_construct != nullptr)
+            {
+                meta.m_construct(dst);
+            }
+            else
+            {
+                std::memset(dst, 0, meta.m_size);
+            }
+        }
+
+        // Despawn live entities, swap-removing rows per archetype from the highest row down
+        void DespawnBatched(detail::PendingDespawn* despawns, size_t count)
+        {
+            HIVE_PROFILE_SCOPE_N("World::DespawnBatched");
+            for (size_t i = 0; i < count; ++i)
+            {
+                const EntityRecord* record = m_entityLocations.Get(despawns[i].m_entity);
+                despawns[i].m_archetype = record->m_archetype;
+                despawns[i].m_row = record->m_row;
+            }
+
+            // Descending rows guarantee the swapped-in last row is never itself pending
+            std::sort(despawns, despawns + count, [](const detail::PendingDespawn& a, const detail::PendingDespawn& b) {
+                return a.m_archetype != b.m_archetype ? a.m_archetype < b.m_archetype : a.m_row > b.m_row;
+            });
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto* archetype = static_cast<Archetype<ComponentAllocator>*>(despawns[i].m_archetype);
+                const Entity entity = despawns[i].m_entity;
+                const uint32_t row = despawns[i].m_row;
+
+                Entity moved = archetype->FreeRow(row);
+
+                if (!moved.IsNull() && !(moved == entity))
+                {
+                    EntityRecord* movedRecord = m_entityLocations.Get(moved);
+                    if (movedRecord != nullptr)
+                    {
+                        movedRecord->m_row = row;
+                    }
+                }
+
+                m_sparseStorages.RemoveEntity(entity);
+                m_entityLocations.Remove(entity);
+                m_entityAllocator.Deallocate(entity);
+                m_removalLog.RecordDespawn(entity, m_currentTick);
+            }
+        }
+
+        void RegisterNewArchetype(Archetype<ComponentAllocator>* archetype)
+        {
+            if (archetype->ComponentCount() > 0)
+            {
+                bool alreadyRegistered = false;
+                const auto* list = m_componentIndex.GetArchetypesWith(archetype->GetComponentTypes()[0]);
+                if (list != nullptr)
                 {
                     for (size_t i = 0; i < list->Size(); ++i)
                     {
@@ -1368,32 +2028,85 @@ namespace queen
                 if (!alreadyRegistered)
                 {
                     m_componentIndex.RegisterArchetype(archetype);
+
+                    for (size_t i = 0; i < m_queryStates.Size(); ++i)
+                    {
+                        m_queryStates[i]->TryAddArchetype(archetype);
+                    }
                 }
             }
         }
 
+        // Copy a type-erased sparse component in, overwriting any existing value
+        void SetSparseRaw(Entity entity, const ComponentMeta& meta, const void* data)
+        {
+            SparseStorage<ComponentAllocator>& storage = m_sparseStorages.GetOrCreate(meta);
+
+            void* existing = storage.Get(entity);
+            if (existing == nullptr)
+            {
+                storage.InsertCopy(entity, data, m_currentTick);
+                return;
+            }
+
+            if (meta.m_destruct != nullptr)
+            {
+                meta.m_destruct(existing);
+            }
+
+            if (meta.m_copy != nullptr)
+            {
+                meta.m_copy(existing, data);
+            }
+            else
+            {
+                std::memcpy(existing, data, meta.m_size);
+            }
+            storage.MarkChanged(entity, m_currentTick);
+        }
+
+        // Sparse components live beside the archetype, so adding one never moves the entity
+        template <typename T, typename Arg> void AddSparse(Entity entity, Arg&& component)
+        {
+            SparseStorage<ComponentAllocator>& storage = m_sparseStorages.GetOrCreate(ComponentMeta::Of<T>());
+
+            if (T* existing = static_cast<T*>(storage.Get(entity)))
+            {
+                *existing = std::forward<Arg>(component);
+                storage.MarkChanged(entity, m_currentTick);
+                m_observers.template Trigger<OnSet<T>>(*this, entity, static_cast<const T*>(existing));
+                return;
+            }
+
+            T value{std::forward<Arg>(component)};
+            const T* comp = static_cast<const T*>(storage.InsertMove(entity, &value, m_currentTick));
+            m_observers.template Trigger<OnAdd<T>>(*this, entity, comp);
+        }
+
         void MoveEntity(Entity entity, EntityRecord& record, Archetype<ComponentAllocator>* oldArch,
                         Archetype<ComponentAllocator>* newArch)
         {
             HIVE_PROFILE_SCOPE_N("World::MoveEntity");
             uint32_t oldRow = record.m_row;
 
-            uint32_t newRow = newArch->AllocateRow(entity, m_currentTick);
+            Table<ComponentAllocator>& oldTable = oldArch->GetTable();
+            Table<ComponentAllocator>& newTable = newArch->GetTable();
 
-            const auto& oldMetas = oldArch->GetComponentMetas();
+            // Shared components are moved into the raw row, only the new ones are default-constructed
+            uint32_t newRow = newTable.AllocateRowsUninitialized(&entity, 1, m_currentTick);
 
-            for (size_t i = 0; i < oldMetas.Size(); ++i)
+            for (size_t i = 0; i < newTable.ColumnCount(); ++i)
             {
-                TypeId typeId = oldMetas[i].m_typeId;
+                Column<ComponentAllocator>& dstColumn = newTable.GetColumnAt(i);
+                const ComponentMeta& meta = dstColumn.GetMeta();
 
-                if (newArch->HasComponent(typeId))
+                if (Column<ComponentAllocator>* srcColumn = oldTable.GetColumnByDenseId(meta.m_denseId))
                 {
-                    void* src = oldArch->GetComponentRaw(oldRow, typeId);
-                    void* dst = newArch->GetComponentRaw(newRow, typeId);
-                    if (oldMetas[i].m_move != nullptr)
-                        oldMetas[i].m_move(dst, src);
-                    else
-                        std::memcpy(dst, src, oldMetas[i].m_size);
+                    meta.MoveConstruct(dstColumn.GetRaw(newRow), srcColumn->GetRaw(oldRow));
+                }
+                else
+                {
+                    ConstructRaw(meta, dstColumn.GetRaw(newRow), nullptr);
                 }
             }
 
@@ -1419,9 +2132,13 @@ namespace queen
         EntityLocationMap<ComponentAllocator, Archetype<ComponentAllocator>> m_entityLocations;
         ArchetypeGraph<ComponentAllocator> m_archetypeGraph;
         ComponentIndex<PersistentAllocator> m_componentIndex;
+        SparseStorageRegistry<ComponentAllocator> m_sparseStorages;
+        // Must outlive m_systems: system executors unregister their cached queries on destruction
+        wax::Vector<QueryState<PersistentAllocator>*> m_queryStates;
 
         wax::HashMap<TypeId, void*> m_resources;
         wax::Vector<ComponentMeta> m_resourceMetas;
+        wax::HashMap<TypeId, Tick> m_resourceTicks;
 
         SystemStorage<PersistentAllocator> m_systems;
         Scheduler<PersistentAllocator> m_scheduler;
@@ -1429,6 +2146,7 @@ namespace queen
         Commands<PersistentAllocator> m_commands;
         Events<PersistentAllocator> m_events;
         ObserverStorage<PersistentAllocator> m_observers;
+        RemovalLog m_removalLog;
         Tick m_currentTick{1}; // Start at 1 so tick 0 means "never changed"
     };
 
@@ -1521,6 +2239,10 @@ namespace queen
 
             for (size_t i = 0; i < m_pendingMetas.Size(); ++i)
             {
+                if (m_pendingMetas[i].m_storage == StorageType::SPARSE)
+                {
+                    continue;
+                }
                 archetype = m_world->m_archetypeGraph.GetOrCreateAddTarget(*archetype, m_pendingMetas[i]);
             }
 
@@ -1532,7 +2254,15 @@ namespace queen
             for (size_t i = 0; i < m_pendingMetas.Size(); ++i)
             {
                 TypeId typeId = m_pendingMetas[i].m_typeId;
-                archetype->SetComponent(record->m_row, typeId, m_pendingData[i]);
+                if (m_pendingMetas[i].m_storage == StorageType::SPARSE)
+                {
+                    m_world->m_sparseStorages.GetOrCreate(m_pendingMetas[i])
+                        .InsertMove(entity, m_pendingData[i], m_world->m_currentTick);
+                }
+                else
+                {
+                    archetype->SetComponent(record->m_row, typeId, m_pendingData[i]);
+                }
 
                 if (m_pendingMetas[i].m_destruct != nullptr)
                 {
@@ -1564,6 +2294,304 @@ namespace queen
         return builder.Build();
     }
 
+    template <typename... Components, typename Init>
+    void World::SpawnBatch(size_t count, Init&& init, Entity* outEntities)
+    {
+        static_assert(sizeof...(Components) > 0, "SpawnBatch requires at least one component");
+        static_assert(((detail::DeduceStorage<Components>() != StorageType::SPARSE) && ...),
+                      "SpawnBatch does not support sparse components");
+        static_assert((std::is_default_constructible_v<Components> && ...),
+                      "SpawnBatch components must be default-constructible");
+
+        HIVE_PROFILE_SCOPE_N("World::SpawnBatch");
+        if (count == 0)
+        {
+            return;
+        }
+
+        Archetype<ComponentAllocator>* archetype = m_archetypeGraph.GetEmptyArchetype();
+        ((archetype = m_archetypeGraph.template GetOrCreateAddTarget<Components>(*archetype)), ...);
+        RegisterNewArchetype(archetype);
+
+        const uint32_t firstRow = ReserveBatchRows(archetype, outEntities, count);
+
+        Table<ComponentAllocator>& table = archetype->GetTable();
+
+        // Rows are contiguous within a chunk, so walk the new rows one chunk at a time
+        for (size_t segment = 0; segment < count;)
+        {
+            const size_t row = firstRow + segment;
+            const size_t segmentEnd = std::min(count, table.ChunkEnd(row) - firstRow);
+            const size_t segmentSize = segmentEnd - segment;
+
+            std::tuple<Components*...> columns{
+                static_cast<Components*>(table.template GetColumn<Components>()->GetRaw(row))...};
+
+            // Construct column by column to keep writes sequential
+            (
+                [&] {
+                    Components* data = std::get<Components*>(columns);
+                    for (size_t i = 0; i < segmentSize; ++i)
+                    {
+                        new (data + i) Components{};
+                    }
+                }(),
+                ...);
+
+            for (size_t i = 0; i < segmentSize; ++i)
+            {
+                init(segment + i, std::get<Components*>(columns)[i]...);
+            }
+
+            segment = segmentEnd;
+        }
+    }
+
+    inline void World::SpawnBatchRaw(size_t count, const SpawnBatchComponent* components, size_t componentCount,
+                                     Entity* outEntities)
+    {
+        HIVE_PROFILE_SCOPE_N("World::SpawnBatchRaw");
+        if (count == 0)
+        {
+            return;
+        }
+
+        Archetype<ComponentAllocator>* archetype = m_archetypeGraph.GetEmptyArchetype();
+        for (size_t c = 0; c < componentCount; ++c)
+        {
+            for (size_t other = 0; other < c; ++other)
+            {
+                hive::Assert(components[other].m_meta.m_typeId != components[c].m_meta.m_typeId,
+                             "SpawnBatchRaw component listed twice");
+            }
+
+            if (components[c].m_meta.m_storage != StorageType::SPARSE)
+            {
+                archetype = m_archetypeGraph.GetOrCreateAddTarget(*archetype, components[c].m_meta);
+            }
+        }
+        RegisterNewArchetype(archetype);
+
+        const uint32_t firstRow = ReserveBatchRows(archetype, outEntities, count);
+        Table<ComponentAllocator>& table = archetype->GetTable();
+        const Entity* entities = table.GetEntities() + firstRow;
+
+        for (size_t c = 0; c < componentCount; ++c)
+        {
+            const SpawnBatchComponent& component = components[c];
+            const ComponentMeta& meta = component.m_meta;
+            const auto* source = static_cast<const std::byte*>(component.m_source);
+
+            if (meta.m_storage == StorageType::SPARSE)
+            {
+                SparseStorage<ComponentAllocator>& storage = m_sparseStorages.GetOrCreate(meta);
+                void* prototype = nullptr;
+                if (source == nullptr)
+                {
+                    prototype = m_allocators.Persistent().Allocate(meta.m_size, meta.m_alignment);
+                    hive::Assert(prototype != nullptr, "Failed to allocate sparse component prototype");
+                    ConstructRaw(meta, prototype, nullptr);
+                }
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const void* src = source != nullptr ? source + i * component.m_stride : prototype;
+                    static_cast<void>(storage.InsertCopy(entities[i], src, m_currentTick));
+                }
+
+                if (prototype != nullptr)
+                {
+                    if (meta.m_destruct != nullptr)
+                    {
+                        meta.m_destruct(prototype);
+                    }
+                    m_allocators.Persistent().Deallocate(prototype);
+                }
+                continue;
+            }
+
+            Column<ComponentAllocator>* column = table.GetColumnByTypeId(meta.m_typeId);
+            const bool packed = source != nullptr && component.m_stride == meta.m_size && meta.m_triviallyCopyable;
+            for (size_t segment = 0; segment < count;)
+            {
+                const size_t segmentEnd = std::min(count, table.ChunkEnd(firstRow + segment) - firstRow);
+                auto* dst = static_cast<std::byte*>(column->GetRaw(firstRow + segment));
+                if (packed)
+                {
+                    std::memcpy(dst, source + segment * meta.m_size, (segmentEnd - segment) * meta.m_size);
+                    segment = segmentEnd;
+                    continue;
+                }
+
+                for (size_t i = segment; i < segmentEnd; ++i)
+                {
+                    const void* src = source != nullptr ? source + i * component.m_stride : nullptr;
+                    ConstructRaw(meta, dst + (i - segment) * meta.m_size, src);
+                }
+                segment = segmentEnd;
+            }
+        }
+    }
+
+    inline MergeStats World::MergeFrom(World& staging, MergeEntityMap* outMap)
+    {
+        HIVE_PROFILE_SCOPE_N("World::MergeFrom");
+        hive::Assert(&staging != this, "World::MergeFrom needs a separate staging world");
+
+        MergeStats stats{};
+        MergeEntityMap localMap{m_allocators.Persistent()};
+        MergeEntityMap& map = outMap != nullptr ? *outMap : localMap;
+        map.Reset(staging.m_entityAllocator.TotalAllocated());
+
+        const TypeId parentId = TypeIdOf<Parent>();
+        const TypeId childrenId = TypeIdOf<Children>();
+
+        wax::Vector<Entity> merged{m_allocators.Persistent()};
+        merged.Resize(staging.EntityCount());
+        wax::Vector<MergedRange> ranges{m_allocators.Persistent()};
+
+        // 1. Append every staging table to the matching table here
+        size_t first = 0;
+        const auto& archetypes = staging.m_archetypeGraph.GetArchetypes();
+        for (size_t a = 0; a < archetypes.Size(); ++a)
+        {
+            Archetype<ComponentAllocator>* source = archetypes[a];
+            const size_t count = source->EntityCount();
+            if (count == 0)
+            {
+                continue;
+            }
+
+            Archetype<ComponentAllocator>* target = m_archetypeGraph.GetEmptyArchetype();
+            const auto& metas = source->GetComponentMetas();
+            for (size_t c = 0; c < metas.Size(); ++c)
+            {
+                target = m_archetypeGraph.GetOrCreateAddTarget(*target, metas[c]);
+            }
+            RegisterNewArchetype(target);
+
+            Entity* entities = merged.Data() + first;
+            const uint32_t firstRow = ReserveBatchRows(target, entities, count);
+            const Entity* stagingEntities = source->GetEntities();
+            for (size_t i = 0; i < count; ++i)
+            {
+                map.Set(stagingEntities[i], entities[i]);
+            }
+
+            Table<ComponentAllocator>& from = source->GetTable();
+            Table<ComponentAllocator>& to = target->GetTable();
+            for (size_t c = 0; c < from.ColumnCount(); ++c)
+            {
+                Column<ComponentAllocator>& column = from.GetColumnAt(c);
+                Column<ComponentAllocator>* dst = to.GetColumnByTypeId(column.GetTypeId());
+                if (column.GetTypeId() == childrenId)
+                {
+                    // Filled once every entity is mapped, the staging lists use the staging allocator
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        new (dst->GetRaw(firstRow + i)) Children{m_allocators.Persistent()};
+                    }
+                    continue;
+                }
+                RelocateRows(column, *dst, firstRow, count);
+            }
+
+            ranges.PushBack(MergedRange{source, target, firstRow, first, count});
+            first += count;
+            stats.m_entitiesMerged += count;
+            ++stats.m_archetypesMerged;
+        }
+
+        // 2. Sparse components, moved per entity
+        for (size_t s = 0; s < staging.m_sparseStorages.StorageCount(); ++s)
+        {
+            SparseStorage<ComponentAllocator>* source = staging.m_sparseStorages.GetStorage(s);
+            if (source == nullptr || source->IsEmpty())
+            {
+                continue;
+            }
+
+            SparseStorage<ComponentAllocator>& target = m_sparseStorages.GetOrCreate(source->GetMeta());
+            Column<ComponentAllocator>& column = source->GetColumn();
+            for (size_t i = 0; i < source->Count(); ++i)
+            {
+                static_cast<void>(target.InsertMove(map.Map(source->EntityAt(i)), column.GetRaw(i), m_currentTick));
+            }
+            stats.m_sparseComponentsMerged += source->Count();
+        }
+
+        // 3. Hierarchy, rows are still where step 1 put them
+        for (const MergedRange& range : ranges)
+        {
+            Table<ComponentAllocator>& to = range.m_target->GetTable();
+            if (Column<ComponentAllocator>* parents = to.GetColumnByTypeId(parentId))
+            {
+                for (size_t i = 0; i < range.m_count; ++i)
+                {
+                    Parent* parent = parents->Get<Parent>(range.m_firstRow + i);
+                    parent->m_entity = map.Map(parent->m_entity);
+                }
+            }
+
+            if (Column<ComponentAllocator>* children = to.GetColumnByTypeId(childrenId))
+            {
+                Column<ComponentAllocator>* source = range.m_source->GetTable().GetColumnByTypeId(childrenId);
+                for (size_t i = 0; i < range.m_count; ++i)
+                {
+                    const Children* staged = source->Get<Children>(i);
+                    Children* list = children->Get<Children>(range.m_firstRow + i);
+                    for (size_t k = 0; k < staged->Count(); ++k)
+                    {
+                        list->Add(map.Map(staged->At(k)));
+                    }
+                }
+            }
+        }
+
+        // 4. OnAdd observers, by handle since callbacks may move rows
+        for (const MergedRange& range : ranges)
+        {
+            const auto& types = range.m_target->GetComponentTypes();
+            for (size_t c = 0; c < types.Size(); ++c)
+            {
+                if (!m_observers.HasObservers(TriggerType::ADD, types[c]))
+                {
+                    continue;
+                }
+
+                for (size_t i = range.m_first; i < range.m_first + range.m_count; ++i)
+                {
+                    if (const void* data = GetComponentRaw(merged[i], types[c]))
+                    {
+                        m_observers.Trigger(TriggerType::ADD, types[c], *this, merged[i], data);
+                    }
+                }
+            }
+        }
+
+        for (size_t s = 0; s < staging.m_sparseStorages.StorageCount(); ++s)
+        {
+            const SparseStorage<ComponentAllocator>* source = staging.m_sparseStorages.GetStorage(s);
+            if (source == nullptr || !m_observers.HasObservers(TriggerType::ADD, source->GetTypeId()))
+            {
+                continue;
+            }
+
+            for (size_t i = 0; i < source->Count(); ++i)
+            {
+                const Entity entity = map.Map(source->EntityAt(i));
+                if (const void* data = GetComponentRaw(entity, source->GetTypeId()))
+                {
+                    m_observers.Trigger(TriggerType::ADD, source->GetTypeId(), *this, entity, data);
+                }
+            }
+        }
+
+        // Destroys the moved-from components and the staging Children lists
+        staging.ClearEntities();
+        return stats;
+    }
+
     // CommandBuffer::Flush implementation (here to avoid circular dependency)
 
     template <comb::Allocator Allocator> void CommandBuffer<Allocator>::Flush(World& world)
@@ -1627,6 +2655,12 @@ namespace queen
                         break;
                     }
 
+                    if (cmd.m_meta.m_storage == StorageType::SPARSE)
+                    {
+                        world.SetSparseRaw(entity, cmd.m_meta, cmd.m_data);
+                        break;
+                    }
+
                     auto* record = world.m_entityLocations.Get(entity);
                     if (record == nullptr || record->m_archetype == nullptr)
                     {
@@ -1661,6 +2695,15 @@ namespace queen
                         break;
                     }
 
+                    if (SparseStorage<ComponentAllocator>* storage = world.m_sparseStorages.Find(cmd.m_componentType))
+                    {
+                        if (storage->Remove(entity))
+                        {
+                            world.m_removalLog.RecordRemove(entity, cmd.m_componentType, world.m_currentTick);
+                            break;
+                        }
+                    }
+
                     auto* record = world.m_entityLocations.Get(entity);
                     if (record == nullptr || record->m_archetype == nullptr)
                     {
@@ -1681,6 +2724,7 @@ namespace queen
                         world.RegisterNewArchetype(newArch);
                         world.MoveEntity(entity, *record, oldArch, newArch);
                     }
+                    world.m_removalLog.RecordRemove(entity, cmd.m_componentType, world.m_currentTick);
                     break;
                 }
 
@@ -1691,6 +2735,12 @@ namespace queen
                         break;
                     }
 
+                    if (cmd.m_meta.m_storage == StorageType::SPARSE)
+                    {
+                        world.SetSparseRaw(entity, cmd.m_meta, cmd.m_data);
+                        break;
+                    }
+
                     auto* record = world.m_entityLocations.Get(entity);
                     if (record == nullptr || record->m_archetype == nullptr)
                     {
@@ -1721,18 +2771,306 @@ namespace queen
         }
 
         // Clear commands but preserve spawned_entities_ for GetSpawnedEntity() calls
+        ReleaseCommands();
+    }
+
+    template <comb::Allocator Allocator> void CommandBuffer<Allocator>::FlushBatched(World& world)
+    {
+        HIVE_PROFILE_SCOPE_N("CommandBuffer::FlushBatched");
+        m_spawnedEntities.Clear();
+        m_spawnedEntities.Reserve(m_spawnCount);
+
+        for (uint32_t i = 0; i < m_spawnCount; ++i)
+        {
+            m_spawnedEntities.PushBack(Entity::Invalid());
+        }
+
+        FlushSpawnsBatched(world);
+        FlushEntityCommandsBatched(world);
+
+        ReleaseCommands();
+    }
+
+    template <comb::Allocator Allocator> void CommandBuffer<Allocator>::FlushSpawnsBatched(World& world)
+    {
+        if (m_spawnCount == 0)
+        {
+            return;
+        }
+
+        // Components queued on pending entities, grouped by spawn index in insertion order
+        m_flushKeys.Clear();
         for (size_t i = 0; i < m_commands.Size(); ++i)
         {
             const detail::Command& cmd = m_commands[i];
-            if (cmd.m_data != nullptr && cmd.m_meta.m_destruct != nullptr)
+            if (cmd.m_type == CommandType::ADD_COMPONENT && IsPendingEntity(cmd.m_entity) &&
+                cmd.m_entity.Index() < m_spawnCount)
+            {
+                m_flushKeys.PushBack((static_cast<uint64_t>(cmd.m_entity.Index()) << 32) | static_cast<uint64_t>(i));
+            }
+        }
+        std::sort(m_flushKeys.begin(), m_flushKeys.end());
+
+        // m_flushRanges[s]..m_flushRanges[s + 1] are the keys of spawn s
+        m_flushRanges.Clear();
+        m_flushRanges.Resize(static_cast<size_t>(m_spawnCount) + 1, 0);
+        for (size_t k = 0; k < m_flushKeys.Size(); ++k)
+        {
+            ++m_flushRanges[static_cast<size_t>(m_flushKeys[k] >> 32) + 1];
+        }
+        for (uint32_t s = 0; s < m_spawnCount; ++s)
+        {
+            m_flushRanges[s + 1] += m_flushRanges[s];
+        }
+
+        m_flushSpawns.Clear();
+        m_flushSpawns.Reserve(m_spawnCount);
+        for (uint32_t s = 0; s < m_spawnCount; ++s)
+        {
+            Archetype<ComponentAllocator>* archetype = world.m_archetypeGraph.GetEmptyArchetype();
+            for (uint32_t k = m_flushRanges[s]; k < m_flushRanges[s + 1]; ++k)
+            {
+                const detail::Command& cmd = m_commands[static_cast<uint32_t>(m_flushKeys[k])];
+                if (cmd.m_meta.m_storage != StorageType::SPARSE)
+                {
+                    archetype = world.m_archetypeGraph.GetOrCreateAddTarget(*archetype, cmd.m_meta);
+                }
+            }
+            m_flushSpawns.PushBack(detail::PendingSpawn{archetype, s});
+        }
+
+        std::sort(m_flushSpawns.begin(), m_flushSpawns.end(),
+                  [](const detail::PendingSpawn& a, const detail::PendingSpawn& b) {
+                      return a.m_archetype != b.m_archetype ? a.m_archetype < b.m_archetype
+                                                            : a.m_spawnIndex < b.m_spawnIndex;
+                  });
+
+        size_t runBegin = 0;
+        while (runBegin < m_flushSpawns.Size())
+        {
+            size_t runEnd = runBegin + 1;
+            while (runEnd < m_flushSpawns.Size() &&
+                   m_flushSpawns[runEnd].m_archetype == m_flushSpawns[runBegin].m_archetype)
             {
-                cmd.m_meta.m_destruct(cmd.m_data);
+                ++runEnd;
             }
+
+            auto* archetype =
+                static_cast<Archetype<ComponentAllocator>*>(m_flushSpawns[runBegin].m_archetype);
+            const size_t runSize = runEnd - runBegin;
+
+            world.RegisterNewArchetype(archetype);
+
+            m_flushEntities.Resize(runSize);
+            const uint32_t firstRow = world.ReserveBatchRows(archetype, m_flushEntities.Data(), runSize);
+
+            const auto& metas = archetype->GetComponentMetas();
+            for (size_t r = 0; r < runSize; ++r)
+            {
+                const uint32_t spawnIndex = m_flushSpawns[runBegin + r].m_spawnIndex;
+                const Entity entity = m_flushEntities[r];
+                const uint32_t row = firstRow + static_cast<uint32_t>(r);
+                m_spawnedEntities[spawnIndex] = entity;
+
+                for (size_t c = 0; c < metas.Size(); ++c)
+                {
+                    // Last queued value wins, same as EntityBuilder::WithRaw
+                    void* src = nullptr;
+                    for (uint32_t k = m_flushRanges[spawnIndex]; k < m_flushRanges[spawnIndex + 1]; ++k)
+                    {
+                        const detail::Command& cmd = m_commands[static_cast<uint32_t>(m_flushKeys[k])];
+                        if (cmd.m_componentType == metas[c].m_typeId)
+                        {
+                            src = cmd.m_data;
+                        }
+                    }
+
+                    void* dst = archetype->GetComponentRaw(row, metas[c].m_typeId);
+                    if (src != nullptr && metas[c].m_move != nullptr)
+                    {
+                        metas[c].m_move(dst, src);
+                    }
+                    else
+                    {
+                        World::ConstructRaw(metas[c], dst, src);
+                    }
+                }
+
+                for (uint32_t k = m_flushRanges[spawnIndex]; k < m_flushRanges[spawnIndex + 1]; ++k)
+                {
+                    const detail::Command& cmd = m_commands[static_cast<uint32_t>(m_flushKeys[k])];
+                    if (cmd.m_meta.m_storage == StorageType::SPARSE)
+                    {
+                        world.SetSparseRaw(entity, cmd.m_meta, cmd.m_data);
+                    }
+                }
+            }
+
+            runBegin = runEnd;
+        }
+    }
+
+    template <comb::Allocator Allocator> void CommandBuffer<Allocator>::FlushEntityCommandsBatched(World& world)
+    {
+        // Commands on live entities, grouped by entity index in insertion order
+        m_flushKeys.Clear();
+        for (size_t i = 0; i < m_commands.Size(); ++i)
+        {
+            const detail::Command& cmd = m_commands[i];
+            if (cmd.m_type == CommandType::SPAWN ||
+                (cmd.m_type == CommandType::ADD_COMPONENT && IsPendingEntity(cmd.m_entity)))
+            {
+                continue;
+            }
+
+            const Entity entity = ResolveEntity(cmd.m_entity);
+            if (entity.IsNull() || !world.IsAlive(entity))
+            {
+                continue;
+            }
+
+            m_flushKeys.PushBack((static_cast<uint64_t>(entity.Index()) << 32) | static_cast<uint64_t>(i));
+        }
+        std::sort(m_flushKeys.begin(), m_flushKeys.end());
+
+        m_flushDespawns.Clear();
+
+        size_t groupBegin = 0;
+        while (groupBegin < m_flushKeys.Size())
+        {
+            size_t groupEnd = groupBegin + 1;
+            while (groupEnd < m_flushKeys.Size() && (m_flushKeys[groupEnd] >> 32) == (m_flushKeys[groupBegin] >> 32))
+            {
+                ++groupEnd;
+            }
+
+            const Entity entity = ResolveEntity(m_commands[static_cast<uint32_t>(m_flushKeys[groupBegin])].m_entity);
+            World::EntityRecord* record = world.m_entityLocations.Get(entity);
+            Archetype<ComponentAllocator>* source = record != nullptr ? record->m_archetype : nullptr;
+            Archetype<ComponentAllocator>* target = source;
+
+            m_flushWrites.Clear();
+            m_flushRemoved.Clear();
+            bool despawned = false;
+
+            for (size_t k = groupBegin; k < groupEnd && !despawned; ++k)
+            {
+                const uint32_t cmdIndex = static_cast<uint32_t>(m_flushKeys[k]);
+                const detail::Command& cmd = m_commands[cmdIndex];
+
+                switch (cmd.m_type)
+                {
+                    case CommandType::SPAWN:
+                        break;
+
+                    case CommandType::DESPAWN:
+                        despawned = true;
+                        break;
+
+                    case CommandType::ADD_COMPONENT:
+                    case CommandType::SET_COMPONENT: {
+                        if (cmd.m_meta.m_storage == StorageType::SPARSE)
+                        {
+                            world.SetSparseRaw(entity, cmd.m_meta, cmd.m_data);
+                            break;
+                        }
+
+                        if (target == nullptr)
+                        {
+                            break;
+                        }
+
+                        if (!target->HasComponent(cmd.m_componentType))
+                        {
+                            target = world.m_archetypeGraph.GetOrCreateAddTarget(*target, cmd.m_meta);
+                        }
+
+                        bool replaced = false;
+                        for (size_t w = 0; w < m_flushWrites.Size(); ++w)
+                        {
+                            if (m_commands[m_flushWrites[w]].m_componentType == cmd.m_componentType)
+                            {
+                                m_flushWrites[w] = cmdIndex;
+                                replaced = true;
+                                break;
+                            }
+                        }
+                        if (!replaced)
+                        {
+                            m_flushWrites.PushBack(cmdIndex);
+                        }
+                        break;
+                    }
+
+                    case CommandType::REMOVE_COMPONENT: {
+                        if (SparseStorage<ComponentAllocator>* storage =
+                                world.m_sparseStorages.Find(cmd.m_componentType))
+                        {
+                            if (storage->Remove(entity))
+                            {
+                                world.m_removalLog.RecordRemove(entity, cmd.m_componentType, world.m_currentTick);
+                                break;
+                            }
+                        }
+
+                        if (target == nullptr || !target->HasComponent(cmd.m_componentType))
+                        {
+                            break;
+                        }
+
+                        target = world.m_archetypeGraph.GetOrCreateRemoveTarget(*target, cmd.m_componentType);
+
+                        for (size_t w = 0; w < m_flushWrites.Size(); ++w)
+                        {
+                            if (m_commands[m_flushWrites[w]].m_componentType == cmd.m_componentType)
+                            {
+                                m_flushWrites[w] = m_flushWrites.Back();
+                                m_flushWrites.PopBack();
+                                break;
+                            }
+                        }
+                        m_flushRemoved.PushBack(cmd.m_componentType);
+                        world.m_removalLog.RecordRemove(entity, cmd.m_componentType, world.m_currentTick);
+                        break;
+                    }
+                }
+            }
+
+            if (despawned && record != nullptr)
+            {
+                m_flushDespawns.PushBack(detail::PendingDespawn{nullptr, 0, entity});
+            }
+            else if (!despawned && target != nullptr)
+            {
+                if (target != source)
+                {
+                    world.RegisterNewArchetype(target);
+                    world.MoveEntity(entity, *record, source, target);
+                }
+
+                for (size_t w = 0; w < m_flushWrites.Size(); ++w)
+                {
+                    const detail::Command& cmd = m_commands[m_flushWrites[w]];
+                    target->SetComponent(record->m_row, cmd.m_componentType, cmd.m_data);
+                }
+
+                // Removed then re-added without changing archetype: the component is new again
+                if (target == source)
+                {
+                    for (size_t r = 0; r < m_flushRemoved.Size(); ++r)
+                    {
+                        if (Column<ComponentAllocator>* column = target->GetColumn(m_flushRemoved[r]))
+                        {
+                            column->SetTicks(record->m_row, ComponentTicks{world.m_currentTick});
+                        }
+                    }
+                }
+            }
+
+            groupBegin = groupEnd;
         }
 
-        m_commands.Clear();
-        m_spawnCount = 0;
-        ClearBlocks();
+        world.DespawnBatched(m_flushDespawns.Data(), m_flushDespawns.Size());
     }
 } // namespace queen
 
@@ -1741,3 +3079,4 @@ namespace queen
 #include <queen/scheduler/parallel_scheduler_impl.h>
 #include <queen/scheduler/scheduler_impl.h>
 #include <queen/system/system_builder_impl.h>
+#include <queen/system/system_impl.h>
@@ -109,6 +109,7 @@ namespace queen
         size_t m_frameSize = 8 * 1024 * 1024;        // 8 MB — per-frame temporaries
         size_t m_threadFrameSize = 512 * 1024;       // 512 KB per worker thread
         size_t m_threadCount = 0;                    // 0 = auto-detect
+        size_t m_tableChunkBytes = 0;                // 0 = contiguous columns, else chunked tables (e.g. 16 KB)
     };
 
     /**
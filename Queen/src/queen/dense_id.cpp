@@ -0,0 +1,74 @@
+#include <hive/core/assert.h>
+
+#include <queen/core/dense_id.h>
+
+#include <mutex>
+
+namespace queen
+{
+    namespace
+    {
+        // Open addressing, kept at most half full. TypeId 0 marks an empty slot.
+        constexpr size_t kDenseIdSlots = kMaxDenseIds * 2;
+
+        struct DenseIdRegistry
+        {
+            std::mutex m_mutex;
+            TypeId m_keys[kDenseIdSlots]{};
+            DenseId m_values[kDenseIdSlots]{};
+            size_t m_count{0};
+        };
+
+        DenseIdRegistry& Registry() noexcept
+        {
+            static DenseIdRegistry s_registry;
+            return s_registry;
+        }
+
+        size_t FindSlot(const DenseIdRegistry& registry, TypeId typeId) noexcept
+        {
+            size_t slot = static_cast<size_t>(typeId) & (kDenseIdSlots - 1);
+            while (registry.m_keys[slot] != 0 && registry.m_keys[slot] != typeId)
+            {
+                slot = (slot + 1) & (kDenseIdSlots - 1);
+            }
+            return slot;
+        }
+    } // namespace
+
+    DenseId RegisterDenseId(TypeId typeId) noexcept
+    {
+        hive::Assert(typeId != 0, "Cannot assign a DenseId to TypeId 0");
+
+        DenseIdRegistry& registry = Registry();
+        std::lock_guard<std::mutex> lock{registry.m_mutex};
+
+        const size_t slot = FindSlot(registry, typeId);
+        if (registry.m_keys[slot] == typeId)
+        {
+            return registry.m_values[slot];
+        }
+
+        hive::Assert(registry.m_count < kMaxDenseIds, "DenseId registry full");
+        const DenseId id = static_cast<DenseId>(registry.m_count++);
+        registry.m_keys[slot] = typeId;
+        registry.m_values[slot] = id;
+        return id;
+    }
+
+    DenseId FindDenseId(TypeId typeId) noexcept
+    {
+        DenseIdRegistry& registry = Registry();
+        std::lock_guard<std::mutex> lock{registry.m_mutex};
+
+        const size_t slot = FindSlot(registry, typeId);
+        return registry.m_keys[slot] == typeId && typeId != 0 ? registry.m_values[slot] : kInvalidDenseId;
+    }
+
+    size_t DenseIdCount() noexcept
+    {
+        DenseIdRegistry& registry = Registry();
+        std::lock_guard<std::mutex> lock{registry.m_mutex};
+        return registry.m_count;
+    }
+} // namespace queen
@@ -206,4 +206,22 @@ namespace
         auto* back_to_empty = graph.GetOrCreateRemoveTarget<Position>(*back_to_a);
         larvae::AssertTrue(back_to_empty == empty);
     });
+
+    auto test14 = larvae::RegisterTest("QueenArchetypeGraph", "DenseIdEdges", []() {
+        comb::LinearAllocator alloc{262144};
+
+        queen::ArchetypeGraph<comb::LinearAllocator> graph{alloc};
+
+        auto* empty = graph.GetEmptyArchetype();
+        auto* with_pos = graph.GetOrCreateAddTarget<Position>(*empty);
+        auto* with_both = graph.GetOrCreateAddTarget<Velocity>(*with_pos);
+
+        larvae::AssertTrue(empty->GetAddEdgeByDenseId(queen::DenseIdOf<Position>()) == with_pos);
+        larvae::AssertTrue(with_both->GetRemoveEdgeByDenseId(queen::DenseIdOf<Velocity>()) == with_pos);
+        larvae::AssertNull(empty->GetAddEdgeByDenseId(queen::DenseIdOf<Health>()));
+
+        // TypeId-only removal resolves through the column and hits the same edge
+        larvae::AssertTrue(graph.GetOrCreateRemoveTarget(*with_both, queen::TypeIdOf<Velocity>()) == with_pos);
+        larvae::AssertTrue(graph.GetOrCreateRemoveTarget(*with_both, queen::TypeIdOf<Health>()) == with_both);
+    });
 } // namespace
@@ -654,4 +654,88 @@ namespace
 
         larvae::AssertEqual(found_entity.Index(), e2.Index());
     });
+
+    auto test46 = larvae::RegisterTest("QueenChangeDetection", "ChangedFilterVisitsOnlyDirtyRows", []() {
+        queen::World world{};
+
+        for (int i = 0; i < 500; ++i)
+        {
+            (void)world.Spawn(Position{static_cast<float>(i), 0.0f, 0.0f});
+        }
+
+        world.IncrementTick();
+        const queen::Tick lastRun = world.CurrentTick();
+        world.IncrementTick();
+
+        queen::Archetype<queen::ComponentAllocator>* archetype = nullptr;
+        world.ForEachArchetype([&](queen::Archetype<queen::ComponentAllocator>& arch) {
+            if (arch.HasComponent<Position>())
+                archetype = &arch;
+        });
+        larvae::AssertNotNull(archetype);
+
+        auto* column = archetype->GetColumn(queen::TypeIdOf<Position>());
+        column->MarkChanged(10, world.CurrentTick());
+        column->MarkChanged(400, world.CurrentTick());
+
+        auto query = world.Query<queen::Read<Position>, queen::Changed<Position>>();
+        query.SetLastRunTick(lastRun);
+
+        float sum = 0.0f;
+        int count = 0;
+        query.Each([&](const Position& pos) {
+            sum += pos.x;
+            ++count;
+        });
+
+        larvae::AssertEqual(count, 2);
+        larvae::AssertEqual(sum, 410.0f);
+
+        // Nothing newer than the current tick: the whole archetype is skipped
+        query.SetLastRunTick(world.CurrentTick());
+        count = 0;
+        query.Each([&](const Position&) { ++count; });
+        larvae::AssertEqual(count, 0);
+    });
+
+    auto test47 = larvae::RegisterTest("QueenChangeDetection", "ChangedFilterOnChunkedTables", []() {
+        queen::WorldAllocatorConfig config{};
+        config.m_tableChunkBytes = 4 * 1024;
+        queen::World world{config};
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            (void)world.Spawn(Position{static_cast<float>(i), 0.0f, 0.0f});
+        }
+
+        world.IncrementTick();
+        const queen::Tick lastRun = world.CurrentTick();
+        world.IncrementTick();
+
+        queen::Archetype<queen::ComponentAllocator>* archetype = nullptr;
+        world.ForEachArchetype([&](queen::Archetype<queen::ComponentAllocator>& arch) {
+            if (arch.HasComponent<Position>())
+                archetype = &arch;
+        });
+        larvae::AssertNotNull(archetype);
+        larvae::AssertTrue(archetype->GetTable().ChunkRows() != 0);
+
+        auto* column = archetype->GetColumn(queen::TypeIdOf<Position>());
+        column->MarkChanged(10, world.CurrentTick());
+        column->MarkChanged(400, world.CurrentTick());
+        column->MarkChanged(900, world.CurrentTick());
+
+        auto query = world.Query<queen::Read<Position>, queen::Changed<Position>>();
+        query.SetLastRunTick(lastRun);
+
+        float sum = 0.0f;
+        int count = 0;
+        query.EachWithEntity([&](queen::Entity, const Position& pos) {
+            sum += pos.x;
+            ++count;
+        });
+
+        larvae::AssertEqual(count, 3);
+        larvae::AssertEqual(sum, 1310.0f);
+    });
 } // namespace
@@ -273,4 +273,148 @@ namespace
         void* ptr = column.GetRaw(0);
         larvae::AssertEqual(reinterpret_cast<uintptr_t>(ptr) % 32, uintptr_t{0});
     });
+
+    auto test15 = larvae::RegisterTest("QueenColumn", "TickSummariesTrackNewest", []() {
+        comb::LinearAllocator alloc{65536};
+        queen::Column<comb::LinearAllocator> column{alloc, queen::ComponentMeta::Of<Position>(), 8};
+
+        Position pos{};
+        for (size_t i = 0; i < 200; ++i)
+        {
+            column.PushCopy(&pos, queen::Tick{1});
+        }
+
+        larvae::AssertEqual(column.BlockCount(), size_t{4});
+        larvae::AssertEqual(column.MaxTicks().m_added.m_value, uint32_t{1});
+
+        column.MarkChanged(130, queen::Tick{5});
+
+        larvae::AssertEqual(column.MaxTicks().m_changed.m_value, uint32_t{5});
+        larvae::AssertEqual(column.BlockTicks(2).m_changed.m_value, uint32_t{5});
+        larvae::AssertEqual(column.BlockTicks(0).m_changed.m_value, uint32_t{1});
+        larvae::AssertEqual(column.BlockTicks(3).m_changed.m_value, uint32_t{1});
+    });
+
+    auto test16 = larvae::RegisterTest("QueenColumn", "TickSummariesFollowSwapRemove", []() {
+        comb::LinearAllocator alloc{65536};
+        queen::Column<comb::LinearAllocator> column{alloc, queen::ComponentMeta::Of<Position>(), 8};
+
+        Position pos{};
+        for (size_t i = 0; i < 100; ++i)
+        {
+            column.PushCopy(&pos, queen::Tick{1});
+        }
+        column.MarkChanged(99, queen::Tick{9});
+
+        // Row 99 (block 1) moves into row 3 (block 0)
+        column.SwapRemove(3);
+
+        larvae::AssertEqual(column.GetTicks(3).m_changed.m_value, uint32_t{9});
+        larvae::AssertEqual(column.BlockTicks(0).m_changed.m_value, uint32_t{9});
+
+        column.Clear();
+        larvae::AssertEqual(column.MaxTicks().m_changed.m_value, uint32_t{0});
+    });
+
+    auto test17 = larvae::RegisterTest("QueenColumn", "ChunkedGrowthKeepsAddresses", []() {
+        comb::LinearAllocator alloc{65536};
+        queen::Column<comb::LinearAllocator> column{alloc, queen::ComponentMeta::Of<Position>(), 8, 6};
+
+        larvae::AssertTrue(column.IsChunked());
+        larvae::AssertEqual(column.ChunkRows(), size_t{64});
+        larvae::AssertEqual(column.ChunkCount(), size_t{1});
+
+        Position pos{0.0f, 0.0f, 0.0f};
+        column.PushCopy(&pos, queen::Tick{1});
+        Position* first = column.Get<Position>(0);
+
+        for (size_t i = 1; i < 300; ++i)
+        {
+            pos.x = static_cast<float>(i);
+            column.PushCopy(&pos, queen::Tick{1});
+        }
+
+        larvae::AssertEqual(column.ChunkCount(), size_t{5});
+        larvae::AssertTrue(column.Get<Position>(0) == first);
+        larvae::AssertEqual(column.Get<Position>(130)->x, 130.0f);
+        larvae::AssertEqual(column.ChunkEnd(130), size_t{192});
+
+        // Rows are contiguous inside a chunk
+        const Position* run = static_cast<const Position*>(column.GetRaw(128));
+        larvae::AssertEqual(run[5].x, 133.0f);
+
+        column.MarkChanged(200, queen::Tick{4});
+        larvae::AssertEqual(column.TicksAt(192)[8].m_changed.m_value, uint32_t{4});
+        larvae::AssertEqual(column.BlockTicks(3).m_changed.m_value, uint32_t{4});
+        larvae::AssertEqual(column.MaxTicks().m_changed.m_value, uint32_t{4});
+    });
+
+    auto test18 = larvae::RegisterTest("QueenColumn", "ChunkedSwapRemoveAcrossChunks", []() {
+        NonTrivial::ResetCounts();
+        {
+            comb::LinearAllocator alloc{65536};
+            queen::Column<comb::LinearAllocator> column{alloc, queen::ComponentMeta::Of<NonTrivial>(), 8, 6};
+
+            for (int i = 0; i < 150; ++i)
+            {
+                NonTrivial value{i};
+                column.PushCopy(&value, queen::Tick{1});
+            }
+            column.MarkChanged(149, queen::Tick{7});
+
+            column.SwapRemove(2);
+
+            larvae::AssertEqual(column.Size(), size_t{149});
+            larvae::AssertEqual(column.Get<NonTrivial>(2)->value, 149);
+            larvae::AssertEqual(column.GetTicks(2).m_changed.m_value, uint32_t{7});
+            larvae::AssertEqual(column.Get<NonTrivial>(148)->value, 148);
+        }
+        larvae::AssertEqual(NonTrivial::construct_count, NonTrivial::destruct_count);
+    });
+
+    auto test19 = larvae::RegisterTest("QueenColumn", "ShrinkToFitKeepsRows", []() {
+        NonTrivial::ResetCounts();
+        {
+            comb::LinearAllocator alloc{262144};
+            queen::Column<comb::LinearAllocator> column{alloc, queen::ComponentMeta::Of<NonTrivial>(), 8};
+            queen::Column<comb::LinearAllocator> chunked{alloc, queen::ComponentMeta::Of<NonTrivial>(), 8, 6};
+
+            for (int i = 0; i < 300; ++i)
+            {
+                NonTrivial value{i};
+                column.PushCopy(&value, queen::Tick{1});
+                chunked.PushCopy(&value, queen::Tick{1});
+            }
+            const NonTrivial* stable = chunked.Get<NonTrivial>(10);
+
+            while (column.Size() > 20)
+            {
+                column.Pop();
+                chunked.Pop();
+            }
+
+            larvae::AssertTrue(column.ShrinkToFit(32));
+            larvae::AssertEqual(column.Capacity(), size_t{32});
+            larvae::AssertFalse(column.ShrinkToFit(32));
+
+            larvae::AssertTrue(chunked.ShrinkToFit());
+            larvae::AssertEqual(chunked.ChunkCount(), size_t{1});
+            larvae::AssertTrue(chunked.Get<NonTrivial>(10) == stable);
+
+            for (int i = 0; i < 20; ++i)
+            {
+                larvae::AssertEqual(column.Get<NonTrivial>(static_cast<size_t>(i))->value, i);
+                larvae::AssertEqual(chunked.Get<NonTrivial>(static_cast<size_t>(i))->value, i);
+            }
+
+            column.Clear();
+            larvae::AssertTrue(column.ShrinkToFit());
+            larvae::AssertEqual(column.Capacity(), size_t{0});
+
+            NonTrivial value{7};
+            column.PushCopy(&value, queen::Tick{2});
+            larvae::AssertEqual(column.Get<NonTrivial>(0)->value, 7);
+        }
+        larvae::AssertEqual(NonTrivial::construct_count, NonTrivial::destruct_count);
+    });
 } // namespace
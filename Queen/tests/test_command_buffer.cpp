@@ -496,4 +496,124 @@ namespace
 
         larvae::AssertEqual(world.EntityCount(), size_t{100});
     });
+
+    // FlushBatched Tests
+
+    auto test29 = larvae::RegisterTest("QueenCommandBuffer", "FlushBatchedCollapsesEntityCommands", []() {
+        comb::LinearAllocator alloc{131072};
+
+        queen::World world{};
+        queen::Entity e = world.Spawn(Position{1.0f, 2.0f, 3.0f});
+
+        queen::CommandBuffer<comb::LinearAllocator> cmd{alloc};
+        cmd.Add(e, Velocity{1.0f, 0.0f, 0.0f});
+        cmd.Add(e, Health{50, 100});
+        cmd.Set(e, Velocity{2.0f, 0.0f, 0.0f});
+        cmd.Remove<Position>(e);
+        cmd.FlushBatched(world);
+
+        larvae::AssertFalse(world.Has<Position>(e));
+        larvae::AssertTrue(world.Has<Velocity>(e));
+        larvae::AssertTrue(world.Has<Health>(e));
+        larvae::AssertEqual(world.Get<Velocity>(e)->dx, 2.0f);
+        larvae::AssertEqual(world.Get<Health>(e)->current, 50);
+        larvae::AssertTrue(cmd.IsEmpty());
+    });
+
+    auto test30 = larvae::RegisterTest("QueenCommandBuffer", "FlushBatchedRemoveThenAdd", []() {
+        comb::LinearAllocator alloc{131072};
+
+        queen::World world{};
+        queen::Entity e = world.Spawn(Position{1.0f, 2.0f, 3.0f}, Velocity{0.0f, 0.0f, 0.0f});
+
+        queen::CommandBuffer<comb::LinearAllocator> cmd{alloc};
+        cmd.Add(e, Health{1, 1});
+        cmd.Remove<Health>(e);
+        cmd.Remove<Position>(e);
+        cmd.Add(e, Position{9.0f, 0.0f, 0.0f});
+        cmd.FlushBatched(world);
+
+        larvae::AssertFalse(world.Has<Health>(e));
+        larvae::AssertTrue(world.Has<Velocity>(e));
+        larvae::AssertEqual(world.Get<Position>(e)->x, 9.0f);
+    });
+
+    auto test31 = larvae::RegisterTest("QueenCommandBuffer", "FlushBatchedDespawnsKeepOthersIntact", []() {
+        comb::LinearAllocator alloc{262144};
+
+        queen::World world{};
+        queen::Entity entities[64];
+        for (int i = 0; i < 64; ++i)
+        {
+            entities[i] = world.Spawn(Position{static_cast<float>(i), 0.0f, 0.0f});
+        }
+
+        queen::CommandBuffer<comb::LinearAllocator> cmd{alloc};
+        for (int i = 0; i < 64; i += 3)
+        {
+            cmd.Add(entities[i], Velocity{1.0f, 0.0f, 0.0f});
+            cmd.Despawn(entities[i]);
+        }
+        cmd.Despawn(entities[1]);
+        cmd.FlushBatched(world);
+
+        for (int i = 0; i < 64; ++i)
+        {
+            const bool despawned = (i % 3) == 0 || i == 1;
+            larvae::AssertEqual(world.IsAlive(entities[i]), !despawned);
+            if (!despawned)
+            {
+                larvae::AssertEqual(world.Get<Position>(entities[i])->x, static_cast<float>(i));
+            }
+        }
+        larvae::AssertEqual(world.EntityCount(), size_t{64 - 22 - 1});
+    });
+
+    auto test32 = larvae::RegisterTest("QueenCommandBuffer", "FlushBatchedSpawnsPerArchetype", []() {
+        comb::LinearAllocator alloc{262144};
+
+        queen::World world{};
+        queen::CommandBuffer<comb::LinearAllocator> cmd{alloc};
+
+        for (int i = 0; i < 20; ++i)
+        {
+            auto builder = cmd.Spawn();
+            builder.With(Position{static_cast<float>(i), 0.0f, 0.0f});
+            if (i % 2 == 0)
+            {
+                builder.With(Velocity{static_cast<float>(i), 0.0f, 0.0f});
+            }
+        }
+        (void)cmd.Spawn();
+
+        cmd.FlushBatched(world);
+
+        larvae::AssertEqual(world.EntityCount(), size_t{21});
+        for (uint32_t i = 0; i < 20; ++i)
+        {
+            queen::Entity e = cmd.GetSpawnedEntity(i);
+            larvae::AssertTrue(world.IsAlive(e));
+            larvae::AssertEqual(world.Get<Position>(e)->x, static_cast<float>(i));
+            larvae::AssertEqual(world.Has<Velocity>(e), i % 2 == 0);
+        }
+        larvae::AssertTrue(world.IsAlive(cmd.GetSpawnedEntity(20)));
+    });
+
+    auto test33 = larvae::RegisterTest("QueenCommandBuffer", "FlushBatchedSpawnLastValueWins", []() {
+        comb::LinearAllocator alloc{131072};
+
+        queen::World world{};
+        queen::CommandBuffer<comb::LinearAllocator> cmd{alloc};
+
+        auto builder = cmd.Spawn();
+        builder.With(Position{1.0f, 0.0f, 0.0f});
+        builder.With(Health{7, 10});
+        builder.With(Position{2.0f, 0.0f, 0.0f});
+
+        cmd.FlushBatched(world);
+
+        queen::Entity e = cmd.GetSpawnedEntity(builder.GetSpawnIndex());
+        larvae::AssertEqual(world.Get<Position>(e)->x, 2.0f);
+        larvae::AssertEqual(world.Get<Health>(e)->current, 7);
+    });
 } // namespace
@@ -226,4 +226,28 @@ namespace
         larvae::AssertEqual(result.Size(), size_t{1});
         larvae::AssertTrue(result[0] == arch_pos_vel);
     });
+
+    auto test12 = larvae::RegisterTest("QueenComponentIndex", "FindRarest", []() {
+        comb::LinearAllocator alloc{262144};
+
+        queen::ArchetypeGraph<comb::LinearAllocator> graph{alloc};
+        queen::ComponentIndex<comb::LinearAllocator> index{alloc};
+
+        auto* empty = graph.GetEmptyArchetype();
+        auto* arch_pos = graph.GetOrCreateAddTarget<Position>(*empty);
+        auto* arch_pos_vel = graph.GetOrCreateAddTarget<Velocity>(*arch_pos);
+        auto* arch_pos_health = graph.GetOrCreateAddTarget<Health>(*arch_pos);
+
+        index.RegisterArchetype(arch_pos);
+        index.RegisterArchetype(arch_pos_vel);
+        index.RegisterArchetype(arch_pos_health);
+
+        queen::TypeId types[] = {queen::TypeIdOf<Position>(), queen::TypeIdOf<Velocity>()};
+        const auto* rarest = index.FindRarest(types, 2);
+        larvae::AssertTrue(rarest == index.GetArchetypesWith<Velocity>());
+
+        queen::TypeId missing[] = {queen::TypeIdOf<Position>(), queen::TypeIdOf<Tag>()};
+        larvae::AssertNull(index.FindRarest(missing, 2));
+        larvae::AssertNull(index.FindRarest(types, 0));
+    });
 } // namespace
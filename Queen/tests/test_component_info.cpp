@@ -47,6 +47,22 @@ namespace
         }
     };
 
+    struct RelocatableHandle
+    {
+        static constexpr bool trivially_relocatable = true;
+        int* data;
+
+        RelocatableHandle()
+            : data{nullptr}
+        {
+        }
+        RelocatableHandle(RelocatableHandle&& other) noexcept
+            : data{other.data}
+        {
+            other.data = nullptr;
+        }
+    };
+
     auto test1 = larvae::RegisterTest("QueenComponentInfo", "StaticTypeInfo", []() {
         using Info = queen::ComponentInfo<Position>;
 
@@ -169,4 +185,51 @@ namespace
         larvae::AssertEqual(meta.m_typeId, queen::TypeId{0});
         larvae::AssertEqual(meta.m_size, size_t{0});
     });
+
+    auto test14 = larvae::RegisterTest("QueenComponentMeta", "DenseIdsAreSmallAndStable", []() {
+        const queen::DenseId pos = queen::DenseIdOf<Position>();
+        const queen::DenseId vel = queen::DenseIdOf<Velocity>();
+
+        larvae::AssertTrue(pos != vel);
+        larvae::AssertTrue(pos < queen::DenseIdCount());
+        larvae::AssertTrue(vel < queen::DenseIdCount());
+        larvae::AssertEqual(queen::DenseIdOf<Position>(), pos);
+        larvae::AssertEqual(queen::FindDenseId(queen::TypeIdOf<Position>()), pos);
+        larvae::AssertEqual(queen::RegisterDenseId(queen::TypeIdOf<Position>()), pos);
+
+        larvae::AssertEqual(queen::ComponentMeta::Of<Position>().m_denseId, pos);
+        larvae::AssertEqual(queen::ComponentMeta::OfTag<Player>().m_denseId, queen::DenseIdOf<Player>());
+    });
+
+    auto test15 = larvae::RegisterTest("QueenComponentMeta", "ResolveDenseIdForHandBuiltMeta", []() {
+        struct HandBuilt
+        {
+            int value;
+        };
+
+        queen::ComponentMeta meta{};
+        meta.m_typeId = queen::TypeIdOf<HandBuilt>();
+        meta.m_size = sizeof(HandBuilt);
+        meta.m_alignment = alignof(HandBuilt);
+
+        larvae::AssertEqual(meta.m_denseId, queen::kInvalidDenseId);
+        const queen::DenseId resolved = meta.ResolveDenseId();
+        larvae::AssertTrue(resolved != queen::kInvalidDenseId);
+        larvae::AssertEqual(queen::DenseIdOf<HandBuilt>(), resolved);
+    });
+
+    auto test16 = larvae::RegisterTest("QueenComponentMeta", "TriviallyRelocatableFlag", []() {
+        larvae::AssertTrue(queen::ComponentMeta::Of<Position>().IsTriviallyRelocatable());
+        larvae::AssertFalse(queen::ComponentMeta::Of<NonTrivial>().IsTriviallyRelocatable());
+        larvae::AssertTrue(queen::ComponentMeta::Of<RelocatableHandle>().IsTriviallyRelocatable());
+        larvae::AssertFalse(queen::ComponentMeta{}.IsTriviallyRelocatable());
+
+        int value = 3;
+        RelocatableHandle src{};
+        src.data = &value;
+        alignas(RelocatableHandle) unsigned char dst[sizeof(RelocatableHandle)];
+
+        queen::ComponentMeta::Of<RelocatableHandle>().MoveConstruct(dst, &src);
+        larvae::AssertTrue(reinterpret_cast<RelocatableHandle*>(dst)->data == &value);
+    });
 } // namespace
@@ -482,4 +482,30 @@ namespace
         }
     });
 
+    auto test32 = larvae::RegisterTest("QueenComponentMask", "MatchesSignature", []() {
+        comb::LinearAllocator alloc{4096};
+        ComponentMask<comb::LinearAllocator> signature{alloc};
+        ComponentMask<comb::LinearAllocator> required{alloc};
+        ComponentMask<comb::LinearAllocator> excluded{alloc};
+
+        signature.Set(3);
+        signature.Set(70);
+
+        larvae::AssertTrue(signature.MatchesSignature(required, excluded));
+
+        required.Set(3);
+        required.Set(70);
+        larvae::AssertTrue(signature.MatchesSignature(required, excluded));
+
+        excluded.Set(5);
+        excluded.Set(200);
+        larvae::AssertTrue(signature.MatchesSignature(required, excluded));
+
+        excluded.Set(70);
+        larvae::AssertFalse(signature.MatchesSignature(required, excluded));
+
+        excluded.Clear(70);
+        required.Set(130);
+        larvae::AssertFalse(signature.MatchesSignature(required, excluded));
+    });
 } // namespace
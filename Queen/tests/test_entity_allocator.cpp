@@ -177,4 +177,50 @@ namespace
 
         larvae::AssertEqual(allocator.FreeListSize(), size_t{1});
     });
+
+    auto test12 = larvae::RegisterTest("QueenEntityAllocator", "AllocateBatchRecyclesThenExtends", []() {
+        comb::LinearAllocator alloc{16384};
+        queen::EntityAllocator<comb::LinearAllocator> allocator{alloc, 4};
+
+        queen::Entity first = allocator.Allocate();
+        static_cast<void>(allocator.Allocate());
+        allocator.Deallocate(first);
+
+        queen::Entity batch[5];
+        allocator.AllocateBatch(batch, 5);
+
+        larvae::AssertEqual(batch[0].Index(), first.Index());
+        larvae::AssertEqual(batch[0].Generation(), static_cast<queen::Entity::GenerationType>(first.Generation() + 1));
+        for (size_t i = 1; i < 5; ++i)
+        {
+            larvae::AssertEqual(batch[i].Index(), static_cast<uint32_t>(i + 1));
+            larvae::AssertTrue(allocator.IsAlive(batch[i]));
+        }
+        larvae::AssertEqual(allocator.AliveCount(), size_t{6});
+    });
+
+    auto test13 = larvae::RegisterTest("QueenEntityAllocator", "ReleaseAllKeepsHandlesDead", []() {
+        comb::LinearAllocator alloc{16384};
+        queen::EntityAllocator<comb::LinearAllocator> allocator{alloc, 8};
+
+        queen::Entity a = allocator.Allocate();
+        queen::Entity b = allocator.Allocate();
+        allocator.Deallocate(b);
+
+        allocator.ReleaseAll();
+
+        larvae::AssertEqual(allocator.AliveCount(), size_t{0});
+        larvae::AssertFalse(allocator.IsAlive(a));
+
+        queen::Entity reused = allocator.Allocate();
+        larvae::AssertEqual(reused.Index(), uint32_t{0});
+        larvae::AssertTrue(allocator.IsAlive(reused));
+        larvae::AssertTrue(reused != a);
+
+        queen::Entity batch[2];
+        allocator.AllocateBatch(batch, 2);
+        larvae::AssertEqual(batch[0].Index(), uint32_t{1});
+        larvae::AssertEqual(batch[0].Generation(), static_cast<queen::Entity::GenerationType>(b.Generation() + 2));
+        larvae::AssertEqual(batch[1].Index(), uint32_t{2});
+    });
 } // namespace
@@ -1,6 +1,8 @@
 
 #include <comb/buddy_allocator.h>
 
+#include <drone/worker_context.h>
+
 #include <queen/event/event.h>
 #include <queen/event/event_queue.h>
 #include <queen/event/event_reader.h>
@@ -400,4 +402,39 @@ namespace
             larvae::AssertEqual(reader.TotalCount(), size_t{0});
         }
     });
+
+    auto test_events_8 = larvae::RegisterTest("QueenEvent", "ParallelWritesMergeInWorkerOrder", []() {
+        comb::BuddyAllocator alloc{1024 * 1024};
+        queen::Events<comb::BuddyAllocator> events{alloc};
+        events.Send(DamageEvent{0, 0, 0.0f});
+
+        events.BeginParallelWrites(2);
+
+        drone::WorkerContext::SetCurrentWorkerIndex(1);
+        events.Send(DamageEvent{3, 0, 0.0f});
+        drone::WorkerContext::SetCurrentWorkerIndex(0);
+        events.Send(DamageEvent{2, 0, 0.0f});
+        events.Send(DamageEvent{2, 1, 0.0f});
+        drone::WorkerContext::ClearCurrentWorkerIndex();
+        events.Send(DamageEvent{1, 0, 0.0f});
+
+        // Staged events stay invisible until the sync point
+        auto reader = events.Reader<DamageEvent>();
+        larvae::AssertEqual(reader.TotalCount(), size_t{1});
+
+        events.EndParallelWrites();
+        larvae::AssertEqual(reader.TotalCount(), size_t{5});
+
+        uint32_t expected[] = {0, 1, 2, 2, 3};
+        size_t index = 0;
+        reader.Read([&](const DamageEvent& event) {
+            larvae::AssertEqual(event.target_id, expected[index]);
+            ++index;
+        });
+        larvae::AssertEqual(index, size_t{5});
+
+        // Writes go straight to the current buffer again
+        events.Send(DamageEvent{4, 0, 0.0f});
+        larvae::AssertEqual(reader.TotalCount(), size_t{6});
+    });
 } // namespace
@@ -29,6 +29,12 @@ namespace
         float dx, dy, dz;
     };
 
+    struct Marker
+    {
+        static constexpr queen::StorageType storage = queen::StorageType::SPARSE;
+        int value;
+    };
+
     // Observer Event Type Tests
 
     auto test_observer_1 = larvae::RegisterTest("QueenObserver", "OnAddTriggerTypeDetection", []() {
@@ -694,4 +700,90 @@ namespace
 
         larvae::AssertEqual(call_count, 2);
     });
+
+    auto test_with_sparse_filter = larvae::RegisterTest("QueenObserver", "WithSparseFilter", []() {
+        queen::World world{};
+        int call_count = 0;
+
+        world.Observer<queen::OnAdd<Health>>("SparseFiltered")
+            .With<Marker>()
+            .Each([&call_count](queen::Entity, const Health&) { ++call_count; });
+
+        auto e1 = world.Spawn(Position{0.0f, 0.0f, 0.0f});
+        auto e2 = world.Spawn(Position{0.0f, 0.0f, 0.0f});
+        world.Add(e2, Marker{1});
+
+        // Same archetype, only the entity with the sparse marker passes
+        world.Add(e1, Health{1.0f, 1.0f});
+        world.Add(e2, Health{1.0f, 1.0f});
+        larvae::AssertEqual(call_count, 1);
+    });
+
+    auto test_deferred_batches = larvae::RegisterTest("QueenObserver", "DeferredBatchesByArchetype", []() {
+        queen::World world{};
+        int calls = 0;
+        size_t received = 0;
+        size_t largest = 0;
+
+        world.Observer<queen::OnAdd<Health>>("Batched")
+            .EachBatch([&](queen::World& w, wax::Span<const queen::Entity> entities) {
+                ++calls;
+                received += entities.Size();
+                largest = entities.Size() > largest ? entities.Size() : largest;
+                for (size_t i = 0; i < entities.Size(); ++i)
+                {
+                    larvae::AssertTrue(w.Has<Health>(entities[i]));
+                }
+            });
+
+        for (int i = 0; i < 4; ++i)
+        {
+            auto moving = world.Spawn(Position{0.0f, 0.0f, 0.0f}, Velocity{0.0f, 0.0f, 0.0f});
+            auto still = world.Spawn(Position{0.0f, 0.0f, 0.0f});
+            world.Add(moving, Health{1.0f, 1.0f});
+            world.Add(still, Health{1.0f, 1.0f});
+        }
+
+        larvae::AssertEqual(calls, 0);
+        larvae::AssertEqual(world.GetObserverStorage().PendingCount(), size_t{8});
+
+        world.FlushObservers();
+        larvae::AssertEqual(calls, 2);
+        larvae::AssertEqual(received, size_t{8});
+        larvae::AssertEqual(largest, size_t{4});
+        larvae::AssertEqual(world.GetObserverStorage().PendingCount(), size_t{0});
+
+        // Update dispatches on its own
+        world.Add(world.Spawn(Position{0.0f, 0.0f, 0.0f}), Health{1.0f, 1.0f});
+        world.Update();
+        larvae::AssertEqual(calls, 3);
+        larvae::AssertEqual(received, size_t{9});
+    });
+
+    auto test_filter_cache_reset = larvae::RegisterTest("QueenObserver", "FilterCacheResetOnRetire", []() {
+        queen::World world{};
+        int call_count = 0;
+
+        queen::ObserverId id = world.Observer<queen::OnAdd<Health>>("Filtered")
+                                   .With<Position>()
+                                   .Each([&call_count](queen::Entity, const Health&) { ++call_count; });
+
+        auto entity = world.Spawn(Position{1.0f, 2.0f, 3.0f});
+        world.Add(entity, Health{100.0f, 100.0f});
+        larvae::AssertEqual(call_count, 1);
+
+        const queen::Observer<queen::PersistentAllocator>* observer = world.GetObserverStorage().GetObserver(id);
+        const void* archetype = world.GetEntityLocations().Get(entity)->m_archetype;
+        bool cached = false;
+        larvae::AssertTrue(observer->FindCachedFilterResult(archetype, cached));
+
+        world.Despawn(entity);
+        const queen::CompactStats stats = world.Compact(queen::CompactPolicy{1.0f, 0, true});
+        larvae::AssertTrue(stats.m_archetypesRetired > 0);
+        larvae::AssertFalse(observer->FindCachedFilterResult(archetype, cached));
+
+        entity = world.Spawn(Position{0.0f, 0.0f, 0.0f});
+        world.Add(entity, Health{50.0f, 100.0f});
+        larvae::AssertEqual(call_count, 2);
+    });
 } // namespace
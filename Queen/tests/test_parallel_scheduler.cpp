@@ -312,4 +312,116 @@ namespace
         const auto& graph = scheduler.Graph();
         larvae::AssertEqual(graph.NodeCount(), size_t{2});
     });
+
+    auto test13 = larvae::RegisterTest("QueenParallelScheduler", "RunMoreThan256Systems", []() {
+        comb::LinearAllocator alloc{64 * 1024 * 1024};
+        TestJobSystem js;
+        queen::ParallelScheduler<comb::LinearAllocator> scheduler{alloc, js.m_submitter};
+        queen::World world{};
+        queen::SystemStorage<comb::LinearAllocator> storage{alloc};
+
+        constexpr int kNumSystems = 600;
+        std::atomic<int> counter{0};
+
+        for (int i = 0; i < kNumSystems; ++i)
+        {
+            storage.Register(("System" + std::to_string(i)).c_str(),
+                             [&counter](queen::World&) { counter.fetch_add(1); },
+                             queen::AccessDescriptor<comb::LinearAllocator>{alloc});
+        }
+
+        scheduler.Build(storage);
+        scheduler.RunAll(world, storage);
+        scheduler.RunAll(world, storage);
+
+        larvae::AssertEqual(counter.load(), kNumSystems * 2);
+    });
+
+    auto test14 = larvae::RegisterTest("QueenParallelScheduler", "SystemNodeMovingAverage", []() {
+        queen::SystemNode node{};
+        larvae::AssertEqual(node.AverageNanos(), int64_t{0});
+
+        node.RecordExecution(800);
+        larvae::AssertEqual(node.AverageNanos(), int64_t{800});
+
+        node.RecordExecution(1600);
+        larvae::AssertEqual(node.AverageNanos(), int64_t{900});
+
+        node.Reset();
+        larvae::AssertEqual(node.AverageNanos(), int64_t{900});
+    });
+
+    auto test15 = larvae::RegisterTest("QueenParallelScheduler", "CriticalPathOrdersRootsAndPriorities", []() {
+        comb::LinearAllocator alloc{8 * 1024 * 1024};
+        TestJobSystem js;
+        queen::ParallelScheduler<comb::LinearAllocator> scheduler{alloc, js.m_submitter};
+        queen::SystemStorage<comb::LinearAllocator> storage{alloc};
+
+        // Short: independent. Head -> Tail: chain through Position.
+        storage.Register("Short", [](queen::World&) {}, queen::AccessDescriptor<comb::LinearAllocator>{alloc});
+        {
+            queen::AccessDescriptor<comb::LinearAllocator> access{alloc};
+            access.AddComponentWrite<Position>();
+            storage.Register("Head", [](queen::World&) {}, std::move(access));
+        }
+        {
+            queen::AccessDescriptor<comb::LinearAllocator> access{alloc};
+            access.AddComponentRead<Position>();
+            storage.Register("Tail", [](queen::World&) {}, std::move(access));
+        }
+
+        scheduler.Build(storage);
+
+        auto& graph = scheduler.Graph();
+        larvae::AssertEqual(graph.Roots().Size(), size_t{2});
+        larvae::AssertEqual(graph.Roots()[0], uint32_t{0});
+        larvae::AssertTrue(scheduler.PriorityOf(0) == drone::Priority::HIGH);
+
+        graph.GetNode(0)->SetAverageNanos(100);
+        graph.GetNode(1)->SetAverageNanos(400);
+        graph.GetNode(2)->SetAverageNanos(600);
+        graph.UpdateCriticalPaths();
+
+        larvae::AssertEqual(graph.GetNode(2)->CriticalPathNanos(), int64_t{600});
+        larvae::AssertEqual(graph.GetNode(1)->CriticalPathNanos(), int64_t{1000});
+        larvae::AssertEqual(graph.GetNode(0)->CriticalPathNanos(), int64_t{100});
+        larvae::AssertEqual(graph.MaxCriticalPath(), int64_t{1000});
+
+        larvae::AssertEqual(graph.Roots()[0], uint32_t{1});
+        larvae::AssertEqual(graph.Roots()[1], uint32_t{0});
+
+        larvae::AssertTrue(scheduler.PriorityOf(1) == drone::Priority::HIGH);
+        larvae::AssertTrue(scheduler.PriorityOf(2) == drone::Priority::HIGH);
+        larvae::AssertTrue(scheduler.PriorityOf(0) == drone::Priority::NORMAL);
+    });
+
+    auto test16 = larvae::RegisterTest("QueenParallelScheduler", "TimingsRecordedAndKeptAcrossRebuild", []() {
+        comb::LinearAllocator alloc{8 * 1024 * 1024};
+        TestJobSystem js;
+        queen::ParallelScheduler<comb::LinearAllocator> scheduler{alloc, js.m_submitter};
+        queen::World world{};
+        queen::SystemStorage<comb::LinearAllocator> storage{alloc};
+
+        storage.Register(
+            "Busy",
+            [](queen::World&) {
+                std::atomic<int> sink{0};
+                for (int i = 0; i < 10000; ++i)
+                {
+                    sink.fetch_add(i, std::memory_order_relaxed);
+                }
+            },
+            queen::AccessDescriptor<comb::LinearAllocator>{alloc});
+
+        scheduler.Build(storage);
+        scheduler.RunAll(world, storage);
+
+        const int64_t measured = scheduler.Graph().GetNode(0)->AverageNanos();
+        larvae::AssertTrue(measured > 0);
+        larvae::AssertEqual(scheduler.Graph().MaxCriticalPath(), measured);
+
+        scheduler.Invalidate();
+        scheduler.Build(storage);
+        larvae::AssertEqual(scheduler.Graph().GetNode(0)->AverageNanos(), measured);
+    });
 } // namespace
@@ -340,4 +340,157 @@ namespace
         world.Despawn(e1);
         world.Despawn(e2);
     });
+
+    // EachChunk tests
+
+    auto test17 = larvae::RegisterTest("QueenQuery", "EachChunkSpans", []() {
+        queen::World world{};
+
+        for (int i = 0; i < 10; ++i)
+        {
+            (void)world.Spawn(Position{static_cast<float>(i), 0, 0}, Velocity{1, 0, 0});
+        }
+        for (int i = 0; i < 5; ++i)
+        {
+            (void)world.Spawn(Position{0, 0, 0}, Velocity{2, 0, 0}, Health{1, 1});
+        }
+        (void)world.Spawn(Position{0, 0, 0});
+
+        size_t chunks = 0;
+        size_t rows = 0;
+        world.Query<queen::Read<Velocity>, queen::Write<Position>, queen::Maybe<Health>>().EachChunk(
+            [&](const queen::QueryChunk<queen::ComponentAllocator>& chunk, wax::Span<const Velocity> vel,
+                wax::Span<Position> pos, wax::Span<const Health> health) {
+                larvae::AssertEqual(vel.Size(), chunk.Size());
+                larvae::AssertEqual(pos.Size(), chunk.Size());
+                larvae::AssertEqual(chunk.Entities().Size(), chunk.Size());
+                larvae::AssertTrue(health.IsEmpty() || health.Size() == chunk.Size());
+                for (size_t i = 0; i < chunk.Size(); ++i)
+                {
+                    pos[i].y += vel[i].dx;
+                }
+                ++chunks;
+                rows += chunk.Size();
+            });
+
+        larvae::AssertEqual(chunks, size_t{2});
+        larvae::AssertEqual(rows, size_t{15});
+
+        float sum = 0.0f;
+        world.Query<queen::Read<Position>>().Each([&](const Position& pos) { sum += pos.y; });
+        larvae::AssertEqual(sum, 20.0f);
+    });
+
+    auto test18 = larvae::RegisterTest("QueenQuery", "EachChunkChunkedTables", []() {
+        queen::WorldAllocatorConfig config{};
+        config.m_tableChunkBytes = 4 * 1024;
+        queen::World world{config};
+
+        queen::Entity entities[1000];
+        world.SpawnBatch<Position>(
+            1000, [](size_t i, Position& pos) { pos.x = static_cast<float>(i); }, entities);
+
+        size_t chunks = 0;
+        bool entitiesMatch = true;
+        world.Query<queen::Read<Position>>().EachChunk(
+            [&](const queen::QueryChunk<queen::ComponentAllocator>& chunk, wax::Span<const Position> pos) {
+                for (size_t i = 0; i < chunk.Size(); ++i)
+                {
+                    const size_t index = static_cast<size_t>(pos[i].x);
+                    entitiesMatch = entitiesMatch && chunk.Entities()[i] == entities[index];
+                }
+                ++chunks;
+            });
+
+        larvae::AssertTrue(chunks > 1);
+        larvae::AssertTrue(entitiesMatch);
+    });
+
+    auto test19 = larvae::RegisterTest("QueenQuery", "EachChunkChangedSkipsCleanBlocks", []() {
+        queen::World world{};
+
+        queen::Entity entities[500];
+        world.SpawnBatch<Position>(500, [](size_t, Position&) {}, entities);
+
+        world.IncrementTick();
+        const queen::Tick lastRun = world.CurrentTick();
+        world.IncrementTick();
+
+        world.Query<queen::Read<Position>>().EachChunk(
+            [&](const queen::QueryChunk<queen::ComponentAllocator>& chunk, wax::Span<const Position>) {
+                if (chunk.Begin() == 0)
+                {
+                    chunk.MarkChanged<Position>(world.CurrentTick());
+                }
+            });
+
+        auto query = world.Query<queen::Read<Position>, queen::Changed<Position>>();
+        query.SetLastRunTick(lastRun);
+
+        size_t rows = 0;
+        size_t changed = 0;
+        query.EachChunk([&](const queen::QueryChunk<queen::ComponentAllocator>& chunk, wax::Span<const Position>) {
+            rows += chunk.Size();
+            wax::Span<const queen::ComponentTicks> ticks = chunk.Ticks<Position>();
+            for (size_t i = 0; i < ticks.Size(); ++i)
+            {
+                if (ticks[i].m_changed.IsNewerThan(lastRun))
+                {
+                    ++changed;
+                }
+            }
+        });
+
+        larvae::AssertEqual(rows, size_t{500});
+        larvae::AssertEqual(changed, size_t{500});
+
+        world.IncrementTick();
+        const queen::Tick secondRun = world.CurrentTick();
+        world.IncrementTick();
+        world.Query<queen::Read<Position>>().EachChunk(
+            [&](const queen::QueryChunk<queen::ComponentAllocator>& chunk, wax::Span<const Position>) {
+                chunk.GetArchetype()->GetColumn(queen::TypeIdOf<Position>())->MarkChanged(300, world.CurrentTick());
+            });
+
+        query.SetLastRunTick(secondRun);
+        rows = 0;
+        query.EachChunk([&](const queen::QueryChunk<queen::ComponentAllocator>& chunk, wax::Span<const Position>) {
+            larvae::AssertEqual(chunk.Begin(), size_t{256});
+            rows += chunk.Size();
+        });
+        larvae::AssertEqual(rows, size_t{64});
+    });
+
+    auto test20 = larvae::RegisterTest("QueenQuery", "EachInRowsWrapsAcrossArchetypes", []() {
+        queen::World world{};
+        for (int i = 0; i < 3; ++i)
+        {
+            (void)world.Spawn(Position{static_cast<float>(i), 0.f, 0.f});
+        }
+        for (int i = 3; i < 6; ++i)
+        {
+            (void)world.Spawn(Position{static_cast<float>(i), 0.f, 0.f}, Velocity{0.f, 0.f, 0.f});
+        }
+
+        auto query = world.Query<queen::Read<Position>>();
+        larvae::AssertEqual(query.EntityCount(), size_t{6});
+
+        int visited = 0;
+        float sum = 0.f;
+        query.EachInRows(4, 4, [&](const Position& pos) {
+            ++visited;
+            sum += pos.x;
+        });
+        larvae::AssertEqual(visited, 4);
+        larvae::AssertEqual(sum, 10.f);
+
+        visited = 0;
+        sum = 0.f;
+        query.EachWithEntityInRows(2, 2, [&](queen::Entity, const Position& pos) {
+            ++visited;
+            sum += pos.x;
+        });
+        larvae::AssertEqual(visited, 2);
+        larvae::AssertEqual(sum, 5.f);
+    });
 } // namespace
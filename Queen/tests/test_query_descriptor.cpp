@@ -5,6 +5,8 @@
 
 #include <larvae/larvae.h>
 
+#include <utility>
+
 namespace
 {
     struct Position
@@ -28,6 +30,15 @@ namespace
     struct Dead
     {
     };
+    template <int N> struct Variant
+    {
+    };
+
+    template <int... Ns> void SpawnVariants(queen::World& world, std::integer_sequence<int, Ns...>)
+    {
+        ((void)world.Spawn(Position{0, 0, 0}, Variant<Ns>{}), ...);
+        ((Ns % 2 == 0 ? (void)world.Spawn(Position{0, 0, 0}, Velocity{1, 0, 0}, Variant<Ns>{}) : (void)0), ...);
+    }
 
     // QueryDescriptor basic construction
 
@@ -334,4 +345,48 @@ namespace
 
         larvae::AssertEqual(desc.RequiredCount(), size_t{2});
     });
+
+    // Signature masks
+
+    auto test17 = larvae::RegisterTest("QueenQueryDescriptor", "MasksUseDenseIds", []() {
+        queen::PersistentAllocator alloc{65536};
+
+        auto desc = queen::QueryDescriptor<queen::PersistentAllocator>::FromTerms<
+            queen::Read<Position>, queen::Write<Velocity>, queen::Without<Dead>, queen::Maybe<Health>>(alloc);
+
+        larvae::AssertTrue(desc.GetRequiredMask().Test(queen::DenseIdOf<Position>()));
+        larvae::AssertTrue(desc.GetRequiredMask().Test(queen::DenseIdOf<Velocity>()));
+        larvae::AssertEqual(desc.GetRequiredMask().Count(), size_t{2});
+        larvae::AssertTrue(desc.GetExcludedMask().Test(queen::DenseIdOf<Dead>()));
+        larvae::AssertEqual(desc.GetExcludedMask().Count(), size_t{1});
+    });
+
+    auto test18 = larvae::RegisterTest("QueenQueryDescriptor", "FindMatchingAcrossManyArchetypes", []() {
+        queen::PersistentAllocator alloc{524288};
+
+        queen::World world{};
+        SpawnVariants(world, std::make_integer_sequence<int, 80>{});
+
+        auto desc = queen::QueryDescriptor<queen::PersistentAllocator>::FromTerms<
+            queen::Read<Position>, queen::Read<Velocity>, queen::Without<Variant<4>>, queen::Without<Variant<78>>>(
+            alloc);
+
+        auto matching = desc.FindMatchingArchetypes(world.GetComponentIndex());
+
+        larvae::AssertEqual(matching.Size(), size_t{38});
+        for (size_t i = 0; i < matching.Size(); ++i)
+        {
+            larvae::AssertTrue(matching[i]->HasComponent<Velocity>());
+            larvae::AssertFalse(matching[i]->HasComponent<Variant<4>>());
+            larvae::AssertFalse(matching[i]->HasComponent<Variant<78>>());
+        }
+
+        size_t viaQuery = 0;
+        world.Query<queen::Read<Position>, queen::Read<Velocity>, queen::Without<Variant<4>>,
+                    queen::Without<Variant<78>>>()
+            .Each([&viaQuery](const Position&, const Velocity&) {
+                ++viaQuery;
+            });
+        larvae::AssertEqual(viaQuery, size_t{38});
+    });
 } // namespace
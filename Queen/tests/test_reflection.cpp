@@ -577,4 +577,38 @@ namespace
         const queen::RegisteredComponent* found = registry.FindByName("TagComponent");
         larvae::AssertNull(found);
     });
+
+    auto test29 = larvae::RegisterTest("QueenReflection", "RegistryFindByNameHashedIndex", []() {
+        // Entries shift as types are inserted in TypeId order, every name must still resolve
+        queen::ComponentRegistry<8> registry;
+        registry.Register<Position>();
+        registry.RegisterWithoutReflection<TagComponent>();
+        registry.Register<Velocity>();
+        registry.Register<Health>();
+        registry.Register<Transform>();
+        registry.Register<Sprite>();
+
+        const queen::TypeId ids[] = {queen::TypeIdOf<Position>(), queen::TypeIdOf<Velocity>(),
+                                     queen::TypeIdOf<Health>(), queen::TypeIdOf<Transform>(),
+                                     queen::TypeIdOf<Sprite>()};
+        const char* names[] = {queen::GetReflectionData<Position>().m_name,
+                               queen::GetReflectionData<Velocity>().m_name,
+                               queen::GetReflectionData<Health>().m_name,
+                               queen::GetReflectionData<Transform>().m_name,
+                               queen::GetReflectionData<Sprite>().m_name};
+
+        for (size_t i = 0; i < 5; ++i)
+        {
+            const queen::RegisteredComponent* found = registry.FindByName(names[i]);
+            larvae::AssertNotNull(found);
+            larvae::AssertEqual(found->m_meta.m_typeId, ids[i]);
+        }
+
+        registry.Clear();
+        larvae::AssertNull(registry.FindByName(names[0]));
+
+        registry.Register<Health>();
+        larvae::AssertNull(registry.FindByName(names[0]));
+        larvae::AssertNotNull(registry.FindByName(names[2]));
+    });
 } // namespace
@@ -1,9 +1,13 @@
 #include <comb/linear_allocator.h>
 
+#include <wax/containers/string.h>
+
 #include <queen/world/world.h>
 
 #include <larvae/larvae.h>
 
+#include <cstring>
+
 namespace
 {
     struct Position
@@ -413,4 +417,326 @@ namespace
         larvae::AssertTrue(a_order < b_order);
         larvae::AssertTrue(b_order < c_order);
     });
+    // SystemStats / timeline Tests
+
+    auto test_system_stats = larvae::RegisterTest("QueenScheduler", "SystemStatsRecorded", []() {
+        queen::World world{};
+        for (int i = 0; i < 3; ++i)
+        {
+            (void)world.Spawn(Position{0.0f, 0.0f, 0.0f});
+        }
+
+        auto moveId = world.System<queen::Write<Position>>("Move").Each([](Position& p) { p.x += 1.0f; });
+        auto idleId = world.System("Idle").Run([](queen::World&) {});
+        world.SetSystemEnabled(idleId, false);
+
+        world.Update();
+        world.Update();
+        world.Update();
+
+        const queen::SystemStats& stats = world.GetSystemStorage().GetSystem(moveId)->Stats();
+        larvae::AssertEqual(stats.m_invocations, uint64_t{3});
+        larvae::AssertEqual(stats.m_lastEntities, uint64_t{3});
+        larvae::AssertEqual(stats.m_totalEntities, uint64_t{9});
+        larvae::AssertTrue(stats.m_maxNanos >= stats.m_lastNanos);
+        larvae::AssertTrue(stats.m_totalNanos >= stats.m_maxNanos);
+        larvae::AssertTrue(stats.AverageNanos() <= stats.m_maxNanos);
+        larvae::AssertEqual(stats.m_lastWorker, queen::SystemStats::kMainThread);
+
+        larvae::AssertEqual(world.GetSystemStorage().GetSystem(idleId)->Stats().m_invocations, uint64_t{0});
+
+        world.GetSystemStorage().ResetStats();
+        larvae::AssertEqual(world.GetSystemStorage().GetSystem(moveId)->Stats().m_invocations, uint64_t{0});
+    });
+
+    auto test_stats_visited = larvae::RegisterTest("QueenScheduler", "SystemStatsCountVisitedEntities", []() {
+        queen::World world{};
+        for (int i = 0; i < 3; ++i)
+        {
+            (void)world.Spawn(Position{0.0f, 0.0f, 0.0f});
+        }
+
+        auto id = world.System<queen::Read<Position>, queen::Changed<Position>>("Dirty").Each([](const Position&) {});
+
+        world.Update();
+        const queen::SystemStats& stats = world.GetSystemStorage().GetSystem(id)->Stats();
+        larvae::AssertEqual(stats.m_lastEntities, uint64_t{3});
+
+        // Nothing changed since the last run: the system ran but visited no entity
+        world.Update();
+        larvae::AssertEqual(stats.m_invocations, uint64_t{2});
+        larvae::AssertEqual(stats.m_lastEntities, uint64_t{0});
+    });
+
+    auto test_timeline_ring = larvae::RegisterTest("QueenScheduler", "TimelineKeepsLastFrames", []() {
+        queen::World world{};
+        world.GetSystemStorage().Timeline().SetFrameCapacity(2);
+
+        world.System("A").Run([](queen::World&) {});
+        world.System("B").Run([](queen::World&) {});
+
+        world.Update();
+        world.Update();
+        world.Update();
+
+        const auto& timeline = world.GetSystemStorage().Timeline();
+        larvae::AssertEqual(timeline.FrameCount(), size_t{2});
+        larvae::AssertEqual(timeline.SystemCount(), size_t{2});
+        larvae::AssertTrue(timeline.FrameTick(0) == world.CurrentTick());
+        larvae::AssertEqual(timeline.FrameTick(1).m_value + 1, world.CurrentTick().m_value);
+        larvae::AssertTrue(timeline.Frame(2) == nullptr);
+
+        const queen::TimelineEvent* frame = timeline.Frame(0);
+        larvae::AssertTrue(frame[0].m_ran);
+        larvae::AssertTrue(frame[1].m_ran);
+        larvae::AssertTrue(frame[1].m_startNanos >= frame[0].m_startNanos);
+    });
+
+    auto test_chrome_trace = larvae::RegisterTest("QueenScheduler", "WriteChromeTrace", []() {
+        queen::World world{};
+
+        world.System("Plain").Run([](queen::World&) {});
+        world.System("Say \"hi\"").Run([](queen::World&) {});
+
+        world.Update();
+        world.Update();
+
+        wax::String trace{};
+        world.GetSystemStorage().WriteChromeTrace(trace);
+        const char* json = trace.CStr();
+
+        larvae::AssertTrue(std::strncmp(json, "{\"traceEvents\":[", 16) == 0);
+        larvae::AssertTrue(std::strstr(json, "\"name\":\"Plain\"") != nullptr);
+        larvae::AssertTrue(std::strstr(json, "\"name\":\"Say \\\"hi\\\"\"") != nullptr);
+        larvae::AssertTrue(std::strstr(json, "\"displayTimeUnit\":\"ms\"}") != nullptr);
+
+        size_t events = 0;
+        for (const char* p = std::strstr(json, "\"ph\":\"X\""); p != nullptr; p = std::strstr(p + 1, "\"ph\":\"X\""))
+        {
+            ++events;
+        }
+        larvae::AssertEqual(events, size_t{4});
+
+        wax::String lastFrame{};
+        world.GetSystemStorage().WriteChromeTrace(lastFrame, 1);
+        larvae::AssertTrue(lastFrame.Size() < trace.Size());
+    });
+
+    // Run criteria
+
+    auto test_run_if_changed = larvae::RegisterTest("QueenScheduler", "RunIfChangedSkipsIdleTicks", []() {
+        queen::World world{};
+        auto entity = world.Spawn(Health{100, 100});
+
+        int runs = 0;
+        auto id = world.System<queen::Read<Health>>("HealthBars").RunIfChanged().Each([&runs](const Health&) {
+            ++runs;
+        });
+
+        world.Update();
+        larvae::AssertEqual(runs, 1);
+
+        world.Update();
+        world.Update();
+        larvae::AssertEqual(runs, 1);
+
+        world.Set(entity, Health{50, 100});
+        world.Update();
+        larvae::AssertEqual(runs, 2);
+
+        const queen::SystemStats& stats = world.GetSystemStorage().GetSystem(id)->Stats();
+        larvae::AssertEqual(stats.m_invocations, uint64_t{2});
+        larvae::AssertEqual(stats.m_skips, uint64_t{2});
+
+        (void)world.Spawn(Health{10, 10});
+        world.Update();
+        larvae::AssertEqual(runs, 4);
+    });
+
+    auto test_run_if_changed_writes = larvae::RegisterTest("QueenScheduler", "RunIfChangedNeedsStampedWrites", []() {
+        queen::World world{};
+        (void)world.Spawn(Health{100, 100});
+
+        bool stamp = false;
+        (void)world.System<queen::Write<Health>>("Damage").EachChunk(
+            [&world, &stamp](const auto& chunk, wax::Span<Health> health) {
+                for (size_t i = 0; i < chunk.Size(); ++i)
+                {
+                    health[i].current -= 1;
+                }
+                if (stamp)
+                {
+                    chunk.template MarkChanged<Health>(world.CurrentTick());
+                }
+            });
+
+        int runs = 0;
+        (void)world.System<queen::Read<Health>>("HealthBars").After("Damage").RunIfChanged().Each(
+            [&runs](const Health&) { ++runs; });
+
+        world.Update();
+        larvae::AssertEqual(runs, 1);
+
+        // Unmarked writes are invisible to the change probe
+        world.Update();
+        world.Update();
+        larvae::AssertEqual(runs, 1);
+
+        stamp = true;
+        world.Update();
+        larvae::AssertEqual(runs, 2);
+    });
+
+    auto test_run_if_resource = larvae::RegisterTest("QueenScheduler", "RunIfResourceChanged", []() {
+        struct Settings
+        {
+            int level;
+        };
+
+        queen::World world{};
+        world.InsertResource(Settings{1});
+
+        int reads = 0;
+        (void)world.System("Writer")
+            .WithResource<Tag>()
+            .RunIf([](queen::World& w) { return w.HasResource<Tag>(); })
+            .RunWithResMut<Settings>([](queen::ResMut<Settings> settings) { ++settings->level; });
+        (void)world.System("Reader")
+            .After("Writer")
+            .RunIfResourceChanged<Settings>()
+            .RunWithRes<Settings>([&reads](queen::Res<Settings>) { ++reads; });
+
+        world.Update();
+        larvae::AssertEqual(reads, 1);
+
+        world.Update();
+        larvae::AssertEqual(reads, 1);
+
+        world.MarkResourceChanged<Settings>();
+        world.Update();
+        larvae::AssertEqual(reads, 2);
+
+        world.InsertResource(Tag{});
+        world.Update();
+        world.Update();
+        larvae::AssertEqual(reads, 4);
+        larvae::AssertEqual(world.Resource<Settings>()->level, 3);
+    });
+
+    auto test_run_every = larvae::RegisterTest("QueenScheduler", "RunEverySpreadsPhases", []() {
+        queen::World world{};
+
+        int runsA = 0;
+        int runsB = 0;
+        int sameTick = 0;
+        uint64_t lastA = 0;
+        auto a = world.System("A").RunEvery(2).Run([&](queen::World& w) {
+            ++runsA;
+            lastA = w.CurrentTick().m_value;
+        });
+        auto b = world.System("B").RunEvery(2).Run([&](queen::World& w) {
+            ++runsB;
+            sameTick += w.CurrentTick().m_value == lastA ? 1 : 0;
+        });
+
+        const auto& storage = world.GetSystemStorage();
+        larvae::AssertTrue(storage.GetSystem(a)->RunPhase() != storage.GetSystem(b)->RunPhase());
+
+        for (int i = 0; i < 8; ++i)
+        {
+            world.Update();
+        }
+
+        larvae::AssertEqual(runsA, 4);
+        larvae::AssertEqual(runsB, 4);
+        larvae::AssertEqual(sameTick, 0);
+        larvae::AssertEqual(storage.GetSystem(a)->Stats().m_skips, uint64_t{4});
+    });
+
+    auto test_time_sliced = larvae::RegisterTest("QueenScheduler", "TimeSlicedVisitsEveryRow", []() {
+        queen::World world{};
+        for (int i = 0; i < 10; ++i)
+        {
+            (void)world.Spawn(Health{0, 0});
+        }
+
+        int perRun = 0;
+        (void)world.System<queen::Write<Health>>("Slice").TimeSliced(3).Each([&perRun](Health& hp) {
+            ++hp.current;
+            ++perRun;
+        });
+
+        world.Update();
+        larvae::AssertEqual(perRun, 4);
+        world.Update();
+        world.Update();
+        larvae::AssertEqual(perRun, 10);
+
+        int minVisits = 100;
+        int maxVisits = 0;
+        world.Query<queen::Read<Health>>().Each([&](const Health& hp) {
+            minVisits = hp.current < minVisits ? hp.current : minVisits;
+            maxVisits = hp.current > maxVisits ? hp.current : maxVisits;
+        });
+        larvae::AssertEqual(minVisits, 1);
+        larvae::AssertEqual(maxVisits, 1);
+
+        // A new archetype keeps the cursor, the next rotation starts at row 0
+        (void)world.Spawn(Health{0, 0}, Tag{});
+        perRun = 0;
+        world.Update();
+        larvae::AssertEqual(perRun, 4);
+    });
+
+    auto test_async_ticks = larvae::RegisterTest("QueenScheduler", "AsyncSystemSpansTicks", []() {
+        queen::World world{};
+
+        int step = 0;
+        int starts = 0;
+        (void)world.System("Async").Async([&](queen::AsyncSystemContext& ctx) -> drone::Task<> {
+            ++starts;
+            step = 1;
+            co_await ctx.NextTick();
+            step = 2;
+            ctx.GetWorld().GetCommands().Get().Spawn().With(Health{7, 7});
+            co_await ctx.NextTick();
+            step = 3;
+        });
+
+        world.Update();
+        larvae::AssertEqual(step, 1);
+        larvae::AssertEqual(world.EntityCount(), size_t{0});
+
+        world.Update();
+        larvae::AssertEqual(step, 2);
+        larvae::AssertEqual(world.EntityCount(), size_t{1});
+
+        world.Update();
+        larvae::AssertEqual(step, 3);
+        larvae::AssertEqual(starts, 1);
+
+        world.Update();
+        larvae::AssertEqual(step, 1);
+        larvae::AssertEqual(starts, 2);
+    });
+
+    auto test_async_counter = larvae::RegisterTest("QueenScheduler", "AsyncSystemWaitsForCounter", []() {
+        queen::World world{};
+        drone::Counter pending{1};
+
+        int resumed = 0;
+        (void)world.System("Waiter").Async([&](queen::AsyncSystemContext& ctx) -> drone::Task<> {
+            co_await ctx.WaitFor(pending);
+            ++resumed;
+            co_await ctx.NextTick();
+        });
+
+        world.Update();
+        world.Update();
+        larvae::AssertEqual(resumed, 0);
+
+        pending.Decrement();
+        world.Update();
+        larvae::AssertEqual(resumed, 1);
+    });
 } // namespace
@@ -0,0 +1,367 @@
+#include <comb/buddy_allocator.h>
+#include <comb/linear_allocator.h>
+
+#include <queen/command/command_buffer.h>
+#include <queen/query/query.h>
+#include <queen/reflect/component_registry.h>
+#include <queen/reflect/reflectable.h>
+#include <queen/reflect/world_deserializer.h>
+#include <queen/reflect/world_serializer.h>
+#include <queen/storage/sparse_storage.h>
+#include <queen/world/world.h>
+
+#include <larvae/larvae.h>
+
+namespace
+{
+    struct Position
+    {
+        float x = 0.f;
+        float y = 0.f;
+        float z = 0.f;
+
+        static void Reflect(queen::ComponentReflector<>& r)
+        {
+            r.Field("x", &Position::x);
+            r.Field("y", &Position::y);
+            r.Field("z", &Position::z);
+        }
+    };
+
+    struct Stunned
+    {
+        static constexpr queen::StorageType storage = queen::StorageType::SPARSE;
+
+        float remaining = 0.f;
+
+        static void Reflect(queen::ComponentReflector<>& r)
+        {
+            r.Field("remaining", &Stunned::remaining);
+        }
+    };
+
+    struct Burning
+    {
+        static constexpr queen::StorageType storage = queen::StorageType::SPARSE;
+
+        int damage = 0;
+    };
+
+    // SparseStorage
+
+    auto test1 = larvae::RegisterTest("QueenSparseStorage", "InsertGetRemove", []() {
+        comb::BuddyAllocator alloc{1024 * 1024};
+        queen::SparseStorage<comb::BuddyAllocator> storage{alloc, queen::ComponentMeta::Of<Stunned>()};
+
+        queen::Entity e1{3, 0};
+        queen::Entity e2{10, 0};
+        Stunned s1{1.f};
+        Stunned s2{2.f};
+
+        storage.InsertCopy(e1, &s1, queen::Tick{1});
+        storage.InsertCopy(e2, &s2, queen::Tick{1});
+
+        larvae::AssertEqual(storage.Count(), size_t{2});
+        larvae::AssertTrue(storage.Contains(e1));
+        larvae::AssertEqual(static_cast<Stunned*>(storage.Get(e2))->remaining, 2.f);
+
+        larvae::AssertTrue(storage.Remove(e1));
+        larvae::AssertFalse(storage.Contains(e1));
+        larvae::AssertFalse(storage.Remove(e1));
+        larvae::AssertTrue(storage.Contains(e2));
+        larvae::AssertEqual(static_cast<Stunned*>(storage.Get(e2))->remaining, 2.f);
+        larvae::AssertEqual(storage.Count(), size_t{1});
+    });
+
+    auto test2 = larvae::RegisterTest("QueenSparseStorage", "StaleGenerationNotContained", []() {
+        comb::BuddyAllocator alloc{1024 * 1024};
+        queen::SparseStorage<comb::BuddyAllocator> storage{alloc, queen::ComponentMeta::Of<Stunned>()};
+
+        queen::Entity e{4, 0};
+        Stunned s{1.f};
+        storage.InsertCopy(e, &s, queen::Tick{1});
+
+        larvae::AssertFalse(storage.Contains(queen::Entity{4, 1}));
+        larvae::AssertNull(storage.Get(queen::Entity{4, 1}));
+    });
+
+    // World integration
+
+    auto test3 = larvae::RegisterTest("QueenSparseStorage", "AddDoesNotChangeArchetype", []() {
+        queen::World world{};
+
+        queen::Entity e = world.Spawn(Position{1.f, 2.f, 3.f});
+        const size_t archetypes = world.ArchetypeCount();
+
+        world.Add(e, Stunned{2.f});
+
+        larvae::AssertEqual(world.ArchetypeCount(), archetypes);
+        larvae::AssertTrue(world.Has<Stunned>(e));
+        larvae::AssertTrue(world.HasComponent(e, queen::TypeIdOf<Stunned>()));
+        larvae::AssertEqual(world.Get<Stunned>(e)->remaining, 2.f);
+        larvae::AssertEqual(world.Get<Position>(e)->x, 1.f);
+
+        world.Add(e, Stunned{5.f});
+        larvae::AssertEqual(world.Get<Stunned>(e)->remaining, 5.f);
+
+        world.Remove<Stunned>(e);
+        larvae::AssertFalse(world.Has<Stunned>(e));
+        larvae::AssertNull(world.Get<Stunned>(e));
+        larvae::AssertEqual(world.ArchetypeCount(), archetypes);
+        larvae::AssertTrue(world.Has<Position>(e));
+    });
+
+    auto test4 = larvae::RegisterTest("QueenSparseStorage", "SpawnWithSparse", []() {
+        queen::World world{};
+
+        queen::Entity e = world.Spawn().With(Position{1.f, 0.f, 0.f}).With(Stunned{3.f}).Build();
+
+        larvae::AssertTrue(world.Has<Position>(e));
+        larvae::AssertTrue(world.Has<Stunned>(e));
+        larvae::AssertEqual(world.Get<Stunned>(e)->remaining, 3.f);
+        larvae::AssertNotNull(world.GetComponentRaw(e, queen::TypeIdOf<Stunned>()));
+
+        size_t typeCount = 0;
+        world.ForEachComponentType(e, [&typeCount](queen::TypeId) { ++typeCount; });
+        larvae::AssertEqual(typeCount, size_t{2});
+    });
+
+    auto test5 = larvae::RegisterTest("QueenSparseStorage", "DespawnRemovesSparse", []() {
+        queen::World world{};
+
+        queen::Entity e1 = world.Spawn(Position{}, Stunned{1.f});
+        queen::Entity e2 = world.Spawn(Position{}, Stunned{2.f});
+
+        world.Despawn(e1);
+
+        const auto* storage = world.GetSparseStorages().Find(queen::TypeIdOf<Stunned>());
+        larvae::AssertNotNull(storage);
+        larvae::AssertEqual(storage->Count(), size_t{1});
+        larvae::AssertEqual(world.Get<Stunned>(e2)->remaining, 2.f);
+
+        queen::Entity e3 = world.Spawn(Position{});
+        larvae::AssertFalse(world.Has<Stunned>(e3));
+    });
+
+    auto test6 = larvae::RegisterTest("QueenSparseStorage", "CloneCopiesSparse", []() {
+        queen::World world{};
+
+        queen::Entity e = world.Spawn(Position{}, Stunned{4.f});
+        queen::Entity clone = world.CloneEntity(e);
+
+        larvae::AssertTrue(world.Has<Stunned>(clone));
+        larvae::AssertEqual(world.Get<Stunned>(clone)->remaining, 4.f);
+    });
+
+    // Queries
+
+    auto test7 = larvae::RegisterTest("QueenSparseStorage", "QueryDenseWithSparseRequired", []() {
+        queen::World world{};
+
+        static_cast<void>(world.Spawn(Position{1.f, 0.f, 0.f}));
+        static_cast<void>(world.Spawn(Position{2.f, 0.f, 0.f}, Stunned{1.f}));
+        static_cast<void>(world.Spawn(Position{3.f, 0.f, 0.f}, Stunned{2.f}));
+
+        float sum = 0.f;
+        int count = 0;
+        world.Query<queen::Read<Position>, queen::Write<Stunned>>().Each([&](const Position& p, Stunned& s) {
+            sum += p.x;
+            s.remaining = 0.f;
+            ++count;
+        });
+
+        larvae::AssertEqual(count, 2);
+        larvae::AssertEqual(sum, 5.f);
+        larvae::AssertEqual(world.Query<queen::Read<Position>, queen::With<Stunned>>().EntityCount(), size_t{2});
+    });
+
+    auto test8 = larvae::RegisterTest("QueenSparseStorage", "QuerySparseWithout", []() {
+        queen::World world{};
+
+        static_cast<void>(world.Spawn(Position{1.f, 0.f, 0.f}));
+        static_cast<void>(world.Spawn(Position{2.f, 0.f, 0.f}, Stunned{1.f}));
+
+        float sum = 0.f;
+        world.Query<queen::Read<Position>, queen::Without<Stunned>>().Each([&](const Position& p) { sum += p.x; });
+
+        larvae::AssertEqual(sum, 1.f);
+    });
+
+    auto test9 = larvae::RegisterTest("QueenSparseStorage", "QuerySparseOnly", []() {
+        queen::World world{};
+
+        static_cast<void>(world.Spawn(Position{}, Stunned{1.f}));
+        static_cast<void>(world.Spawn(Stunned{2.f}, Burning{3}));
+        static_cast<void>(world.Spawn(Burning{4}));
+
+        float stunned = 0.f;
+        world.Query<queen::Read<Stunned>>().Each([&](const Stunned& s) { stunned += s.remaining; });
+        larvae::AssertEqual(stunned, 3.f);
+
+        int both = 0;
+        world.Query<queen::Read<Stunned>, queen::Read<Burning>>().EachWithEntity(
+            [&](queen::Entity, const Stunned& s, const Burning& b) {
+                larvae::AssertEqual(s.remaining, 2.f);
+                both += b.damage;
+            });
+        larvae::AssertEqual(both, 3);
+    });
+
+    auto test10 = larvae::RegisterTest("QueenSparseStorage", "QuerySparseOptional", []() {
+        queen::World world{};
+
+        static_cast<void>(world.Spawn(Position{1.f, 0.f, 0.f}));
+        static_cast<void>(world.Spawn(Position{2.f, 0.f, 0.f}, Stunned{5.f}));
+
+        int visited = 0;
+        float stunned = 0.f;
+        world.Query<queen::Read<Position>, queen::Maybe<Stunned>>().Each([&](const Position&, const Stunned* s) {
+            ++visited;
+            if (s != nullptr)
+            {
+                stunned += s->remaining;
+            }
+        });
+
+        larvae::AssertEqual(visited, 2);
+        larvae::AssertEqual(stunned, 5.f);
+    });
+
+    auto test11 = larvae::RegisterTest("QueenSparseStorage", "QueryAddedFilter", []() {
+        queen::World world{};
+
+        queen::Entity e1 = world.Spawn(Position{});
+        world.Add(e1, Stunned{1.f});
+
+        world.IncrementTick();
+        const queen::Tick lastRun = world.CurrentTick();
+        world.IncrementTick();
+
+        queen::Entity e2 = world.Spawn(Position{});
+        world.Add(e2, Stunned{2.f});
+
+        auto query = world.Query<queen::Read<Stunned>, queen::Added<Stunned>>();
+        query.SetLastRunTick(lastRun);
+
+        int count = 0;
+        query.EachWithEntity([&](queen::Entity e, const Stunned&) {
+            larvae::AssertTrue(e == e2);
+            ++count;
+        });
+        larvae::AssertEqual(count, 1);
+    });
+
+    auto test12 = larvae::RegisterTest("QueenSparseStorage", "SystemSeesSparse", []() {
+        queen::World world{};
+
+        static_cast<void>(world.Spawn(Position{}, Stunned{1.f}));
+        static_cast<void>(world.Spawn(Position{}));
+
+        int count = 0;
+        world.System<queen::Write<Position>, queen::Read<Stunned>>("Stun").Each(
+            [&count](Position& p, const Stunned&) {
+                p.x = 1.f;
+                ++count;
+            });
+
+        world.Update();
+        larvae::AssertEqual(count, 1);
+
+        static_cast<void>(world.Spawn(Position{}, Stunned{2.f}));
+        world.Update();
+        larvae::AssertEqual(count, 3);
+    });
+
+    // Commands
+
+    auto test13 = larvae::RegisterTest("QueenSparseStorage", "CommandBufferAddRemove", []() {
+        comb::LinearAllocator alloc{131072};
+        queen::World world{};
+        queen::CommandBuffer<comb::LinearAllocator> cmd{alloc};
+
+        queen::Entity e = world.Spawn(Position{});
+        cmd.Add(e, Stunned{7.f});
+        auto builder = cmd.Spawn().With(Position{}).With(Burning{2});
+        cmd.Flush(world);
+
+        larvae::AssertTrue(world.Has<Stunned>(e));
+        larvae::AssertEqual(world.Get<Stunned>(e)->remaining, 7.f);
+
+        queen::Entity spawned = cmd.GetSpawnedEntity(builder.GetSpawnIndex());
+        larvae::AssertTrue(world.Has<Burning>(spawned));
+        larvae::AssertTrue(world.Has<Position>(spawned));
+
+        cmd.Remove<Stunned>(e);
+        cmd.Flush(world);
+
+        larvae::AssertFalse(world.Has<Stunned>(e));
+        larvae::AssertTrue(world.Has<Position>(e));
+    });
+
+    // Serialization
+
+    auto test14 = larvae::RegisterTest("QueenSparseStorage", "SerializeRoundtrip", []() {
+        queen::ComponentRegistry<32> registry;
+        registry.Register<Position>();
+        registry.Register<Stunned>();
+
+        queen::World src{};
+        static_cast<void>(src.Spawn(Position{1.f, 0.f, 0.f}, Stunned{6.f}));
+        static_cast<void>(src.Spawn(Position{2.f, 0.f, 0.f}));
+
+        queen::WorldSerializer<8192> serializer;
+        auto result = serializer.Serialize(src, registry);
+        larvae::AssertTrue(result.m_success);
+        larvae::AssertEqual(result.m_componentsWritten, size_t{3});
+
+        queen::World dst{};
+        larvae::AssertTrue(queen::WorldDeserializer::Deserialize(dst, registry, serializer.CStr()).m_success);
+
+        float stunned = 0.f;
+        dst.Query<queen::Read<Position>, queen::Read<Stunned>>().Each(
+            [&stunned](const Position& p, const Stunned& s) {
+                larvae::AssertEqual(p.x, 1.f);
+                stunned += s.remaining;
+            });
+        larvae::AssertEqual(stunned, 6.f);
+    });
+
+    auto test15 = larvae::RegisterTest("QueenSparseStorage", "SpawnBatchRawWithSparse", []() {
+        queen::World world{};
+
+        const Stunned stunned{1.5f};
+        queen::SpawnBatchComponent components[2];
+        components[0].m_meta = queen::ComponentMeta::Of<Position>();
+        components[1].m_meta = queen::ComponentMeta::Of<Stunned>();
+        components[1].m_source = &stunned;
+
+        queen::Entity entities[4];
+        world.SpawnBatchRaw(4, components, 2, entities);
+
+        for (const queen::Entity& e : entities)
+        {
+            larvae::AssertTrue(world.Has<Position>(e));
+            larvae::AssertEqual(world.Get<Stunned>(e)->remaining, 1.5f);
+        }
+    });
+
+    auto test16 = larvae::RegisterTest("QueenSparseStorage", "EntityCountWalksSparseSet", []() {
+        queen::World world{};
+
+        for (int i = 0; i < 8; ++i)
+        {
+            static_cast<void>(world.Spawn(Position{}));
+        }
+        static_cast<void>(world.Spawn(Position{}, Stunned{1.f}));
+        static_cast<void>(world.Spawn(Position{}, Stunned{2.f}, Burning{1}));
+        static_cast<void>(world.Spawn(Stunned{3.f}));
+        queen::Entity gone = world.Spawn(Position{}, Stunned{4.f});
+        world.Despawn(gone);
+
+        larvae::AssertEqual(world.Query<queen::Read<Position>, queen::With<Stunned>>().EntityCount(), size_t{2});
+        larvae::AssertEqual(world.Query<queen::Read<Stunned>>().EntityCount(), size_t{3});
+        larvae::AssertEqual(world.Query<queen::Read<Stunned>, queen::Without<Burning>>().EntityCount(), size_t{2});
+        larvae::AssertEqual(world.Query<queen::Read<Position>, queen::Without<Stunned>>().EntityCount(), size_t{8});
+        larvae::AssertEqual(world.Query<queen::Read<Burning>, queen::Read<Position>>().EntityCount(), size_t{1});
+    });
+} // namespace
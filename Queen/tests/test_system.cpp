@@ -433,4 +433,121 @@ namespace
         world.Advance();
         larvae::AssertEqual(counter.load(), 11);
     });
+
+    auto test_cached_new_archetype = larvae::RegisterTest("QueenSystem", "CachedQuerySeesArchetypesCreatedLater", []() {
+        queen::World world{};
+
+        static_cast<void>(world.Spawn(Position{1.0f, 0.0f, 0.0f}));
+
+        float sum = 0.0f;
+        queen::SystemId id =
+            world.System<queen::Read<Position>>("SumPosition").Each([&](const Position& pos) { sum += pos.x; });
+
+        world.RunSystem(id);
+        larvae::AssertEqual(sum, 1.0f);
+
+        // New archetypes appear after the system (and its cached query) was built
+        static_cast<void>(world.Spawn(Position{2.0f, 0.0f, 0.0f}, Velocity{0.0f, 0.0f, 0.0f}));
+        static_cast<void>(world.Spawn(Position{3.0f, 0.0f, 0.0f}, Health{100, 100}));
+        static_cast<void>(world.Spawn(Velocity{5.0f, 0.0f, 0.0f}));
+
+        sum = 0.0f;
+        world.RunSystem(id);
+        larvae::AssertEqual(sum, 6.0f);
+    });
+
+    auto test_cached_excluded = larvae::RegisterTest("QueenSystem", "CachedQueryRespectsWithout", []() {
+        queen::World world{};
+
+        int count = 0;
+        queen::SystemId id = world.System<queen::Read<Position>, queen::Without<Tag>>("NoTag").Each(
+            [&](const Position&) { ++count; });
+
+        static_cast<void>(world.Spawn(Position{1.0f, 0.0f, 0.0f}));
+        static_cast<void>(world.Spawn(Position{2.0f, 0.0f, 0.0f}, Tag{}));
+
+        world.RunSystem(id);
+        larvae::AssertEqual(count, 1);
+    });
+
+    auto test_cached_unregister = larvae::RegisterTest("QueenSystem", "CachedQueryUnregisteredOnRemove", []() {
+        queen::World world{};
+
+        larvae::AssertEqual(world.QueryStateCount(), size_t{0});
+
+        queen::SystemId a = world.System<queen::Read<Position>>("A").Each([](const Position&) {});
+        static_cast<void>(world.System<queen::Write<Velocity>>("B").EachWithEntity([](queen::Entity, Velocity&) {}));
+        larvae::AssertEqual(world.QueryStateCount(), size_t{2});
+
+        world.RemoveSystem(a);
+        larvae::AssertEqual(world.QueryStateCount(), size_t{1});
+
+        // Creating archetypes after removal must not touch the destroyed state
+        static_cast<void>(world.Spawn(Position{1.0f, 0.0f, 0.0f}, Velocity{0.0f, 0.0f, 0.0f}));
+
+        world.ClearSystems();
+        larvae::AssertEqual(world.QueryStateCount(), size_t{0});
+    });
+
+    auto test_each_chunk = larvae::RegisterTest("QueenSystem", "EachChunkSystem", []() {
+        queen::World world{};
+
+        for (int i = 0; i < 100; ++i)
+        {
+            static_cast<void>(world.Spawn(Position{0.0f, 0.0f, 0.0f}, Velocity{1.0f, 0.0f, 0.0f}));
+        }
+
+        queen::SystemId id = world.System<queen::Read<Velocity>, queen::Write<Position>>("Integrate").EachChunk(
+            [](const queen::QueryChunk<queen::ComponentAllocator>& chunk, wax::Span<const Velocity> vel,
+               wax::Span<Position> pos) {
+                for (size_t i = 0; i < chunk.Size(); ++i)
+                {
+                    pos[i].x += vel[i].dx;
+                }
+            });
+
+        world.RunSystem(id);
+        world.RunSystem(id);
+
+        float sum = 0.0f;
+        world.Query<queen::Read<Position>>().Each([&](const Position& pos) { sum += pos.x; });
+        larvae::AssertEqual(sum, 200.0f);
+    });
+
+    auto test_cached_last_run = larvae::RegisterTest("QueenSystem", "CachedQueryUsesSystemLastRunTick", []() {
+        queen::World world{};
+
+        for (int i = 0; i < 500; ++i)
+        {
+            static_cast<void>(world.Spawn(Position{static_cast<float>(i), 0.0f, 0.0f}));
+        }
+
+        int count = 0;
+        queen::SystemId id = world.System<queen::Read<Position>, queen::Changed<Position>>("Dirty").Each(
+            [&](const Position&) { ++count; });
+
+        world.RunSystem(id);
+        larvae::AssertEqual(count, 500);
+
+        world.IncrementTick();
+        queen::Archetype<queen::ComponentAllocator>* archetype = nullptr;
+        world.ForEachArchetype([&](queen::Archetype<queen::ComponentAllocator>& arch) {
+            if (arch.HasComponent<Position>())
+            {
+                archetype = &arch;
+            }
+        });
+        larvae::AssertNotNull(archetype);
+        archetype->GetColumn(queen::TypeIdOf<Position>())->MarkChanged(10, world.CurrentTick());
+
+        // Only the row written since the previous run is visited, its clean blocks are skipped
+        count = 0;
+        world.RunSystem(id);
+        larvae::AssertEqual(count, 1);
+
+        world.IncrementTick();
+        count = 0;
+        world.RunSystem(id);
+        larvae::AssertEqual(count, 0);
+    });
 } // namespace
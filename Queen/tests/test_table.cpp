@@ -389,4 +389,59 @@ namespace
         larvae::AssertTrue(has_velocity);
         larvae::AssertTrue(has_health);
     });
+
+    auto test17 = larvae::RegisterTest("QueenTable", "ChunkedLayout", []() {
+        comb::LinearAllocator alloc{1048576};
+
+        wax::Vector<queen::ComponentMeta> metas{alloc};
+        metas.PushBack(queen::ComponentMeta::Of<Position>());
+        metas.PushBack(queen::ComponentMeta::Of<Velocity>());
+
+        // 2 * (12 + 8) bytes per row: 256 rows fit in 16 KB
+        queen::Table<comb::LinearAllocator> table{alloc, metas, 16, 16 * 1024};
+        larvae::AssertEqual(table.ChunkRows(), size_t{256});
+        larvae::AssertEqual(table.ChunkEnd(300), size_t{512});
+
+        for (uint32_t i = 0; i < 600; ++i)
+        {
+            const uint32_t row = table.AllocateRow(queen::Entity{i, 0});
+            table.GetColumn<Position>()->Get<Position>(row)->x = static_cast<float>(i);
+        }
+
+        larvae::AssertEqual(table.GetColumn<Position>()->ChunkCount(), size_t{3});
+        larvae::AssertEqual(table.GetColumn<Velocity>()->ChunkRows(), size_t{256});
+        larvae::AssertEqual(table.GetColumn<Position>()->Get<Position>(599)->x, 599.0f);
+
+        queen::Table<comb::LinearAllocator> contiguous{alloc, metas, 16};
+        larvae::AssertEqual(contiguous.ChunkRows(), size_t{0});
+        larvae::AssertFalse(contiguous.GetColumn<Position>()->IsChunked());
+    });
+
+    auto test18 = larvae::RegisterTest("QueenTable", "GetColumnByDenseId", []() {
+        comb::LinearAllocator alloc{65536};
+
+        queen::ComponentMeta handBuilt = queen::ComponentMeta::Of<Velocity>();
+        handBuilt.m_denseId = queen::kInvalidDenseId;
+
+        wax::Vector<queen::ComponentMeta> metas{alloc};
+        metas.PushBack(queen::ComponentMeta::Of<Position>());
+        metas.PushBack(handBuilt);
+
+        queen::Table<comb::LinearAllocator> table{alloc, metas, 16};
+
+        auto* pos = table.GetColumnByDenseId(queen::DenseIdOf<Position>());
+        auto* vel = table.GetColumnByDenseId(queen::DenseIdOf<Velocity>());
+        larvae::AssertTrue(pos == table.GetColumnByTypeId(queen::TypeIdOf<Position>()));
+        larvae::AssertTrue(vel == table.GetColumnByTypeId(queen::TypeIdOf<Velocity>()));
+        larvae::AssertTrue(vel == &table.GetColumnAt(1));
+        larvae::AssertEqual(vel->GetMeta().m_denseId, queen::DenseIdOf<Velocity>());
+
+        larvae::AssertNull(table.GetColumn<Health>());
+        larvae::AssertNull(table.GetColumnByDenseId(queen::kMaxDenseIds));
+        larvae::AssertFalse(table.HasComponent<Health>());
+
+        uint32_t row = table.AllocateRow(queen::Entity{0, 0});
+        table.SetComponent<Position>(row, Position{1.0f, 2.0f, 3.0f});
+        larvae::AssertEqual(pos->Get<Position>(row)->y, 2.0f);
+    });
 } // namespace
@@ -4,6 +4,8 @@
 
 #include <larvae/larvae.h>
 
+#include <thread>
+
 namespace
 {
     struct Position
@@ -25,6 +27,34 @@ namespace
     {
     };
 
+    struct Tracked
+    {
+        static inline int s_alive = 0;
+        int value;
+
+        explicit Tracked(int v = 0)
+            : value{v}
+        {
+            ++s_alive;
+        }
+        Tracked(const Tracked& other)
+            : value{other.value}
+        {
+            ++s_alive;
+        }
+        Tracked& operator=(const Tracked&) = default;
+        ~Tracked()
+        {
+            --s_alive;
+        }
+    };
+
+    struct Flagged
+    {
+        static constexpr queen::StorageType storage = queen::StorageType::SPARSE;
+        int value;
+    };
+
     auto test1 = larvae::RegisterTest("QueenWorld", "Creation", []() {
         comb::LinearAllocator alloc{65536};
 
@@ -271,4 +301,375 @@ namespace
         larvae::AssertNotNull(world.Get<Position>(e2));
         larvae::AssertEqual(world.Get<Position>(e2)->x, 2.0f);
     });
+
+    auto test16 = larvae::RegisterTest("QueenWorld", "SpawnBatch", []() {
+        queen::World world{};
+
+        queen::Entity recycled = world.Spawn(Position{});
+        world.Despawn(recycled);
+
+        queen::Entity entities[1000];
+        world.SpawnBatch<Position, Velocity>(
+            1000,
+            [](size_t i, Position& pos, Velocity& vel) {
+                pos.x = static_cast<float>(i);
+                vel.dx = 1.0f;
+            },
+            entities);
+
+        larvae::AssertEqual(world.EntityCount(), size_t{1000});
+        larvae::AssertEqual(entities[0].Index(), recycled.Index());
+
+        for (size_t i = 0; i < 1000; i += 111)
+        {
+            larvae::AssertTrue(world.IsAlive(entities[i]));
+            larvae::AssertEqual(world.Get<Position>(entities[i])->x, static_cast<float>(i));
+            larvae::AssertEqual(world.Get<Velocity>(entities[i])->dx, 1.0f);
+        }
+
+        size_t count = 0;
+        world.Query<queen::Read<Position>, queen::Read<Velocity>>().Each(
+            [&count](const Position&, const Velocity&) { ++count; });
+        larvae::AssertEqual(count, size_t{1000});
+
+        world.Despawn(entities[10]);
+        larvae::AssertEqual(world.Get<Position>(entities[999])->x, 999.0f);
+    });
+
+    auto test17 = larvae::RegisterTest("QueenWorld", "SpawnBatchRaw", []() {
+        queen::World world{};
+
+        const Health prefab{50, 100};
+        const Position positions[3] = {{1.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f}, {3.0f, 0.0f, 0.0f}};
+
+        queen::SpawnBatchComponent components[3];
+        components[0].m_meta = queen::ComponentMeta::Of<Health>();
+        components[0].m_source = &prefab;
+        components[1].m_meta = queen::ComponentMeta::Of<Position>();
+        components[1].m_source = positions;
+        components[1].m_stride = sizeof(Position);
+        components[2].m_meta = queen::ComponentMeta::Of<Velocity>();
+
+        queen::Entity entities[3];
+        world.SpawnBatchRaw(3, components, 3, entities);
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            larvae::AssertEqual(world.Get<Health>(entities[i])->current, 50);
+            larvae::AssertEqual(world.Get<Position>(entities[i])->x, positions[i].x);
+            larvae::AssertEqual(world.Get<Velocity>(entities[i])->dx, 0.0f);
+        }
+    });
+
+    auto test18 = larvae::RegisterTest("QueenWorld", "ChunkedTables", []() {
+        queen::WorldAllocatorConfig config{};
+        config.m_tableChunkBytes = 16 * 1024;
+        queen::World world{config};
+
+        queen::Entity entities[3000];
+        world.SpawnBatch<Position, Velocity>(
+            3000, [](size_t i, Position& pos, Velocity&) { pos.x = static_cast<float>(i); }, entities);
+
+        const Position* stable = world.Get<Position>(entities[0]);
+        for (int i = 0; i < 1000; ++i)
+        {
+            (void)world.Spawn(Position{-1.0f, 0.0f, 0.0f}, Velocity{});
+        }
+        larvae::AssertTrue(world.Get<Position>(entities[0]) == stable);
+
+        world.Query<queen::Read<Position>, queen::Write<Velocity>>().Each(
+            [](const Position& pos, Velocity& vel) { vel.dx = pos.x; });
+
+        for (size_t i = 0; i < 3000; i += 97)
+        {
+            larvae::AssertEqual(world.Get<Velocity>(entities[i])->dx, static_cast<float>(i));
+        }
+
+        world.Despawn(entities[5]);
+        world.Add(entities[6], Health{1, 1});
+
+        size_t count = 0;
+        float sum = 0.0f;
+        world.Query<queen::Read<Position>>().EachWithEntity([&](queen::Entity, const Position& pos) {
+            ++count;
+            sum += pos.x;
+        });
+        larvae::AssertEqual(count, size_t{3999});
+        larvae::AssertEqual(sum, 2999.0f * 3000.0f / 2.0f - 5.0f - 1000.0f);
+        larvae::AssertEqual(world.Get<Position>(entities[6])->x, 6.0f);
+    });
+
+    auto test19 = larvae::RegisterTest("QueenWorld", "CompactReclaimsAndRetires", []() {
+        queen::World world{};
+
+        queen::Entity moving[4000];
+        queen::Entity tagged[100];
+        world.SpawnBatch<Position, Velocity>(4000, [](size_t, Position&, Velocity&) {}, moving);
+        world.SpawnBatch<Position, Tag>(100, [](size_t, Position&, Tag&) {}, tagged);
+
+        size_t visited = 0;
+        (void)world.System<queen::Read<Position>>("CountPositions").Each([&visited](const Position&) { ++visited; });
+
+        for (size_t i = 10; i < 4000; ++i)
+        {
+            world.Despawn(moving[i]);
+        }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            world.Despawn(tagged[i]);
+        }
+
+        queen::CompactStats stats = world.Compact();
+        larvae::AssertTrue(stats.m_bytesReclaimed > 0);
+        larvae::AssertGreaterEqual(stats.m_columnsShrunk, size_t{4});
+        larvae::AssertEqual(stats.m_archetypesRetired, size_t{1});
+
+        size_t count = 0;
+        world.Query<queen::Read<Position>>().Each([&count](const Position&) { ++count; });
+        larvae::AssertEqual(count, size_t{10});
+
+        world.Update();
+        larvae::AssertEqual(visited, size_t{10});
+
+        // An entity moving into the retired archetype registers it again
+        queen::Entity back = world.Spawn(Position{2.0f, 0.0f, 0.0f}, Tag{});
+        world.Update();
+        larvae::AssertEqual(visited, size_t{21});
+        larvae::AssertEqual(world.Get<Position>(back)->x, 2.0f);
+
+        stats = world.Compact();
+        larvae::AssertEqual(stats.m_archetypesRetired, size_t{0});
+    });
+
+    auto test20 = larvae::RegisterTest("QueenWorld", "ClearEntitiesKeepsSystemsAndResources", []() {
+        Tracked::s_alive = 0;
+        {
+            queen::World world{};
+            world.InsertResource(Health{3, 5});
+
+            queen::Entity first = world.Spawn(Position{1.0f, 0.0f, 0.0f}, Tracked{1});
+            world.Add(first, Flagged{4});
+            for (int i = 0; i < 50; ++i)
+            {
+                (void)world.Spawn(Position{}, Velocity{});
+            }
+
+            size_t visited = 0;
+            (void)world.System<queen::Read<Position>>("CountPositions").Each([&visited](const Position&) {
+                ++visited;
+            });
+
+            world.ClearEntities();
+
+            larvae::AssertEqual(world.EntityCount(), size_t{0});
+            larvae::AssertEqual(Tracked::s_alive, 0);
+            larvae::AssertFalse(world.IsAlive(first));
+            larvae::AssertTrue(world.Get<Position>(first) == nullptr);
+            larvae::AssertEqual(world.Resource<Health>()->current, 3);
+
+            queen::Entity next = world.Spawn(Position{2.0f, 0.0f, 0.0f}, Tracked{2});
+            larvae::AssertTrue(next != first);
+            larvae::AssertTrue(world.Get<Flagged>(next) == nullptr);
+            larvae::AssertEqual(world.Get<Tracked>(next)->value, 2);
+
+            world.Update();
+            larvae::AssertEqual(visited, size_t{1});
+
+            world.ClearEntities(true);
+            larvae::AssertEqual(Tracked::s_alive, 0);
+
+            (void)world.Spawn(Position{}, Tracked{3});
+            world.Update();
+            larvae::AssertEqual(visited, size_t{2});
+        }
+        larvae::AssertEqual(Tracked::s_alive, 0);
+    });
+
+    auto test21 = larvae::RegisterTest("QueenWorld", "MigrationKeepsNonTrivialBalanced", []() {
+        Tracked::s_alive = 0;
+        {
+            queen::World world{};
+
+            queen::Entity entities[200];
+            for (int i = 0; i < 200; ++i)
+            {
+                entities[i] = world.Spawn(Position{static_cast<float>(i), 0.0f, 0.0f}, Tracked{i});
+            }
+            for (int i = 0; i < 200; i += 2)
+            {
+                world.Add(entities[i], Velocity{1.0f, 0.0f, 0.0f});
+            }
+            for (int i = 0; i < 200; i += 4)
+            {
+                world.Remove<Position>(entities[i]);
+            }
+
+            larvae::AssertEqual(Tracked::s_alive, 200);
+            for (int i = 0; i < 200; ++i)
+            {
+                larvae::AssertEqual(world.Get<Tracked>(entities[i])->value, i);
+            }
+            larvae::AssertEqual(world.Get<Position>(entities[2])->x, 2.0f);
+            larvae::AssertEqual(world.Get<Velocity>(entities[2])->dx, 1.0f);
+        }
+        larvae::AssertEqual(Tracked::s_alive, 0);
+    });
+
+    auto test22 = larvae::RegisterTest("QueenWorld", "RemovalLogRecordsAndTrims", []() {
+        queen::World world;
+        const queen::Entity untracked = world.Spawn(Position{});
+        world.Despawn(untracked);
+        larvae::AssertEqual(world.GetRemovalLog().Count(), size_t{0});
+
+        world.TrackRemovals(true);
+        const queen::Entity a = world.Spawn(Position{}, Velocity{});
+        const queen::Entity b = world.Spawn(Position{});
+        world.Add(b, Flagged{});
+        world.Remove<Velocity>(a);
+
+        world.IncrementTick();
+        const queen::Tick second = world.CurrentTick();
+        world.Remove<Flagged>(b);
+        world.Despawn(a);
+
+        const auto& records = world.GetRemovalLog().Records();
+        larvae::AssertEqual(records.Size(), size_t{3});
+        larvae::AssertEqual(records[0].m_typeId, queen::TypeIdOf<Velocity>());
+        larvae::AssertEqual(records[1].m_typeId, queen::TypeIdOf<Flagged>());
+        larvae::AssertTrue(records[2].IsDespawn());
+        larvae::AssertEqual(world.GetRemovalLog().FirstSince(second), size_t{1});
+
+        world.TrimRemovals(second);
+        larvae::AssertEqual(world.GetRemovalLog().Count(), size_t{2});
+
+        world.ClearEntities();
+        larvae::AssertEqual(world.GetRemovalLog().Count(), size_t{1});
+        larvae::AssertTrue(world.GetRemovalLog().Records()[0].IsClear());
+    });
+
+    auto test23 = larvae::RegisterTest("QueenWorld", "MergeFromMovesTablesAndHierarchy", []() {
+        Tracked::s_alive = 0;
+        {
+            queen::World world{};
+            const queen::Entity resident = world.Spawn(Position{-1.0f, 0.0f, 0.0f});
+
+            queen::World staging{};
+            queen::Entity staged[300];
+            for (int i = 0; i < 300; ++i)
+            {
+                const float x = static_cast<float>(i);
+                staged[i] = i % 3 == 0 ? staging.Spawn(Position{x, 0.0f, 0.0f})
+                                       : staging.Spawn(Position{x, 0.0f, 0.0f}, Tracked{i});
+            }
+            staging.Add(staged[7], Flagged{7});
+            staging.SetParent(staged[1], staged[0]);
+            staging.SetParent(staged[2], staged[0]);
+            staging.SetParent(staged[4], staged[2]);
+            larvae::AssertEqual(Tracked::s_alive, 200);
+
+            queen::MergeEntityMap map;
+            const queen::MergeStats stats = world.MergeFrom(staging, &map);
+
+            larvae::AssertEqual(stats.m_entitiesMerged, size_t{300});
+            larvae::AssertEqual(stats.m_sparseComponentsMerged, size_t{1});
+            larvae::AssertEqual(map.Count(), size_t{300});
+            larvae::AssertEqual(world.EntityCount(), size_t{301});
+            larvae::AssertEqual(staging.EntityCount(), size_t{0});
+            larvae::AssertEqual(Tracked::s_alive, 200);
+            larvae::AssertTrue(world.IsAlive(resident));
+
+            for (int i = 0; i < 300; ++i)
+            {
+                const queen::Entity merged = map.Map(staged[i]);
+                larvae::AssertTrue(world.IsAlive(merged));
+                larvae::AssertEqual(world.Get<Position>(merged)->x, static_cast<float>(i));
+                if (i % 3 != 0)
+                {
+                    larvae::AssertEqual(world.Get<Tracked>(merged)->value, i);
+                }
+            }
+            larvae::AssertEqual(world.Get<Flagged>(map.Map(staged[7]))->value, 7);
+
+            const queen::Entity root = map.Map(staged[0]);
+            larvae::AssertTrue(world.GetParent(map.Map(staged[1])) == root);
+            larvae::AssertTrue(world.GetParent(map.Map(staged[4])) == map.Map(staged[2]));
+            larvae::AssertEqual(world.Get<queen::Children>(root)->Count(), size_t{2});
+            larvae::AssertTrue(world.Get<queen::Children>(root)->At(1) == map.Map(staged[2]));
+
+            // The merged hierarchy lives in this world and keeps working after the staging world is reused
+            staging.SetParent(staging.Spawn(Position{}), staging.Spawn(Position{}));
+            world.SetParent(map.Map(staged[5]), root);
+            larvae::AssertEqual(world.Get<queen::Children>(root)->Count(), size_t{3});
+
+            world.MergeFrom(staging);
+            larvae::AssertEqual(world.EntityCount(), size_t{303});
+        }
+        larvae::AssertEqual(Tracked::s_alive, 0);
+    });
+
+    auto test24 = larvae::RegisterTest("QueenWorld", "MergeFromWorkerBuiltStagingFiresObservers", []() {
+        queen::World world{};
+        int added = 0;
+        float sum = 0.0f;
+        world.Observer<queen::OnAdd<Velocity>>("CountVelocity").Each([&](queen::Entity, const Velocity& v) {
+            ++added;
+            sum += v.dx;
+        });
+
+        queen::World staging{};
+        std::thread loader{[&staging] {
+            for (int i = 0; i < 1000; ++i)
+            {
+                const float dx = static_cast<float>(i);
+                if (i % 2 == 0)
+                {
+                    static_cast<void>(staging.Spawn(Position{dx, 0.0f, 0.0f}, Velocity{dx, 0.0f, 0.0f}));
+                }
+                else
+                {
+                    static_cast<void>(staging.Spawn(Velocity{dx, 0.0f, 0.0f}, Health{i, i}));
+                }
+            }
+        }};
+        loader.join();
+
+        const queen::MergeStats stats = world.MergeFrom(staging);
+
+        larvae::AssertEqual(stats.m_entitiesMerged, size_t{1000});
+        larvae::AssertEqual(stats.m_archetypesMerged, size_t{2});
+        larvae::AssertEqual(added, 1000);
+        larvae::AssertEqual(sum, 499500.0f);
+
+        size_t moving = 0;
+        world.Query<queen::Read<Velocity>>().Each([&](const Velocity&) { ++moving; });
+        larvae::AssertEqual(moving, size_t{1000});
+    });
+
+    auto test25 = larvae::RegisterTest("QueenWorld", "SpawnBatchBeyondFrameAllocator", []() {
+        queen::WorldAllocatorConfig config{};
+        config.m_frameSize = 64 * 1024;
+        queen::World world{config};
+
+        // Each batch alone needs more entity handles than the frame allocator holds
+        for (int batch = 0; batch < 4; ++batch)
+        {
+            world.SpawnBatch<Position>(20000, [](size_t i, Position& pos) { pos.x = static_cast<float>(i); });
+        }
+
+        queen::SpawnBatchComponent components[2];
+        components[0].m_meta = queen::ComponentMeta::Of<Velocity>();
+        components[1].m_meta = queen::ComponentMeta::Of<Flagged>();
+        world.SpawnBatchRaw(20000, components, 2);
+
+        larvae::AssertEqual(world.EntityCount(), size_t{100000});
+
+        size_t positions = 0;
+        world.Query<queen::Read<Position>>().Each([&positions](const Position&) { ++positions; });
+        larvae::AssertEqual(positions, size_t{80000});
+
+        size_t flagged = 0;
+        world.Query<queen::Read<Velocity>, queen::Read<Flagged>>().Each(
+            [&flagged](const Velocity&, const Flagged&) { ++flagged; });
+        larvae::AssertEqual(flagged, size_t{20000});
+    });
 } // namespace
@@ -370,4 +370,270 @@ namespace
 
         larvae::AssertEqual(count.load(), 0);
     });
+
+    // ParEach Tests
+
+    auto test16 = larvae::RegisterTest("QueenWorldParallel", "QueryParEachVisitsEveryRowOnce", []() {
+        queen::World world{};
+        TestJobSystem js;
+
+        for (int i = 0; i < 3000; ++i)
+        {
+            (void)world.Spawn(Position{1.0f, 0.0f, 0.0f}, Velocity{0.0f, 0.0f, 0.0f});
+        }
+        for (int i = 0; i < 700; ++i)
+        {
+            (void)world.Spawn(Position{1.0f, 0.0f, 0.0f}, Health{1, 1});
+        }
+
+        auto query = world.Query<queen::Write<Position>>();
+        query.ParEach(
+            js.m_submitter, [](Position& pos) { pos.y += 1.0f; }, 64);
+
+        int visited = 0;
+        bool allOnce = true;
+        world.Query<queen::Read<Position>>().Each([&](const Position& pos) {
+            ++visited;
+            allOnce = allOnce && pos.y == 1.0f;
+        });
+
+        larvae::AssertEqual(visited, 3700);
+        larvae::AssertTrue(allOnce);
+    });
+
+    auto test17 = larvae::RegisterTest("QueenWorldParallel", "SystemParEachUnderUpdateParallel", []() {
+        queen::World world{};
+        TestJobSystem js;
+
+        for (int i = 0; i < 5000; ++i)
+        {
+            (void)world.Spawn(Position{0.0f, 0.0f, 0.0f}, Velocity{1.0f, 0.0f, 0.0f});
+        }
+
+        std::atomic<int> count{0};
+
+        // Two ParEach systems that can run concurrently must not starve the two workers
+        world.System<queen::Read<Velocity>, queen::Write<Position>>("Integrate")
+            .ParEach([&count](const Velocity& vel, Position& pos) {
+                pos.x += vel.dx;
+                count.fetch_add(1, std::memory_order_relaxed);
+            }, 128);
+        world.System<queen::Read<Velocity>>("Reader").ParEach(
+            [&count](const Velocity&) { count.fetch_add(1, std::memory_order_relaxed); }, 128);
+
+        world.UpdateParallel(js.m_submitter);
+        world.UpdateParallel(js.m_submitter);
+
+        larvae::AssertEqual(count.load(), 20000);
+
+        float sum = 0.0f;
+        world.Query<queen::Read<Position>>().Each([&sum](const Position& pos) { sum += pos.x; });
+        larvae::AssertEqual(sum, 10000.0f);
+    });
+
+    auto test18 = larvae::RegisterTest("QueenWorldParallel", "SystemParEachSequentialFallback", []() {
+        queen::World world{};
+
+        for (int i = 0; i < 100; ++i)
+        {
+            (void)world.Spawn(Position{0.0f, 0.0f, 0.0f});
+        }
+
+        int count = 0;
+        world.System<queen::Read<Position>>("Counter").ParEach([&count](const Position&) { ++count; }, 1);
+
+        larvae::AssertFalse(world.GetJobSubmitter().IsValid());
+        world.Update();
+
+        larvae::AssertEqual(count, 100);
+    });
+
+    auto test19 = larvae::RegisterTest("QueenWorldParallel", "QueryParEachChunkedTables", []() {
+        queen::WorldAllocatorConfig config{};
+        config.m_tableChunkBytes = 4 * 1024;
+        queen::World world{config};
+        TestJobSystem js;
+
+        for (int i = 0; i < 2500; ++i)
+        {
+            (void)world.Spawn(Position{1.0f, 0.0f, 0.0f}, Velocity{0.0f, 0.0f, 0.0f});
+        }
+
+        auto query = world.Query<queen::Write<Position>>();
+        query.ParEach(
+            js.m_submitter, [](Position& pos) { pos.y += 1.0f; }, 100);
+
+        int visited = 0;
+        bool allOnce = true;
+        world.Query<queen::Read<Position>>().Each([&](const Position& pos) {
+            ++visited;
+            allOnce = allOnce && pos.y == 1.0f;
+        });
+
+        larvae::AssertEqual(visited, 2500);
+        larvae::AssertTrue(allOnce);
+    });
+    auto test20 = larvae::RegisterTest("QueenWorldParallel", "SystemStatsRecordedInParallel", []() {
+        TestJobSystem js;
+        queen::World world{};
+        (void)world.Spawn(Position{1.0f, 0.0f, 0.0f});
+        (void)world.Spawn(Position{2.0f, 0.0f, 0.0f});
+
+        auto moveId = world.System<queen::Write<Position>>("Move").Each([](Position& p) { p.x += 1.0f; });
+        auto healthId = world.System<queen::Read<Health>>("ReadHealth").Each([](const Health&) {});
+
+        world.UpdateParallel(js.m_submitter);
+        world.UpdateParallel(js.m_submitter);
+
+        const auto& storage = world.GetSystemStorage();
+        const queen::SystemStats& move = storage.GetSystem(moveId)->Stats();
+        larvae::AssertEqual(move.m_invocations, uint64_t{2});
+        larvae::AssertEqual(move.m_lastEntities, uint64_t{2});
+        larvae::AssertTrue(move.m_lastWaitNanos >= 0);
+        larvae::AssertEqual(storage.GetSystem(healthId)->Stats().m_lastEntities, uint64_t{0});
+
+        const queen::TimelineEvent* frame = storage.Timeline().Frame(0);
+        larvae::AssertTrue(frame != nullptr);
+        larvae::AssertTrue(frame[moveId.Index()].m_ran);
+        larvae::AssertEqual(frame[moveId.Index()].m_worker, move.m_lastWorker);
+    });
+
+    auto test21 = larvae::RegisterTest("QueenWorldParallel", "SkippedSystemReleasesDependents", []() {
+        TestJobSystem js;
+        queen::World world{};
+        auto entity = world.Spawn(Health{100, 100}, Position{0.0f, 0.0f, 0.0f});
+
+        std::atomic<int> reactive{0};
+        std::atomic<int> dependent{0};
+        auto reactiveId = world.System<queen::Read<Health>, queen::Write<Position>>("Reactive")
+                              .RunIfChanged()
+                              .Each([&reactive](const Health&, Position& p) {
+                                  p.x += 1.0f;
+                                  reactive.fetch_add(1, std::memory_order_relaxed);
+                              });
+        (void)world.System<queen::Read<Position>>("Dependent")
+            .After(reactiveId)
+            .Each([&dependent](const Position&) { dependent.fetch_add(1, std::memory_order_relaxed); });
+
+        for (int i = 0; i < 4; ++i)
+        {
+            world.UpdateParallel(js.m_submitter);
+        }
+
+        larvae::AssertEqual(reactive.load(), 1);
+        larvae::AssertEqual(dependent.load(), 4);
+        larvae::AssertEqual(world.GetSystemStorage().GetSystem(reactiveId)->Stats().m_skips, uint64_t{3});
+
+        world.Set(entity, Health{40, 100});
+        world.UpdateParallel(js.m_submitter);
+        larvae::AssertEqual(reactive.load(), 2);
+        larvae::AssertEqual(dependent.load(), 5);
+    });
+
+    auto test22 = larvae::RegisterTest("QueenWorldParallel", "AsyncSystemOverlapsFrames", []() {
+        TestJobSystem js;
+        queen::World world{};
+        (void)world.Spawn(Health{0, 100});
+
+        std::atomic<int> computed{0};
+        std::atomic<int> frames{0};
+        (void)world.System<queen::Write<Health>>("Planner").Async([&](queen::AsyncSystemContext& ctx) -> drone::Task<> {
+            drone::Counter done;
+            drone::JobDecl job;
+            job.m_func = [](void* data) {
+                static_cast<std::atomic<int>*>(data)->store(42, std::memory_order_release);
+            };
+            job.m_userData = &computed;
+            ctx.Jobs().Submit(job, done);
+
+            co_await ctx.WaitFor(done);
+            ctx.GetWorld().Query<queen::Write<Health>>().Each(
+                [&computed](Health& hp) { hp.current = computed.load(std::memory_order_acquire); });
+            co_await ctx.NextTick();
+        });
+        (void)world.System<queen::Read<Position>>("Frame").Each([](const Position&) {});
+        (void)world.System("Counter").Run([&frames](queen::World&) { frames.fetch_add(1); });
+
+        int current = 0;
+        for (int i = 0; i < 1000 && current != 42; ++i)
+        {
+            world.UpdateParallel(js.m_submitter);
+            world.Query<queen::Read<Health>>().Each([&current](const Health& hp) { current = hp.current; });
+        }
+
+        larvae::AssertEqual(current, 42);
+        larvae::AssertTrue(frames.load() >= 2);
+    });
+
+    auto test23 = larvae::RegisterTest("QueenWorldParallel", "ParallelSystemsSendEvents", []() {
+        struct HitEvent
+        {
+            uint32_t source;
+        };
+
+        TestJobSystem js;
+        queen::World world{};
+        for (int i = 0; i < 64; ++i)
+        {
+            (void)world.Spawn(Position{0.0f, 0.0f, 0.0f}, Health{100, 100});
+        }
+
+        auto reader = world.EventReader<HitEvent>();
+        (void)world.System<queen::Read<Position>>("PositionHits").Each([&world](const Position&) {
+            world.SendEvent(HitEvent{0});
+        });
+        (void)world.System<queen::Read<Health>>("HealthHits").Each([&world](const Health&) {
+            world.SendEvent(HitEvent{1});
+        });
+
+        world.UpdateParallel(js.m_submitter);
+        larvae::AssertEqual(reader.TotalCount(), size_t{128});
+
+        uint32_t perSource[2] = {0, 0};
+        reader.Read([&perSource](const HitEvent& hit) { ++perSource[hit.source]; });
+        larvae::AssertEqual(perSource[0], uint32_t{64});
+        larvae::AssertEqual(perSource[1], uint32_t{64});
+    });
+
+    auto test24 = larvae::RegisterTest("QueenWorldParallel", "ParallelEventSlotsGrowOnManyWorkers", []() {
+        struct HitEvent
+        {
+            uint32_t source;
+        };
+
+        constexpr uint32_t kSystems = 4;
+        constexpr int kEntities = 4096;
+
+        comb::BuddyAllocator poolAlloc{2 * 1024 * 1024};
+        drone::JobSystem<comb::BuddyAllocator> jobs{poolAlloc, {4, 1024, 1024, 64 * 1024}};
+        drone::JobSubmitter submitter{drone::MakeJobSubmitter(jobs)};
+        jobs.Start();
+
+        queen::World world{};
+        for (int i = 0; i < kEntities; ++i)
+        {
+            (void)world.Spawn(Position{0.0f, 0.0f, 0.0f});
+        }
+
+        // Every system pushes thousands of events, so each worker slot reallocates many times
+        auto reader = world.EventReader<HitEvent>();
+        for (uint32_t s = 0; s < kSystems; ++s)
+        {
+            (void)world.System<queen::Read<Position>>("Hits").Each([&world, s](const Position&) {
+                world.SendEvent(HitEvent{s});
+            });
+        }
+
+        world.UpdateParallel(submitter);
+        larvae::AssertEqual(reader.TotalCount(), size_t{kSystems} * kEntities);
+
+        uint32_t perSource[kSystems] = {};
+        reader.Read([&perSource](const HitEvent& hit) { ++perSource[hit.source]; });
+        for (uint32_t s = 0; s < kSystems; ++s)
+        {
+            larvae::AssertEqual(perSource[s], uint32_t{kEntities});
+        }
+
+        jobs.Stop();
+    });
 } // namespace
@@ -1,12 +1,21 @@
 #include <queen/reflect/component_registry.h>
+#include <queen/reflect/json_deserializer.h>
+#include <queen/reflect/json_serializer.h>
 #include <queen/reflect/reflectable.h>
 #include <queen/reflect/world_deserializer.h>
 #include <queen/reflect/world_serializer.h>
+#include <queen/reflect/world_snapshot.h>
 #include <queen/world/world.h>
 
+#include <comb/buddy_allocator.h>
+#include <comb/linear_allocator.h>
+
+#include <drone/job_system.h>
+
 #include <larvae/larvae.h>
 
 #include <cstring>
+#include <string>
 
 namespace
 {
@@ -64,6 +73,32 @@ namespace
         }
     };
 
+    // Not trivially copyable, saved through its reflected fields
+    struct Owned
+    {
+        queen::Entity owner;
+        int32_t rank = 0;
+
+        ~Owned() {}
+
+        static void Reflect(queen::ComponentReflector<>& r)
+        {
+            r.Field("owner", &Owned::owner);
+            r.Field("rank", &Owned::rank);
+        }
+    };
+
+    struct Tag
+    {
+        static constexpr queen::StorageType storage = queen::StorageType::SPARSE;
+        int32_t value = 0;
+
+        static void Reflect(queen::ComponentReflector<>& r)
+        {
+            r.Field("value", &Tag::value);
+        }
+    };
+
     // Helpers
 
     bool HasEntityWithPos(queen::World& world, float ex, float ey, float ez)
@@ -385,6 +420,43 @@ namespace
         larvae::AssertTrue(dst.GetParent(d_leaf) == d_mid);
     });
 
+    auto test_hierarchy_bulk =
+        larvae::RegisterTest("QueenWorldSerialization", "HierarchyBuiltInBulk", []() {
+            queen::ComponentRegistry<32> registry;
+            registry.Register<Pos>();
+
+            queen::World src;
+            queen::Entity root = src.Spawn(Pos{1.f, 0.f, 0.f});
+            queen::Entity mid = src.Spawn(Pos{2.f, 0.f, 0.f});
+            queen::Entity first = src.Spawn(Pos{3.f, 0.f, 0.f});
+            queen::Entity second = src.Spawn(Pos{4.f, 0.f, 0.f});
+            src.SetParent(mid, root);
+            src.SetParent(first, mid);
+            src.SetParent(second, mid);
+
+            queen::WorldSerializer<8192> serializer;
+            serializer.Serialize(src, registry);
+
+            queen::World dst;
+            int parentAdds = 0;
+            dst.Observer<queen::OnAdd<queen::Parent>>("CountParentAdds")
+                .Each([&parentAdds](queen::Entity, const queen::Parent&) { ++parentAdds; });
+            queen::WorldDeserializer::Deserialize(dst, registry, serializer.CStr());
+
+            queen::Entity d_root = FindEntityWithPos(dst, 1.f, 0.f, 0.f);
+            queen::Entity d_mid = FindEntityWithPos(dst, 2.f, 0.f, 0.f);
+            queen::Entity d_first = FindEntityWithPos(dst, 3.f, 0.f, 0.f);
+            queen::Entity d_second = FindEntityWithPos(dst, 4.f, 0.f, 0.f);
+
+            larvae::AssertTrue(dst.GetParent(d_mid) == d_root);
+            larvae::AssertTrue(dst.GetParent(d_first) == d_mid);
+            larvae::AssertEqual(dst.ChildCount(d_root), size_t{1});
+            larvae::AssertEqual(dst.ChildCount(d_mid), size_t{2});
+            larvae::AssertTrue(dst.GetChildren(d_mid)->At(0) == d_first);
+            larvae::AssertTrue(dst.GetChildren(d_mid)->At(1) == d_second);
+            larvae::AssertEqual(parentAdds, 3);
+        });
+
     // Forward-compatibility tests
 
     auto test_unknown_component_skipped =
@@ -546,4 +618,443 @@ namespace
             larvae::AssertEqual(result.m_componentsLoaded, size_t{3}); // Pos + Health + Pos
             larvae::AssertEqual(result.m_componentsSkipped, size_t{0});
         });
+
+    auto test_snapshot_round_trip = larvae::RegisterTest("QueenWorldSerialization", "SnapshotRoundTrip", []() {
+        queen::ComponentRegistry<32> registry;
+        registry.Register<Pos>();
+        registry.Register<Vel>();
+        registry.Register<Targeting>();
+        registry.Register<Owned>();
+        registry.Register<Tag>();
+
+        queen::World src;
+        for (int i = 0; i < 300; ++i)
+        {
+            static_cast<void>(src.Spawn(Pos{static_cast<float>(i), 0.f, 0.f}, Vel{1.f, 2.f, 3.f}));
+        }
+        const queen::Entity leader = src.Spawn(Pos{-1.f, -2.f, -3.f});
+        const queen::Entity follower = src.Spawn(Pos{5.f, 5.f, 5.f}, Targeting{leader, 7}, Owned{leader, 3});
+        src.SetParent(follower, leader);
+        src.Add(leader, Tag{42});
+
+        comb::LinearAllocator alloc{256 * 1024};
+        wax::BinaryWriter writer{alloc};
+        const auto saved = queen::WorldSnapshot::Save(src, registry, writer);
+
+        larvae::AssertTrue(saved.m_success);
+        larvae::AssertEqual(saved.m_entitiesWritten, size_t{302});
+
+        queen::World dst;
+        static_cast<void>(dst.Spawn(Vel{})); // Loaded ids must not collide with live ones
+        const auto loaded = queen::WorldSnapshot::Load(dst, registry, writer.View());
+
+        larvae::AssertTrue(loaded.m_success);
+        larvae::AssertEqual(loaded.m_entitiesLoaded, size_t{302});
+        larvae::AssertEqual(loaded.m_componentsSkipped, size_t{0});
+        larvae::AssertEqual(dst.EntityCount(), size_t{303});
+        larvae::AssertTrue(HasEntityWithPos(dst, 299.f, 0.f, 0.f));
+
+        queen::Entity newLeader{};
+        queen::Entity newFollower{};
+        dst.Query<queen::Read<Pos>>().EachWithEntity([&](queen::Entity entity, const Pos& pos) {
+            if (pos.x == -1.f)
+                newLeader = entity;
+            if (pos.x == 5.f)
+                newFollower = entity;
+        });
+
+        larvae::AssertTrue(dst.IsAlive(newLeader));
+        larvae::AssertTrue(dst.IsAlive(newFollower));
+        larvae::AssertTrue(dst.Get<Targeting>(newFollower)->target == newLeader);
+        larvae::AssertEqual(dst.Get<Targeting>(newFollower)->priority, int32_t{7});
+        larvae::AssertTrue(dst.Get<Owned>(newFollower)->owner == newLeader);
+        larvae::AssertEqual(dst.Get<Owned>(newFollower)->rank, int32_t{3});
+        larvae::AssertTrue(dst.GetParent(newFollower) == newLeader);
+        larvae::AssertEqual(dst.Get<Tag>(newLeader)->value, int32_t{42});
+    });
+
+    auto test_snapshot_hierarchy = larvae::RegisterTest("QueenWorldSerialization", "SnapshotHierarchy", []() {
+        queen::ComponentRegistry<32> registry;
+        registry.Register<Pos>();
+
+        queen::World src;
+        const queen::Entity root = src.Spawn(Pos{1.f, 0.f, 0.f});
+        const queen::Entity mid = src.Spawn(Pos{2.f, 0.f, 0.f});
+        const queen::Entity first = src.Spawn(Pos{3.f, 0.f, 0.f});
+        const queen::Entity second = src.Spawn(Pos{4.f, 0.f, 0.f});
+        src.SetParent(mid, root);
+        src.SetParent(first, mid);
+        src.SetParent(second, mid);
+
+        comb::LinearAllocator alloc{64 * 1024};
+        wax::BinaryWriter writer{alloc};
+        const auto saved = queen::WorldSnapshot::Save(src, registry, writer);
+        larvae::AssertTrue(saved.m_success);
+        larvae::AssertEqual(saved.m_componentsWritten, size_t{4});
+
+        queen::World dst;
+        int parentAdds = 0;
+        dst.Observer<queen::OnAdd<queen::Parent>>("CountParentAdds")
+            .Each([&parentAdds](queen::Entity, const queen::Parent&) { ++parentAdds; });
+        const auto loaded = queen::WorldSnapshot::Load(dst, registry, writer.View());
+        larvae::AssertTrue(loaded.m_success);
+        larvae::AssertEqual(loaded.m_componentsSkipped, size_t{0});
+
+        const queen::Entity d_root = FindEntityWithPos(dst, 1.f, 0.f, 0.f);
+        const queen::Entity d_mid = FindEntityWithPos(dst, 2.f, 0.f, 0.f);
+        const queen::Entity d_first = FindEntityWithPos(dst, 3.f, 0.f, 0.f);
+        const queen::Entity d_second = FindEntityWithPos(dst, 4.f, 0.f, 0.f);
+
+        larvae::AssertFalse(dst.HasParent(d_root));
+        larvae::AssertTrue(dst.GetParent(d_mid) == d_root);
+        larvae::AssertTrue(dst.GetParent(d_first) == d_mid);
+        larvae::AssertTrue(dst.GetParent(d_second) == d_mid);
+        larvae::AssertEqual(dst.ChildCount(d_root), size_t{1});
+        larvae::AssertEqual(dst.ChildCount(d_mid), size_t{2});
+        larvae::AssertEqual(parentAdds, 3);
+
+        // The rebuilt lists are live, reparenting keeps them consistent
+        dst.SetParent(d_second, d_root);
+        larvae::AssertEqual(dst.ChildCount(d_mid), size_t{1});
+        larvae::AssertEqual(dst.ChildCount(d_root), size_t{2});
+    });
+
+    auto test_snapshot_rejects_and_skips =
+        larvae::RegisterTest("QueenWorldSerialization", "SnapshotRejectsAndSkips", []() {
+            queen::ComponentRegistry<32> full;
+            full.Register<Pos>();
+            full.Register<Health>();
+
+            queen::World src;
+            static_cast<void>(src.Spawn(Pos{1.f, 2.f, 3.f}, Health{10, 20}));
+
+            comb::LinearAllocator alloc{64 * 1024};
+            wax::BinaryWriter writer{alloc};
+            larvae::AssertTrue(queen::WorldSnapshot::Save(src, full, writer).m_success);
+
+            queen::ComponentRegistry<32> partial;
+            partial.Register<Pos>();
+
+            queen::World dst;
+            const auto loaded = queen::WorldSnapshot::Load(dst, partial, writer.View());
+            larvae::AssertTrue(loaded.m_success);
+            larvae::AssertEqual(loaded.m_componentsLoaded, size_t{1});
+            larvae::AssertEqual(loaded.m_componentsSkipped, size_t{1});
+            larvae::AssertTrue(HasEntityWithPos(dst, 1.f, 2.f, 3.f));
+
+            queen::World truncated;
+            const auto cut = queen::WorldSnapshot::Load(truncated, full, writer.View().Subspan(0, writer.Size() - 4));
+            larvae::AssertFalse(cut.m_success);
+
+            const uint8_t garbage[16]{};
+            queen::World rejected;
+            const auto bad = queen::WorldSnapshot::Load(rejected, full, wax::ByteSpan{garbage, sizeof(garbage)});
+            larvae::AssertFalse(bad.m_success);
+            larvae::AssertEqual(rejected.EntityCount(), size_t{0});
+        });
+
+    auto test_delta_skips_unchanged = larvae::RegisterTest("QueenWorldSerialization", "DeltaSkipsUnchanged", []() {
+        queen::ComponentRegistry<32> registry;
+        registry.Register<Pos>();
+        registry.Register<Vel>();
+
+        queen::World world;
+        queen::Entity moved{};
+        for (int i = 0; i < 200; ++i)
+        {
+            const queen::Entity entity = world.Spawn(Pos{static_cast<float>(i), 0.f, 0.f}, Vel{});
+            if (i == 150)
+                moved = entity;
+        }
+
+        world.IncrementTick();
+        const queen::Tick since = world.CurrentTick();
+
+        queen::DynamicWorldSerializer serializer;
+        auto result = serializer.SerializeDelta(world, registry, since);
+        larvae::AssertTrue(result.m_success);
+        larvae::AssertEqual(result.m_entitiesWritten, size_t{0});
+
+        world.Set(moved, Pos{-1.f, 0.f, 0.f});
+        result = serializer.SerializeDelta(world, registry, since);
+        larvae::AssertTrue(result.m_success);
+        larvae::AssertEqual(result.m_entitiesWritten, size_t{1});
+        larvae::AssertEqual(result.m_componentsWritten, size_t{1});
+        larvae::AssertTrue(std::strstr(serializer.CStr(), "\"Vel\"") == nullptr);
+    });
+
+    auto test_delta_apply_patches_world =
+        larvae::RegisterTest("QueenWorldSerialization", "DeltaApplyPatchesWorld", []() {
+            queen::ComponentRegistry<32> registry;
+            registry.Register<Pos>();
+            registry.Register<Vel>();
+            registry.Register<Targeting>();
+            registry.Register<Tag>();
+
+            queen::World src;
+            src.TrackRemovals(true);
+            const queen::Entity a = src.Spawn(Pos{1.f, 0.f, 0.f});
+            const queen::Entity b = src.Spawn(Pos{2.f, 0.f, 0.f});
+            const queen::Entity c = src.Spawn(Pos{3.f, 0.f, 0.f}, Vel{1.f, 1.f, 1.f});
+            src.SetParent(c, a);
+
+            queen::DynamicWorldSerializer serializer;
+            queen::DeltaEntityMap mapping;
+            queen::World dst;
+
+            larvae::AssertTrue(serializer.SerializeDelta(src, registry, queen::Tick{0}).m_success);
+            auto applied = queen::WorldDeserializer::ApplyDelta(dst, registry, serializer.CStr(), mapping);
+            larvae::AssertTrue(applied.m_success);
+            larvae::AssertEqual(applied.m_entitiesLoaded, size_t{3});
+            larvae::AssertEqual(dst.EntityCount(), size_t{3});
+
+            src.IncrementTick();
+            const queen::Tick since = src.CurrentTick();
+            src.Set(a, Pos{10.f, 0.f, 0.f});
+            src.Despawn(b);
+            src.Remove<Vel>(c);
+            src.RemoveParent(c);
+            const queen::Entity d = src.Spawn(Pos{4.f, 0.f, 0.f}, Targeting{a, 2});
+            src.SetParent(d, a);
+            src.Add(d, Tag{9});
+
+            larvae::AssertTrue(serializer.SerializeDelta(src, registry, since).m_success);
+            applied = queen::WorldDeserializer::ApplyDelta(dst, registry, serializer.CStr(), mapping);
+            larvae::AssertTrue(applied.m_success);
+            larvae::AssertEqual(applied.m_entitiesLoaded, size_t{1});
+            larvae::AssertEqual(dst.EntityCount(), size_t{3});
+
+            const queen::Entity liveA = *mapping.Find(a.ToU64());
+            const queen::Entity liveC = *mapping.Find(c.ToU64());
+            const queen::Entity liveD = *mapping.Find(d.ToU64());
+            larvae::AssertTrue(mapping.Find(b.ToU64()) == nullptr);
+
+            larvae::AssertEqual(dst.Get<Pos>(liveA)->x, 10.f);
+            larvae::AssertTrue(dst.Get<Vel>(liveC) == nullptr);
+            larvae::AssertTrue(dst.GetParent(liveC).IsNull());
+            larvae::AssertTrue(dst.Get<Targeting>(liveD)->target == liveA);
+            larvae::AssertTrue(dst.GetParent(liveD) == liveA);
+            larvae::AssertEqual(dst.Get<Tag>(liveD)->value, int32_t{9});
+
+            src.ClearEntities();
+            larvae::AssertTrue(serializer.SerializeDelta(src, registry, since).m_success);
+            applied = queen::WorldDeserializer::ApplyDelta(dst, registry, serializer.CStr(), mapping);
+            larvae::AssertTrue(applied.m_success);
+            larvae::AssertEqual(dst.EntityCount(), size_t{0});
+            larvae::AssertEqual(mapping.Count(), size_t{0});
+        });
+
+    auto test_delta_respawns_locally_despawned =
+        larvae::RegisterTest("QueenWorldSerialization", "DeltaRespawnsLocallyDespawned", []() {
+            queen::ComponentRegistry<32> registry;
+            registry.Register<Pos>();
+
+            queen::World src;
+            const queen::Entity a = src.Spawn(Pos{1.f, 0.f, 0.f});
+
+            queen::DynamicWorldSerializer serializer;
+            queen::DeltaEntityMap mapping;
+            queen::World dst;
+
+            larvae::AssertTrue(serializer.SerializeDelta(src, registry, queen::Tick{0}).m_success);
+            auto applied = queen::WorldDeserializer::ApplyDelta(dst, registry, serializer.CStr(), mapping);
+            larvae::AssertTrue(applied.m_success);
+            dst.Despawn(*mapping.Find(a.ToU64()));
+
+            // The first delta respawns the entity and must remap it, the second one patches that same entity
+            for (int step = 0; step < 2; ++step)
+            {
+                src.IncrementTick();
+                const queen::Tick since = src.CurrentTick();
+                src.Set(a, Pos{static_cast<float>(10 + step), 0.f, 0.f});
+
+                larvae::AssertTrue(serializer.SerializeDelta(src, registry, since).m_success);
+                applied = queen::WorldDeserializer::ApplyDelta(dst, registry, serializer.CStr(), mapping);
+                larvae::AssertTrue(applied.m_success);
+                larvae::AssertEqual(applied.m_entitiesLoaded, step == 0 ? size_t{1} : size_t{0});
+                larvae::AssertEqual(dst.EntityCount(), size_t{1});
+
+                const queen::Entity live = *mapping.Find(a.ToU64());
+                larvae::AssertTrue(dst.IsAlive(live));
+                larvae::AssertEqual(dst.Get<Pos>(live)->x, static_cast<float>(10 + step));
+            }
+        });
+
+    auto test_shortest_float_round_trip =
+        larvae::RegisterTest("QueenWorldSerialization", "ShortestFloatRoundTrip", []() {
+            queen::ComponentRegistry<32> registry;
+            registry.Register<Pos>();
+            const queen::ComponentReflection& reflection = registry.Find(queen::TypeIdOf<Pos>())->m_reflection;
+
+            const Pos original{0.1f, 1.0e-7f, 3.4028235e38f};
+            queen::JsonSerializer<256> serializer;
+            serializer.SerializeComponent(&original, reflection);
+            larvae::AssertTrue(std::strcmp(serializer.CStr(), "{\"x\":0.1,\"y\":1e-07,\"z\":3.4028235e+38}") == 0);
+
+            Pos loaded{};
+            larvae::AssertTrue(queen::JsonDeserializer::DeserializeComponent(&loaded, reflection, serializer.CStr())
+                                   .m_success);
+            larvae::AssertTrue(std::memcmp(&loaded, &original, sizeof(Pos)) == 0);
+        });
+
+    auto test_parallel_and_streamed_match_serial =
+        larvae::RegisterTest("QueenWorldSerialization", "ParallelAndStreamedMatchSerial", []() {
+            queen::ComponentRegistry<32> registry;
+            registry.Register<Pos>();
+            registry.Register<Vel>();
+            registry.Register<Tag>();
+
+            queen::World world;
+            const queen::Entity root = world.Spawn(Pos{});
+            for (int i = 0; i < 3000; ++i)
+            {
+                const float f = static_cast<float>(i) * 0.37f;
+                const queen::Entity entity = (i % 3 == 0) ? world.Spawn(Pos{f, -f, f * f}, Vel{f, 0.f, 1.f})
+                                                          : world.Spawn(Pos{f, f, -f});
+                if (i % 100 == 0)
+                {
+                    world.SetParent(entity, root);
+                    world.Add(entity, Tag{i});
+                }
+            }
+
+            queen::DynamicWorldSerializer serial;
+            const auto serialResult = serial.Serialize(world, registry);
+            larvae::AssertTrue(serialResult.m_success);
+
+            comb::BuddyAllocator poolAlloc{2 * 1024 * 1024};
+            drone::JobSystem<comb::BuddyAllocator> jobSystem{poolAlloc, {2, 1024, 1024, 64 * 1024}};
+            jobSystem.Start();
+            const drone::JobSubmitter jobs = drone::MakeJobSubmitter(jobSystem);
+
+            queen::DynamicWorldSerializer parallel;
+            const auto parallelResult = parallel.SerializeParallel(world, registry, jobs);
+
+            wax::String streamed{};
+            const queen::TextSink sink{&streamed, [](void* user, const char* data, size_t size) {
+                                           static_cast<wax::String*>(user)->Append(data, size);
+                                           return true;
+                                       }};
+            queen::DynamicWorldSerializer streaming;
+            const auto streamedResult = streaming.SerializeTo(world, registry, sink, jobs);
+            jobSystem.Stop();
+
+            larvae::AssertTrue(parallelResult.m_success);
+            larvae::AssertTrue(streamedResult.m_success);
+            larvae::AssertEqual(parallelResult.m_entitiesWritten, serialResult.m_entitiesWritten);
+            larvae::AssertEqual(streamedResult.m_componentsWritten, serialResult.m_componentsWritten);
+            larvae::AssertEqual(parallel.Size(), serial.Size());
+            larvae::AssertTrue(std::strcmp(parallel.CStr(), serial.CStr()) == 0);
+            larvae::AssertTrue(std::strcmp(streamed.CStr(), serial.CStr()) == 0);
+
+            queen::World loaded;
+            larvae::AssertTrue(queen::WorldDeserializer::Deserialize(loaded, registry, streamed.CStr()).m_success);
+            larvae::AssertEqual(loaded.EntityCount(), size_t{3001});
+        });
+
+    auto test_grouped_load = larvae::RegisterTest("QueenWorldSerialization", "GroupedLoadInterleavedSignatures", []() {
+        queen::ComponentRegistry<32> registry;
+        registry.Register<Pos>();
+        registry.Register<Targeting>();
+        registry.Register<Tag>();
+
+        const std::string pos = queen::GetReflectionData<Pos>().m_name;
+        const std::string targeting = queen::GetReflectionData<Targeting>().m_name;
+        const std::string tag = queen::GetReflectionData<Tag>().m_name;
+
+        // Three signatures interleaved, components listed in varying order, references and parents pointing both
+        // ways and more entities than the old 4096 cap
+        constexpr int kCount = 6000;
+        std::string json = "{\"version\":1,\"entities\":[";
+        for (int i = 0; i < kCount; ++i)
+        {
+            const std::string id = std::to_string(1000 + i);
+            const std::string x = std::to_string(i);
+            json += i > 0 ? ",{\"id\":" : "{\"id\":";
+            json += id;
+            if (i % 100 == 1)
+            {
+                json += ",\"parent\":" + std::to_string(1000 + (i + 1) % kCount);
+            }
+            json += ",\"components\":{";
+            switch (i % 3)
+            {
+                case 0:
+                    json += "\"" + pos + "\":{\"x\":" + x + ",\"y\":0,\"z\":0}";
+                    break;
+                case 1:
+                    json += "\"" + targeting + "\":{\"target\":" + std::to_string(1000 + (i + kCount - 1) % kCount) +
+                            ",\"priority\":" + x + "},\"" + pos + "\":{\"x\":" + x + ",\"y\":0,\"z\":0}";
+                    break;
+                default:
+                    json += "\"" + pos + "\":{\"x\":" + x + ",\"y\":0,\"z\":0},\"" + tag + "\":{\"value\":" + x +
+                            "},\"Unknown\":{\"a\":1}";
+                    break;
+            }
+            json += "}}";
+        }
+        json += "]}";
+
+        queen::World dst;
+        const auto result = queen::WorldDeserializer::Deserialize(dst, registry, json.c_str());
+
+        larvae::AssertTrue(result.m_success);
+        larvae::AssertEqual(result.m_entitiesLoaded, size_t{kCount});
+        larvae::AssertEqual(result.m_componentsLoaded, size_t{kCount + 2 * kCount / 3});
+        larvae::AssertEqual(result.m_componentsSkipped, size_t{kCount / 3});
+        larvae::AssertEqual(dst.EntityCount(), size_t{kCount});
+
+        size_t targets = 0;
+        dst.Query<queen::Read<Pos>, queen::Read<Targeting>>().EachWithEntity(
+            [&](queen::Entity entity, const Pos& p, const Targeting& t) {
+                const int i = static_cast<int>(p.x);
+                larvae::AssertEqual(t.priority, int32_t{i});
+                larvae::AssertEqual(dst.Get<Pos>(t.target)->x, static_cast<float>((i + kCount - 1) % kCount));
+
+                if (i % 100 == 1)
+                {
+                    const queen::Entity parent = dst.GetParent(entity);
+                    larvae::AssertEqual(dst.Get<Pos>(parent)->x, static_cast<float>(i + 1));
+                }
+                ++targets;
+            });
+        larvae::AssertEqual(targets, size_t{kCount / 3});
+
+        size_t tags = 0;
+        dst.Query<queen::Read<Pos>, queen::Read<Tag>>().Each([&](const Pos& p, const Tag& t) {
+            larvae::AssertEqual(t.value, static_cast<int32_t>(p.x));
+            ++tags;
+        });
+        larvae::AssertEqual(tags, size_t{kCount / 3});
+    });
+
+    auto test_grouped_load_fails_cleanly =
+        larvae::RegisterTest("QueenWorldSerialization", "GroupedLoadFailsWithoutSpawning", []() {
+            queen::ComponentRegistry<32> registry;
+            registry.Register<Pos>();
+            registry.Register<Health>();
+
+            const std::string pos = queen::GetReflectionData<Pos>().m_name;
+            const std::string health = queen::GetReflectionData<Health>().m_name;
+
+            queen::World dst;
+            static_cast<void>(dst.Spawn(Pos{7.f, 0.f, 0.f}));
+
+            // The bad Health value is only decoded after the Pos group is spawned
+            const std::string json = "{\"version\":1,\"entities\":[{\"id\":1,\"components\":{\"" + pos +
+                                     "\":{\"x\":1,\"y\":0,\"z\":0}}},{\"id\":2,\"components\":{\"" + health +
+                                     "\":{\"current\":}}}]}";
+            const auto result = queen::WorldDeserializer::Deserialize(dst, registry, json.c_str());
+
+            larvae::AssertFalse(result.m_success);
+            larvae::AssertTrue(std::strcmp(result.m_error, "Failed to deserialize component") == 0);
+            larvae::AssertEqual(dst.EntityCount(), size_t{1});
+            larvae::AssertTrue(HasEntityWithPos(dst, 7.f, 0.f, 0.f));
+            larvae::AssertFalse(HasEntityWithPos(dst, 1.f, 0.f, 0.f));
+
+            // A malformed entity list fails in the first pass
+            const auto truncated = queen::WorldDeserializer::Deserialize(dst, registry, json.substr(0, 40).c_str());
+            larvae::AssertFalse(truncated.m_success);
+            larvae::AssertEqual(dst.EntityCount(), size_t{1});
+        });
 } // namespace